@@ -0,0 +1,152 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/FindAtomics.cmake"
+  "/root/repo/libhwy-contrib.pc.in"
+  "/root/repo/libhwy-test.pc.in"
+  "/root/repo/libhwy.pc.in"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GMockTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GMockTargets.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GTestConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GTestConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GTestTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckPIESupported.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindGTest.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GoogleTest.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckLinkerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "libhwy.pc"
+  "libhwy-test.pc"
+  "libhwy-contrib.pc"
+  "DartConfiguration.tcl"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/hwy.dir/DependInfo.cmake"
+  "CMakeFiles/hwy_contrib.dir/DependInfo.cmake"
+  "CMakeFiles/hwy_test.dir/DependInfo.cmake"
+  "CMakeFiles/hwy_list_targets.dir/DependInfo.cmake"
+  "CMakeFiles/hwy_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/copy_test.dir/DependInfo.cmake"
+  "CMakeFiles/find_test.dir/DependInfo.cmake"
+  "CMakeFiles/transform_test.dir/DependInfo.cmake"
+  "CMakeFiles/search_test.dir/DependInfo.cmake"
+  "CMakeFiles/set_ops_test.dir/DependInfo.cmake"
+  "CMakeFiles/unique_test.dir/DependInfo.cmake"
+  "CMakeFiles/aligned_allocator_test.dir/DependInfo.cmake"
+  "CMakeFiles/base_test.dir/DependInfo.cmake"
+  "CMakeFiles/highway_test.dir/DependInfo.cmake"
+  "CMakeFiles/nanobenchmark_test.dir/DependInfo.cmake"
+  "CMakeFiles/targets_test.dir/DependInfo.cmake"
+  "CMakeFiles/skeleton_test.dir/DependInfo.cmake"
+  "CMakeFiles/arithmetic_test.dir/DependInfo.cmake"
+  "CMakeFiles/blockwise_test.dir/DependInfo.cmake"
+  "CMakeFiles/blockwise_shift_test.dir/DependInfo.cmake"
+  "CMakeFiles/combine_test.dir/DependInfo.cmake"
+  "CMakeFiles/compare_test.dir/DependInfo.cmake"
+  "CMakeFiles/compress_test.dir/DependInfo.cmake"
+  "CMakeFiles/convert_test.dir/DependInfo.cmake"
+  "CMakeFiles/crypto_test.dir/DependInfo.cmake"
+  "CMakeFiles/demote_test.dir/DependInfo.cmake"
+  "CMakeFiles/float_test.dir/DependInfo.cmake"
+  "CMakeFiles/if_test.dir/DependInfo.cmake"
+  "CMakeFiles/interleaved_test.dir/DependInfo.cmake"
+  "CMakeFiles/logical_test.dir/DependInfo.cmake"
+  "CMakeFiles/mask_test.dir/DependInfo.cmake"
+  "CMakeFiles/mask_mem_test.dir/DependInfo.cmake"
+  "CMakeFiles/memory_test.dir/DependInfo.cmake"
+  "CMakeFiles/mul_test.dir/DependInfo.cmake"
+  "CMakeFiles/reduction_test.dir/DependInfo.cmake"
+  "CMakeFiles/reverse_test.dir/DependInfo.cmake"
+  "CMakeFiles/shift_test.dir/DependInfo.cmake"
+  "CMakeFiles/swizzle_test.dir/DependInfo.cmake"
+  "CMakeFiles/test_util_test.dir/DependInfo.cmake"
+  "CMakeFiles/dot_test.dir/DependInfo.cmake"
+  "CMakeFiles/image_test.dir/DependInfo.cmake"
+  "CMakeFiles/external_sort_test.dir/DependInfo.cmake"
+  "CMakeFiles/sort_test.dir/DependInfo.cmake"
+  "CMakeFiles/thread_pool_test.dir/DependInfo.cmake"
+  )
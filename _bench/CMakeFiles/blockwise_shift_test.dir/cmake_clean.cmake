@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/blockwise_shift_test.dir/hwy/tests/blockwise_shift_test.cc.o"
+  "CMakeFiles/blockwise_shift_test.dir/hwy/tests/blockwise_shift_test.cc.o.d"
+  "blockwise_shift_test[1]_tests.cmake"
+  "tests/blockwise_shift_test"
+  "tests/blockwise_shift_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/blockwise_shift_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
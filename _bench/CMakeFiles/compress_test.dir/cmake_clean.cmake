@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compress_test.dir/hwy/tests/compress_test.cc.o"
+  "CMakeFiles/compress_test.dir/hwy/tests/compress_test.cc.o.d"
+  "compress_test[1]_tests.cmake"
+  "tests/compress_test"
+  "tests/compress_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compress_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
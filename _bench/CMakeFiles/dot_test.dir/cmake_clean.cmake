@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dot_test.dir/hwy/contrib/dot/dot_test.cc.o"
+  "CMakeFiles/dot_test.dir/hwy/contrib/dot/dot_test.cc.o.d"
+  "dot_test[1]_tests.cmake"
+  "tests/dot_test"
+  "tests/dot_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dot_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
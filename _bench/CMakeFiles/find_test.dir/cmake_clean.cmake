@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/find_test.dir/hwy/contrib/algo/find_test.cc.o"
+  "CMakeFiles/find_test.dir/hwy/contrib/algo/find_test.cc.o.d"
+  "find_test[1]_tests.cmake"
+  "tests/find_test"
+  "tests/find_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/find_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
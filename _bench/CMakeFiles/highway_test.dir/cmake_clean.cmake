@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/highway_test.dir/hwy/highway_test.cc.o"
+  "CMakeFiles/highway_test.dir/hwy/highway_test.cc.o.d"
+  "highway_test[1]_tests.cmake"
+  "tests/highway_test"
+  "tests/highway_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/highway_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hwy.dir/hwy/aligned_allocator.cc.o"
+  "CMakeFiles/hwy.dir/hwy/aligned_allocator.cc.o.d"
+  "CMakeFiles/hwy.dir/hwy/nanobenchmark.cc.o"
+  "CMakeFiles/hwy.dir/hwy/nanobenchmark.cc.o.d"
+  "CMakeFiles/hwy.dir/hwy/per_target.cc.o"
+  "CMakeFiles/hwy.dir/hwy/per_target.cc.o.d"
+  "CMakeFiles/hwy.dir/hwy/print.cc.o"
+  "CMakeFiles/hwy.dir/hwy/print.cc.o.d"
+  "CMakeFiles/hwy.dir/hwy/targets.cc.o"
+  "CMakeFiles/hwy.dir/hwy/targets.cc.o.d"
+  "libhwy.a"
+  "libhwy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hwy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
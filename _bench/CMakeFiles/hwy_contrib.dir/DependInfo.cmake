@@ -0,0 +1,50 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/hwy/contrib/image/image.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/image/image.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/image/image.cc.o.d"
+  "/root/repo/hwy/contrib/math/math.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/math/math.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/math/math.cc.o.d"
+  "/root/repo/hwy/contrib/sort/external_sort.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/external_sort.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/external_sort.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_128a.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_128a.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_128a.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_128d.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_128d.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_128d.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_bf16a.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_bf16a.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_bf16a.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_bf16d.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_bf16d.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_bf16d.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_f16a.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_f16a.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_f16a.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_f16d.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_f16d.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_f16d.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_f32a.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_f32a.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_f32a.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_f32d.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_f32d.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_f32d.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_f64a.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_f64a.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_f64a.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_f64d.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_f64d.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_f64d.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_i16a.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_i16a.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_i16a.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_i16d.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_i16d.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_i16d.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_i32a.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_i32a.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_i32a.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_i32d.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_i32d.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_i32d.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_i64a.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_i64a.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_i64a.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_i64d.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_i64d.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_i64d.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_kv128a.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_kv128a.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_kv128a.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_kv128d.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_kv128d.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_kv128d.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_kv64a.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_kv64a.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_kv64a.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_kv64d.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_kv64d.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_kv64d.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_u16a.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_u16a.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_u16a.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_u16d.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_u16d.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_u16d.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_u32a.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_u32a.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_u32a.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_u32d.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_u32d.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_u32d.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_u64a.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_u64a.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_u64a.cc.o.d"
+  "/root/repo/hwy/contrib/sort/vqsort_u64d.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_u64d.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_u64d.cc.o.d"
+  "/root/repo/hwy/contrib/thread_pool/thread_pool.cc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/thread_pool/thread_pool.cc.o" "gcc" "CMakeFiles/hwy_contrib.dir/hwy/contrib/thread_pool/thread_pool.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench/CMakeFiles/hwy.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/if_test.dir/hwy/tests/if_test.cc.o"
+  "CMakeFiles/if_test.dir/hwy/tests/if_test.cc.o.d"
+  "if_test[1]_tests.cmake"
+  "tests/if_test"
+  "tests/if_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/if_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
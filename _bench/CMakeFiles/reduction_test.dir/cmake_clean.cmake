@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/reduction_test.dir/hwy/tests/reduction_test.cc.o"
+  "CMakeFiles/reduction_test.dir/hwy/tests/reduction_test.cc.o.d"
+  "reduction_test[1]_tests.cmake"
+  "tests/reduction_test"
+  "tests/reduction_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reduction_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
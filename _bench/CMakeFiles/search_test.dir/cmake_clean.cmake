@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/search_test.dir/hwy/contrib/algo/search_test.cc.o"
+  "CMakeFiles/search_test.dir/hwy/contrib/algo/search_test.cc.o.d"
+  "search_test[1]_tests.cmake"
+  "tests/search_test"
+  "tests/search_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/search_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/set_ops_test.dir/hwy/contrib/algo/set_ops_test.cc.o"
+  "CMakeFiles/set_ops_test.dir/hwy/contrib/algo/set_ops_test.cc.o.d"
+  "set_ops_test[1]_tests.cmake"
+  "tests/set_ops_test"
+  "tests/set_ops_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/set_ops_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,45 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_bench
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_bench/copy_test[1]_include.cmake")
+include("/root/repo/_bench/find_test[1]_include.cmake")
+include("/root/repo/_bench/transform_test[1]_include.cmake")
+include("/root/repo/_bench/search_test[1]_include.cmake")
+include("/root/repo/_bench/set_ops_test[1]_include.cmake")
+include("/root/repo/_bench/unique_test[1]_include.cmake")
+include("/root/repo/_bench/aligned_allocator_test[1]_include.cmake")
+include("/root/repo/_bench/base_test[1]_include.cmake")
+include("/root/repo/_bench/highway_test[1]_include.cmake")
+include("/root/repo/_bench/nanobenchmark_test[1]_include.cmake")
+include("/root/repo/_bench/targets_test[1]_include.cmake")
+include("/root/repo/_bench/skeleton_test[1]_include.cmake")
+include("/root/repo/_bench/arithmetic_test[1]_include.cmake")
+include("/root/repo/_bench/blockwise_test[1]_include.cmake")
+include("/root/repo/_bench/blockwise_shift_test[1]_include.cmake")
+include("/root/repo/_bench/combine_test[1]_include.cmake")
+include("/root/repo/_bench/compare_test[1]_include.cmake")
+include("/root/repo/_bench/compress_test[1]_include.cmake")
+include("/root/repo/_bench/convert_test[1]_include.cmake")
+include("/root/repo/_bench/crypto_test[1]_include.cmake")
+include("/root/repo/_bench/demote_test[1]_include.cmake")
+include("/root/repo/_bench/float_test[1]_include.cmake")
+include("/root/repo/_bench/if_test[1]_include.cmake")
+include("/root/repo/_bench/interleaved_test[1]_include.cmake")
+include("/root/repo/_bench/logical_test[1]_include.cmake")
+include("/root/repo/_bench/mask_test[1]_include.cmake")
+include("/root/repo/_bench/mask_mem_test[1]_include.cmake")
+include("/root/repo/_bench/memory_test[1]_include.cmake")
+include("/root/repo/_bench/mul_test[1]_include.cmake")
+include("/root/repo/_bench/reduction_test[1]_include.cmake")
+include("/root/repo/_bench/reverse_test[1]_include.cmake")
+include("/root/repo/_bench/shift_test[1]_include.cmake")
+include("/root/repo/_bench/swizzle_test[1]_include.cmake")
+include("/root/repo/_bench/test_util_test[1]_include.cmake")
+include("/root/repo/_bench/dot_test[1]_include.cmake")
+include("/root/repo/_bench/image_test[1]_include.cmake")
+include("/root/repo/_bench/external_sort_test[1]_include.cmake")
+include("/root/repo/_bench/sort_test[1]_include.cmake")
+include("/root/repo/_bench/thread_pool_test[1]_include.cmake")
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_bench/aligned_allocator_test[1]_tests.cmake")
+  include("/root/repo/_bench/aligned_allocator_test[1]_tests.cmake")
+else()
+  add_test(aligned_allocator_test_NOT_BUILT aligned_allocator_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_bench/blockwise_shift_test[1]_tests.cmake")
+  include("/root/repo/_bench/blockwise_shift_test[1]_tests.cmake")
+else()
+  add_test(blockwise_shift_test_NOT_BUILT blockwise_shift_test_NOT_BUILT)
+endif()
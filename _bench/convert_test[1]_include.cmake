@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_bench/convert_test[1]_tests.cmake")
+  include("/root/repo/_bench/convert_test[1]_tests.cmake")
+else()
+  add_test(convert_test_NOT_BUILT convert_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_bench/copy_test[1]_tests.cmake")
+  include("/root/repo/_bench/copy_test[1]_tests.cmake")
+else()
+  add_test(copy_test_NOT_BUILT copy_test_NOT_BUILT)
+endif()
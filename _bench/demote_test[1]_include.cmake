@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_bench/demote_test[1]_tests.cmake")
+  include("/root/repo/_bench/demote_test[1]_tests.cmake")
+else()
+  add_test(demote_test_NOT_BUILT demote_test_NOT_BUILT)
+endif()
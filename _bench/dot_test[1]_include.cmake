@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_bench/dot_test[1]_tests.cmake")
+  include("/root/repo/_bench/dot_test[1]_tests.cmake")
+else()
+  add_test(dot_test_NOT_BUILT dot_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_bench/external_sort_test[1]_tests.cmake")
+  include("/root/repo/_bench/external_sort_test[1]_tests.cmake")
+else()
+  add_test(external_sort_test_NOT_BUILT external_sort_test_NOT_BUILT)
+endif()
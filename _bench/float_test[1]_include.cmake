@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_bench/float_test[1]_tests.cmake")
+  include("/root/repo/_bench/float_test[1]_tests.cmake")
+else()
+  add_test(float_test_NOT_BUILT float_test_NOT_BUILT)
+endif()
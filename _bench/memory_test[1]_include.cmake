@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_bench/memory_test[1]_tests.cmake")
+  include("/root/repo/_bench/memory_test[1]_tests.cmake")
+else()
+  add_test(memory_test_NOT_BUILT memory_test_NOT_BUILT)
+endif()
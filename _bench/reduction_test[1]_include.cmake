@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_bench/reduction_test[1]_tests.cmake")
+  include("/root/repo/_bench/reduction_test[1]_tests.cmake")
+else()
+  add_test(reduction_test_NOT_BUILT reduction_test_NOT_BUILT)
+endif()
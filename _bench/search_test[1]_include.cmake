@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_bench/search_test[1]_tests.cmake")
+  include("/root/repo/_bench/search_test[1]_tests.cmake")
+else()
+  add_test(search_test_NOT_BUILT search_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_bench/skeleton_test[1]_tests.cmake")
+  include("/root/repo/_bench/skeleton_test[1]_tests.cmake")
+else()
+  add_test(skeleton_test_NOT_BUILT skeleton_test_NOT_BUILT)
+endif()
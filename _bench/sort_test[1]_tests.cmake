@@ -0,0 +1,39 @@
+add_test([=[SortTestGroup/SortTest.TestAllMedian/AVX2  # GetParam() = 512]=]  /root/repo/_bench/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllMedian/AVX2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllMedian/AVX2  # GetParam() = 512]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_bench SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllBaseCase/AVX2  # GetParam() = 512]=]  /root/repo/_bench/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllBaseCase/AVX2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllBaseCase/AVX2  # GetParam() = 512]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_bench SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllSortBlock/AVX2  # GetParam() = 512]=]  /root/repo/_bench/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllSortBlock/AVX2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllSortBlock/AVX2  # GetParam() = 512]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_bench SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllPartition/AVX2  # GetParam() = 512]=]  /root/repo/_bench/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllPartition/AVX2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllPartition/AVX2  # GetParam() = 512]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_bench SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllGenerator/AVX2  # GetParam() = 512]=]  /root/repo/_bench/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllGenerator/AVX2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllGenerator/AVX2  # GetParam() = 512]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_bench SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllSort/AVX2  # GetParam() = 512]=]  /root/repo/_bench/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllSort/AVX2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllSort/AVX2  # GetParam() = 512]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_bench SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllPresorted/AVX2  # GetParam() = 512]=]  /root/repo/_bench/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllPresorted/AVX2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllPresorted/AVX2  # GetParam() = 512]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_bench SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllScratch/AVX2  # GetParam() = 512]=]  /root/repo/_bench/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllScratch/AVX2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllScratch/AVX2  # GetParam() = 512]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_bench SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllSortStats/AVX2  # GetParam() = 512]=]  /root/repo/_bench/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllSortStats/AVX2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllSortStats/AVX2  # GetParam() = 512]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_bench SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllRadixSort/AVX2  # GetParam() = 512]=]  /root/repo/_bench/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllRadixSort/AVX2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllRadixSort/AVX2  # GetParam() = 512]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_bench SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllFloat16/AVX2  # GetParam() = 512]=]  /root/repo/_bench/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllFloat16/AVX2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllFloat16/AVX2  # GetParam() = 512]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_bench SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllParallelSort/AVX2  # GetParam() = 512]=]  /root/repo/_bench/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllParallelSort/AVX2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllParallelSort/AVX2  # GetParam() = 512]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_bench SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllSortSegments/AVX2  # GetParam() = 512]=]  /root/repo/_bench/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllSortSegments/AVX2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllSortSegments/AVX2  # GetParam() = 512]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_bench SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllPartialSort/AVX2  # GetParam() = 512]=]  /root/repo/_bench/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllPartialSort/AVX2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllPartialSort/AVX2  # GetParam() = 512]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_bench SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllSelect/AVX2  # GetParam() = 512]=]  /root/repo/_bench/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllSelect/AVX2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllSelect/AVX2  # GetParam() = 512]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_bench SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllArgsort/AVX2  # GetParam() = 512]=]  /root/repo/_bench/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllArgsort/AVX2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllArgsort/AVX2  # GetParam() = 512]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_bench SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllSortRecords/AVX2  # GetParam() = 512]=]  /root/repo/_bench/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllSortRecords/AVX2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllSortRecords/AVX2  # GetParam() = 512]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_bench SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllStableSort/AVX2  # GetParam() = 512]=]  /root/repo/_bench/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllStableSort/AVX2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllStableSort/AVX2  # GetParam() = 512]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_bench SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllMerge/AVX2  # GetParam() = 512]=]  /root/repo/_bench/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllMerge/AVX2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllMerge/AVX2  # GetParam() = 512]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_bench SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  sort_test_TESTS [==[SortTestGroup/SortTest.TestAllMedian/AVX2  # GetParam() = 512]==] [==[SortTestGroup/SortTest.TestAllBaseCase/AVX2  # GetParam() = 512]==] [==[SortTestGroup/SortTest.TestAllSortBlock/AVX2  # GetParam() = 512]==] [==[SortTestGroup/SortTest.TestAllPartition/AVX2  # GetParam() = 512]==] [==[SortTestGroup/SortTest.TestAllGenerator/AVX2  # GetParam() = 512]==] [==[SortTestGroup/SortTest.TestAllSort/AVX2  # GetParam() = 512]==] [==[SortTestGroup/SortTest.TestAllPresorted/AVX2  # GetParam() = 512]==] [==[SortTestGroup/SortTest.TestAllScratch/AVX2  # GetParam() = 512]==] [==[SortTestGroup/SortTest.TestAllSortStats/AVX2  # GetParam() = 512]==] [==[SortTestGroup/SortTest.TestAllRadixSort/AVX2  # GetParam() = 512]==] [==[SortTestGroup/SortTest.TestAllFloat16/AVX2  # GetParam() = 512]==] [==[SortTestGroup/SortTest.TestAllParallelSort/AVX2  # GetParam() = 512]==] [==[SortTestGroup/SortTest.TestAllSortSegments/AVX2  # GetParam() = 512]==] [==[SortTestGroup/SortTest.TestAllPartialSort/AVX2  # GetParam() = 512]==] [==[SortTestGroup/SortTest.TestAllSelect/AVX2  # GetParam() = 512]==] [==[SortTestGroup/SortTest.TestAllArgsort/AVX2  # GetParam() = 512]==] [==[SortTestGroup/SortTest.TestAllSortRecords/AVX2  # GetParam() = 512]==] [==[SortTestGroup/SortTest.TestAllStableSort/AVX2  # GetParam() = 512]==] [==[SortTestGroup/SortTest.TestAllMerge/AVX2  # GetParam() = 512]==])
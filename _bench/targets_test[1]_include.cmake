@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_bench/targets_test[1]_tests.cmake")
+  include("/root/repo/_bench/targets_test[1]_tests.cmake")
+else()
+  add_test(targets_test_NOT_BUILT targets_test_NOT_BUILT)
+endif()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/aligned_allocator_test.dir/hwy/aligned_allocator_test.cc.o"
+  "CMakeFiles/aligned_allocator_test.dir/hwy/aligned_allocator_test.cc.o.d"
+  "aligned_allocator_test[1]_tests.cmake"
+  "tests/aligned_allocator_test"
+  "tests/aligned_allocator_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/aligned_allocator_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/hwy/base_test.cc" "CMakeFiles/base_test.dir/hwy/base_test.cc.o" "gcc" "CMakeFiles/base_test.dir/hwy/base_test.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_quick/CMakeFiles/hwy.dir/DependInfo.cmake"
+  "/root/repo/_quick/CMakeFiles/hwy_test.dir/DependInfo.cmake"
+  "/root/repo/_quick/CMakeFiles/hwy_contrib.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
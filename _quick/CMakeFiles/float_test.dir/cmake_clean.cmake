@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/float_test.dir/hwy/tests/float_test.cc.o"
+  "CMakeFiles/float_test.dir/hwy/tests/float_test.cc.o.d"
+  "float_test[1]_tests.cmake"
+  "tests/float_test"
+  "tests/float_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/float_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hwy_list_targets.dir/hwy/tests/list_targets.cc.o"
+  "CMakeFiles/hwy_list_targets.dir/hwy/tests/list_targets.cc.o.d"
+  "hwy_list_targets"
+  "hwy_list_targets.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hwy_list_targets.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/interleaved_test.dir/hwy/tests/interleaved_test.cc.o"
+  "CMakeFiles/interleaved_test.dir/hwy/tests/interleaved_test.cc.o.d"
+  "interleaved_test[1]_tests.cmake"
+  "tests/interleaved_test"
+  "tests/interleaved_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/interleaved_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
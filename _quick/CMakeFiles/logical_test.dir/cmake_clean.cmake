@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/logical_test.dir/hwy/tests/logical_test.cc.o"
+  "CMakeFiles/logical_test.dir/hwy/tests/logical_test.cc.o.d"
+  "logical_test[1]_tests.cmake"
+  "tests/logical_test"
+  "tests/logical_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logical_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/skeleton_test.dir/hwy/examples/skeleton.cc.o"
+  "CMakeFiles/skeleton_test.dir/hwy/examples/skeleton.cc.o.d"
+  "CMakeFiles/skeleton_test.dir/hwy/examples/skeleton_test.cc.o"
+  "CMakeFiles/skeleton_test.dir/hwy/examples/skeleton_test.cc.o.d"
+  "skeleton_test[1]_tests.cmake"
+  "tests/skeleton_test"
+  "tests/skeleton_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/skeleton_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
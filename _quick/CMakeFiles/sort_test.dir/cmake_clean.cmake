@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sort_test.dir/hwy/contrib/sort/sort_test.cc.o"
+  "CMakeFiles/sort_test.dir/hwy/contrib/sort/sort_test.cc.o.d"
+  "sort_test[1]_tests.cmake"
+  "tests/sort_test"
+  "tests/sort_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sort_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_util_test.dir/hwy/tests/test_util_test.cc.o"
+  "CMakeFiles/test_util_test.dir/hwy/tests/test_util_test.cc.o.d"
+  "test_util_test[1]_tests.cmake"
+  "tests/test_util_test"
+  "tests/test_util_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_util_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,42 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_quick
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_quick/copy_test[1]_include.cmake")
+include("/root/repo/_quick/find_test[1]_include.cmake")
+include("/root/repo/_quick/transform_test[1]_include.cmake")
+include("/root/repo/_quick/aligned_allocator_test[1]_include.cmake")
+include("/root/repo/_quick/base_test[1]_include.cmake")
+include("/root/repo/_quick/highway_test[1]_include.cmake")
+include("/root/repo/_quick/nanobenchmark_test[1]_include.cmake")
+include("/root/repo/_quick/targets_test[1]_include.cmake")
+include("/root/repo/_quick/skeleton_test[1]_include.cmake")
+include("/root/repo/_quick/arithmetic_test[1]_include.cmake")
+include("/root/repo/_quick/blockwise_test[1]_include.cmake")
+include("/root/repo/_quick/blockwise_shift_test[1]_include.cmake")
+include("/root/repo/_quick/combine_test[1]_include.cmake")
+include("/root/repo/_quick/compare_test[1]_include.cmake")
+include("/root/repo/_quick/compress_test[1]_include.cmake")
+include("/root/repo/_quick/convert_test[1]_include.cmake")
+include("/root/repo/_quick/crypto_test[1]_include.cmake")
+include("/root/repo/_quick/demote_test[1]_include.cmake")
+include("/root/repo/_quick/float_test[1]_include.cmake")
+include("/root/repo/_quick/if_test[1]_include.cmake")
+include("/root/repo/_quick/interleaved_test[1]_include.cmake")
+include("/root/repo/_quick/logical_test[1]_include.cmake")
+include("/root/repo/_quick/mask_test[1]_include.cmake")
+include("/root/repo/_quick/mask_mem_test[1]_include.cmake")
+include("/root/repo/_quick/memory_test[1]_include.cmake")
+include("/root/repo/_quick/mul_test[1]_include.cmake")
+include("/root/repo/_quick/reduction_test[1]_include.cmake")
+include("/root/repo/_quick/reverse_test[1]_include.cmake")
+include("/root/repo/_quick/shift_test[1]_include.cmake")
+include("/root/repo/_quick/swizzle_test[1]_include.cmake")
+include("/root/repo/_quick/test_util_test[1]_include.cmake")
+include("/root/repo/_quick/dot_test[1]_include.cmake")
+include("/root/repo/_quick/image_test[1]_include.cmake")
+include("/root/repo/_quick/external_sort_test[1]_include.cmake")
+include("/root/repo/_quick/sort_test[1]_include.cmake")
+include("/root/repo/_quick/thread_pool_test[1]_include.cmake")
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_quick/blockwise_test[1]_tests.cmake")
+  include("/root/repo/_quick/blockwise_test[1]_tests.cmake")
+else()
+  add_test(blockwise_test_NOT_BUILT blockwise_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_quick/crypto_test[1]_tests.cmake")
+  include("/root/repo/_quick/crypto_test[1]_tests.cmake")
+else()
+  add_test(crypto_test_NOT_BUILT crypto_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_quick/if_test[1]_tests.cmake")
+  include("/root/repo/_quick/if_test[1]_tests.cmake")
+else()
+  add_test(if_test_NOT_BUILT if_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_quick/mask_test[1]_tests.cmake")
+  include("/root/repo/_quick/mask_test[1]_tests.cmake")
+else()
+  add_test(mask_test_NOT_BUILT mask_test_NOT_BUILT)
+endif()
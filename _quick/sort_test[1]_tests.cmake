@@ -0,0 +1,23 @@
+add_test([=[SortTestGroup/SortTest.TestAllMedian/SCALAR  # GetParam() = 4611686018427387904]=]  /root/repo/_quick/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllMedian/SCALAR]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllMedian/SCALAR  # GetParam() = 4611686018427387904]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_quick SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllBaseCase/SCALAR  # GetParam() = 4611686018427387904]=]  /root/repo/_quick/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllBaseCase/SCALAR]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllBaseCase/SCALAR  # GetParam() = 4611686018427387904]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_quick SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllPartition/SCALAR  # GetParam() = 4611686018427387904]=]  /root/repo/_quick/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllPartition/SCALAR]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllPartition/SCALAR  # GetParam() = 4611686018427387904]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_quick SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllGenerator/SCALAR  # GetParam() = 4611686018427387904]=]  /root/repo/_quick/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllGenerator/SCALAR]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllGenerator/SCALAR  # GetParam() = 4611686018427387904]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_quick SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllSort/SCALAR  # GetParam() = 4611686018427387904]=]  /root/repo/_quick/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllSort/SCALAR]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllSort/SCALAR  # GetParam() = 4611686018427387904]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_quick SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllParallelSort/SCALAR  # GetParam() = 4611686018427387904]=]  /root/repo/_quick/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllParallelSort/SCALAR]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllParallelSort/SCALAR  # GetParam() = 4611686018427387904]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_quick SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllPartialSort/SCALAR  # GetParam() = 4611686018427387904]=]  /root/repo/_quick/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllPartialSort/SCALAR]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllPartialSort/SCALAR  # GetParam() = 4611686018427387904]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_quick SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllSelect/SCALAR  # GetParam() = 4611686018427387904]=]  /root/repo/_quick/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllSelect/SCALAR]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllSelect/SCALAR  # GetParam() = 4611686018427387904]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_quick SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllArgsort/SCALAR  # GetParam() = 4611686018427387904]=]  /root/repo/_quick/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllArgsort/SCALAR]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllArgsort/SCALAR  # GetParam() = 4611686018427387904]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_quick SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllStableSort/SCALAR  # GetParam() = 4611686018427387904]=]  /root/repo/_quick/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllStableSort/SCALAR]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllStableSort/SCALAR  # GetParam() = 4611686018427387904]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_quick SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllMerge/SCALAR  # GetParam() = 4611686018427387904]=]  /root/repo/_quick/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllMerge/SCALAR]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllMerge/SCALAR  # GetParam() = 4611686018427387904]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_quick SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  sort_test_TESTS [==[SortTestGroup/SortTest.TestAllMedian/SCALAR  # GetParam() = 4611686018427387904]==] [==[SortTestGroup/SortTest.TestAllBaseCase/SCALAR  # GetParam() = 4611686018427387904]==] [==[SortTestGroup/SortTest.TestAllPartition/SCALAR  # GetParam() = 4611686018427387904]==] [==[SortTestGroup/SortTest.TestAllGenerator/SCALAR  # GetParam() = 4611686018427387904]==] [==[SortTestGroup/SortTest.TestAllSort/SCALAR  # GetParam() = 4611686018427387904]==] [==[SortTestGroup/SortTest.TestAllParallelSort/SCALAR  # GetParam() = 4611686018427387904]==] [==[SortTestGroup/SortTest.TestAllPartialSort/SCALAR  # GetParam() = 4611686018427387904]==] [==[SortTestGroup/SortTest.TestAllSelect/SCALAR  # GetParam() = 4611686018427387904]==] [==[SortTestGroup/SortTest.TestAllArgsort/SCALAR  # GetParam() = 4611686018427387904]==] [==[SortTestGroup/SortTest.TestAllStableSort/SCALAR  # GetParam() = 4611686018427387904]==] [==[SortTestGroup/SortTest.TestAllMerge/SCALAR  # GetParam() = 4611686018427387904]==])
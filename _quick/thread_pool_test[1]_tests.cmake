@@ -0,0 +1,13 @@
+add_test([=[ThreadPoolTest.NumThreads]=]  /root/repo/_quick/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.NumThreads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.NumThreads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_quick SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.EmptyRange]=]  /root/repo/_quick/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.EmptyRange]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.EmptyRange]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_quick SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.CoversRange]=]  /root/repo/_quick/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.CoversRange]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.CoversRange]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_quick SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.PerThreadState]=]  /root/repo/_quick/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.PerThreadState]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.PerThreadState]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_quick SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.Imbalanced]=]  /root/repo/_quick/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.Imbalanced]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.Imbalanced]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_quick SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.Reuse]=]  /root/repo/_quick/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.Reuse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.Reuse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_quick SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  thread_pool_test_TESTS ThreadPoolTest.NumThreads ThreadPoolTest.EmptyRange ThreadPoolTest.CoversRange ThreadPoolTest.PerThreadState ThreadPoolTest.Imbalanced ThreadPoolTest.Reuse)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_quick/transform_test[1]_tests.cmake")
+  include("/root/repo/_quick/transform_test[1]_tests.cmake")
+else()
+  add_test(transform_test_NOT_BUILT transform_test_NOT_BUILT)
+endif()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/base_test.dir/hwy/base_test.cc.o"
+  "CMakeFiles/base_test.dir/hwy/base_test.cc.o.d"
+  "base_test[1]_tests.cmake"
+  "tests/base_test"
+  "tests/base_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/base_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/convert_test.dir/hwy/tests/convert_test.cc.o"
+  "CMakeFiles/convert_test.dir/hwy/tests/convert_test.cc.o.d"
+  "convert_test[1]_tests.cmake"
+  "tests/convert_test"
+  "tests/convert_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/convert_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mul_test.dir/hwy/tests/mul_test.cc.o"
+  "CMakeFiles/mul_test.dir/hwy/tests/mul_test.cc.o.d"
+  "mul_test[1]_tests.cmake"
+  "tests/mul_test"
+  "tests/mul_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mul_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nanobenchmark_test.dir/hwy/nanobenchmark_test.cc.o"
+  "CMakeFiles/nanobenchmark_test.dir/hwy/nanobenchmark_test.cc.o.d"
+  "nanobenchmark_test[1]_tests.cmake"
+  "tests/nanobenchmark_test"
+  "tests/nanobenchmark_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nanobenchmark_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/shift_test.dir/hwy/tests/shift_test.cc.o"
+  "CMakeFiles/shift_test.dir/hwy/tests/shift_test.cc.o.d"
+  "shift_test[1]_tests.cmake"
+  "tests/shift_test"
+  "tests/shift_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shift_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unique_test.dir/hwy/contrib/algo/unique_test.cc.o"
+  "CMakeFiles/unique_test.dir/hwy/contrib/algo/unique_test.cc.o.d"
+  "tests/unique_test"
+  "tests/unique_test.pdb"
+  "unique_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unique_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,45 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_scalar
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_scalar/copy_test[1]_include.cmake")
+include("/root/repo/_scalar/find_test[1]_include.cmake")
+include("/root/repo/_scalar/transform_test[1]_include.cmake")
+include("/root/repo/_scalar/search_test[1]_include.cmake")
+include("/root/repo/_scalar/set_ops_test[1]_include.cmake")
+include("/root/repo/_scalar/unique_test[1]_include.cmake")
+include("/root/repo/_scalar/aligned_allocator_test[1]_include.cmake")
+include("/root/repo/_scalar/base_test[1]_include.cmake")
+include("/root/repo/_scalar/highway_test[1]_include.cmake")
+include("/root/repo/_scalar/nanobenchmark_test[1]_include.cmake")
+include("/root/repo/_scalar/targets_test[1]_include.cmake")
+include("/root/repo/_scalar/skeleton_test[1]_include.cmake")
+include("/root/repo/_scalar/arithmetic_test[1]_include.cmake")
+include("/root/repo/_scalar/blockwise_test[1]_include.cmake")
+include("/root/repo/_scalar/blockwise_shift_test[1]_include.cmake")
+include("/root/repo/_scalar/combine_test[1]_include.cmake")
+include("/root/repo/_scalar/compare_test[1]_include.cmake")
+include("/root/repo/_scalar/compress_test[1]_include.cmake")
+include("/root/repo/_scalar/convert_test[1]_include.cmake")
+include("/root/repo/_scalar/crypto_test[1]_include.cmake")
+include("/root/repo/_scalar/demote_test[1]_include.cmake")
+include("/root/repo/_scalar/float_test[1]_include.cmake")
+include("/root/repo/_scalar/if_test[1]_include.cmake")
+include("/root/repo/_scalar/interleaved_test[1]_include.cmake")
+include("/root/repo/_scalar/logical_test[1]_include.cmake")
+include("/root/repo/_scalar/mask_test[1]_include.cmake")
+include("/root/repo/_scalar/mask_mem_test[1]_include.cmake")
+include("/root/repo/_scalar/memory_test[1]_include.cmake")
+include("/root/repo/_scalar/mul_test[1]_include.cmake")
+include("/root/repo/_scalar/reduction_test[1]_include.cmake")
+include("/root/repo/_scalar/reverse_test[1]_include.cmake")
+include("/root/repo/_scalar/shift_test[1]_include.cmake")
+include("/root/repo/_scalar/swizzle_test[1]_include.cmake")
+include("/root/repo/_scalar/test_util_test[1]_include.cmake")
+include("/root/repo/_scalar/dot_test[1]_include.cmake")
+include("/root/repo/_scalar/image_test[1]_include.cmake")
+include("/root/repo/_scalar/external_sort_test[1]_include.cmake")
+include("/root/repo/_scalar/sort_test[1]_include.cmake")
+include("/root/repo/_scalar/thread_pool_test[1]_include.cmake")
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_scalar/arithmetic_test[1]_tests.cmake")
+  include("/root/repo/_scalar/arithmetic_test[1]_tests.cmake")
+else()
+  add_test(arithmetic_test_NOT_BUILT arithmetic_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_scalar/base_test[1]_tests.cmake")
+  include("/root/repo/_scalar/base_test[1]_tests.cmake")
+else()
+  add_test(base_test_NOT_BUILT base_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_scalar/compare_test[1]_tests.cmake")
+  include("/root/repo/_scalar/compare_test[1]_tests.cmake")
+else()
+  add_test(compare_test_NOT_BUILT compare_test_NOT_BUILT)
+endif()
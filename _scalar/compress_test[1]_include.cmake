@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_scalar/compress_test[1]_tests.cmake")
+  include("/root/repo/_scalar/compress_test[1]_tests.cmake")
+else()
+  add_test(compress_test_NOT_BUILT compress_test_NOT_BUILT)
+endif()
@@ -0,0 +1,9 @@
+add_test([=[ExternalSortTest.TestU64]=]  /root/repo/_scalar/tests/external_sort_test [==[--gtest_filter=ExternalSortTest.TestU64]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ExternalSortTest.TestU64]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_scalar SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ExternalSortTest.TestKV]=]  /root/repo/_scalar/tests/external_sort_test [==[--gtest_filter=ExternalSortTest.TestKV]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ExternalSortTest.TestKV]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_scalar SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ExternalSortTest.TestOther]=]  /root/repo/_scalar/tests/external_sort_test [==[--gtest_filter=ExternalSortTest.TestOther]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ExternalSortTest.TestOther]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_scalar SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ExternalSortTest.TestTrailingBytes]=]  /root/repo/_scalar/tests/external_sort_test [==[--gtest_filter=ExternalSortTest.TestTrailingBytes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ExternalSortTest.TestTrailingBytes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_scalar SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  external_sort_test_TESTS ExternalSortTest.TestU64 ExternalSortTest.TestKV ExternalSortTest.TestOther ExternalSortTest.TestTrailingBytes)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_scalar/find_test[1]_tests.cmake")
+  include("/root/repo/_scalar/find_test[1]_tests.cmake")
+else()
+  add_test(find_test_NOT_BUILT find_test_NOT_BUILT)
+endif()
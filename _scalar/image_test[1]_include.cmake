@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_scalar/image_test[1]_tests.cmake")
+  include("/root/repo/_scalar/image_test[1]_tests.cmake")
+else()
+  add_test(image_test_NOT_BUILT image_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_scalar/interleaved_test[1]_tests.cmake")
+  include("/root/repo/_scalar/interleaved_test[1]_tests.cmake")
+else()
+  add_test(interleaved_test_NOT_BUILT interleaved_test_NOT_BUILT)
+endif()
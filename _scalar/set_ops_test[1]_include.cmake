@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_scalar/set_ops_test[1]_tests.cmake")
+  include("/root/repo/_scalar/set_ops_test[1]_tests.cmake")
+else()
+  add_test(set_ops_test_NOT_BUILT set_ops_test_NOT_BUILT)
+endif()
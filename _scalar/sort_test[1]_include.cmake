@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_scalar/sort_test[1]_tests.cmake")
+  include("/root/repo/_scalar/sort_test[1]_tests.cmake")
+else()
+  add_test(sort_test_NOT_BUILT sort_test_NOT_BUILT)
+endif()
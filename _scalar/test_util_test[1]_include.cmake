@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_scalar/test_util_test[1]_tests.cmake")
+  include("/root/repo/_scalar/test_util_test[1]_tests.cmake")
+else()
+  add_test(test_util_test_NOT_BUILT test_util_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_scalar/unique_test[1]_tests.cmake")
+  include("/root/repo/_scalar/unique_test[1]_tests.cmake")
+else()
+  add_test(unique_test_NOT_BUILT unique_test_NOT_BUILT)
+endif()
@@ -0,0 +1,128 @@
+// Copyright 2022 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures batched LowerBound and SearchTreeLowerBound versus std::lower_bound
+// for tables from L1-resident to DRAM-resident sizes.
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "hwy/aligned_allocator.h"
+#include "hwy/nanobenchmark.h"
+
+// clang-format off
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "hwy/contrib/algo/bench_search.cc"
+#include "hwy/foreach_target.h"  // IWYU pragma: keep
+
+#include "hwy/contrib/algo/search-inl.h"
+#include "hwy/tests/test_util-inl.h"
+// clang-format on
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+namespace {
+
+constexpr size_t kReps = 5;
+constexpr size_t kNumQueries = 1 << 20;
+
+// Returns the median of `seconds` after invoking `func` kReps times.
+template <class Func>
+double MedianSeconds(const Func& func) {
+  std::vector<double> seconds(kReps);
+  for (double& sec : seconds) {
+    const double t0 = platform::Now();
+    func();
+    sec = platform::Now() - t0;
+  }
+  std::sort(seconds.begin(), seconds.end());
+  return seconds[kReps / 2];
+}
+
+template <typename T>
+void BenchLowerBound(size_t num) {
+  RandomState rng;
+  // Every other value, so that half of the queries are not found.
+  std::vector<T> keys(num);
+  for (size_t i = 0; i < num; ++i) {
+    keys[i] = static_cast<T>(2 * i);
+  }
+  std::vector<T> queries(kNumQueries);
+  for (T& query : queries) {
+    query = static_cast<T>(Random64(&rng) % (2 * num));
+  }
+
+  auto tree = AllocateAligned<T>(SearchTreeSize<T>(num) + 1);
+  BuildSearchTree(keys.data(), num, tree.get());
+
+  std::vector<size_t> expected(kNumQueries);
+  std::vector<size_t> actual(kNumQueries);
+  const double sec_std = MedianSeconds([&]() {
+    for (size_t q = 0; q < kNumQueries; ++q) {
+      expected[q] = static_cast<size_t>(
+          std::lower_bound(keys.begin(), keys.end(), queries[q]) -
+          keys.begin());
+    }
+  });
+  const double sec_vec = MedianSeconds([&]() {
+    LowerBound(ScalableTag<T>(), keys.data(), num, queries.data(), kNumQueries,
+               actual.data());
+  });
+  HWY_ASSERT(expected == actual);
+  const double sec_tree = MedianSeconds([&]() {
+    SearchTreeLowerBound(tree.get(), keys.data(), num, queries.data(),
+                         kNumQueries, actual.data());
+  });
+  HWY_ASSERT(expected == actual);
+
+  const double mul = 1E9 / kNumQueries;
+  fprintf(stderr,
+          "%s %s %9zu KiB: std %6.2f  LowerBound %6.2f  SearchTree %6.2f "
+          "ns/query\n",
+          hwy::TargetName(HWY_TARGET), TypeName(T(), 1).c_str(),
+          num * sizeof(T) / 1024, sec_std * mul, sec_vec * mul,
+          sec_tree * mul);
+}
+
+}  // namespace
+
+void BenchAllLowerBound() {
+  // Not interested in benchmark results for these targets.
+  if (HWY_TARGET == HWY_SSSE3 || HWY_TARGET == HWY_SSE4) return;
+
+  // 4 KiB (L1) to 256 MiB (DRAM).
+  for (size_t bytes = 4096; bytes <= (size_t{256} << 20); bytes *= 8) {
+    BenchLowerBound<uint32_t>(bytes / sizeof(uint32_t));
+    BenchLowerBound<uint64_t>(bytes / sizeof(uint64_t));
+    BenchLowerBound<float>(bytes / sizeof(float));
+  }
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+
+namespace hwy {
+HWY_BEFORE_TEST(BenchSearch);
+HWY_EXPORT_AND_TEST_P(BenchSearch, BenchAllLowerBound);
+}  // namespace hwy
+
+#endif
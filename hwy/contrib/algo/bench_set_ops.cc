@@ -0,0 +1,132 @@
+// Copyright 2022 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures SetIntersection/SetIntersectionCount versus std::set_intersection
+// for sets of similar and very different sizes.
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "hwy/aligned_allocator.h"
+#include "hwy/nanobenchmark.h"
+
+// clang-format off
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "hwy/contrib/algo/bench_set_ops.cc"
+#include "hwy/foreach_target.h"  // IWYU pragma: keep
+
+#include "hwy/contrib/algo/set_ops-inl.h"
+#include "hwy/tests/test_util-inl.h"
+// clang-format on
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+namespace {
+
+constexpr size_t kReps = 15;
+
+// Returns a strictly ascending set of `count` keys, roughly every
+// `spacing`-th value, so that two such sets share about 1/spacing keys.
+template <typename T>
+std::vector<T> MakeSet(size_t count, uint32_t spacing, RandomState& rng) {
+  std::vector<T> keys(count);
+  T key = 0;
+  for (size_t i = 0; i < count; ++i) {
+    key = static_cast<T>(key + 1 + Random32(&rng) % (2 * spacing - 1));
+    keys[i] = key;
+  }
+  return keys;
+}
+
+// Returns the median of `seconds` after invoking `func` kReps times.
+template <class Func>
+double MedianSeconds(const Func& func) {
+  std::vector<double> seconds(kReps);
+  for (double& sec : seconds) {
+    const double t0 = platform::Now();
+    func();
+    sec = platform::Now() - t0;
+  }
+  std::sort(seconds.begin(), seconds.end());
+  return seconds[kReps / 2];
+}
+
+template <typename T>
+void BenchIntersection(size_t num_a, size_t num_b) {
+  RandomState rng;
+  const std::vector<T> a = MakeSet<T>(num_a, 4, rng);
+  // Same range of values as `a`.
+  const uint32_t spacing_b =
+      static_cast<uint32_t>(HWY_MAX(size_t{4} * num_a / num_b, size_t{1}));
+  const std::vector<T> b = MakeSet<T>(num_b, spacing_b, rng);
+  auto out = AllocateAligned<T>(HWY_MIN(num_a, num_b));
+  const ScalableTag<T> d;
+
+  size_t num_std = 0, num_hwy = 0, num_count = 0;
+  const double sec_std = MedianSeconds([&]() {
+    num_std = static_cast<size_t>(std::set_intersection(a.begin(), a.end(),
+                                                        b.begin(), b.end(),
+                                                        out.get()) -
+                                  out.get());
+  });
+  const double sec_hwy = MedianSeconds([&]() {
+    num_hwy = static_cast<size_t>(
+        SetIntersection(d, a.data(), num_a, b.data(), num_b, out.get()) -
+        out.get());
+  });
+  const double sec_count = MedianSeconds([&]() {
+    num_count = SetIntersectionCount(d, a.data(), num_a, b.data(), num_b);
+  });
+  HWY_ASSERT_EQ(num_std, num_hwy);
+  HWY_ASSERT_EQ(num_std, num_count);
+
+  const double keys = static_cast<double>(num_a + num_b);
+  fprintf(stderr,
+          "%s u%zu %9zu x %9zu (%7zu common): std %6.2f  hwy %6.2f  "
+          "count %6.2f ns/key\n",
+          hwy::TargetName(HWY_TARGET), sizeof(T) * 8, num_a, num_b, num_std,
+          sec_std * 1E9 / keys, sec_hwy * 1E9 / keys, sec_count * 1E9 / keys);
+}
+
+}  // namespace
+
+void BenchAllSetOps() {
+  // Not interested in benchmark results for these targets.
+  if (HWY_TARGET == HWY_SSSE3 || HWY_TARGET == HWY_SSE4) return;
+
+  for (size_t num_a : {size_t{1000}, size_t{1000000}}) {
+    for (size_t ratio : {size_t{1}, size_t{4}, size_t{100}}) {
+      BenchIntersection<uint32_t>(num_a, num_a / ratio);
+      BenchIntersection<uint64_t>(num_a, num_a / ratio);
+    }
+  }
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+
+namespace hwy {
+HWY_BEFORE_TEST(BenchSetOps);
+HWY_EXPORT_AND_TEST_P(BenchSetOps, BenchAllSetOps);
+}  // namespace hwy
+
+#endif
@@ -0,0 +1,260 @@
+// Copyright 2022 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Per-target include guard
+#if defined(HIGHWAY_HWY_CONTRIB_ALGO_SEARCH_INL_H_) == \
+    defined(HWY_TARGET_TOGGLE)
+#ifdef HIGHWAY_HWY_CONTRIB_ALGO_SEARCH_INL_H_
+#undef HIGHWAY_HWY_CONTRIB_ALGO_SEARCH_INL_H_
+#else
+#define HIGHWAY_HWY_CONTRIB_ALGO_SEARCH_INL_H_
+#endif
+
+#include "hwy/cache_control.h"
+#include "hwy/highway.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+
+// These functions answer many lower_bound queries on the same static sorted
+// array of 32- or 64-bit keys. For each query, they write the index of the
+// first key that is not less than the query, or `num` if there is none, as
+// with std::lower_bound. Queries must not be NaN.
+//
+// LowerBound searches the sorted array itself, one query per lane. For large
+// arrays, SearchTreeLowerBound is faster because it only touches one cache
+// line per tree level, but it requires a search tree from BuildSearchTree.
+
+// Writes to `out`[q] the lower_bound of `queries`[q] within the ascending
+// `keys`, for q in [0, num_queries). Each lane performs a branchless binary
+// search, so all lanes require the same number of (gather) steps. For 32-bit
+// keys, `num` must be less than 2^31.
+template <class D, typename T = TFromD<D>>
+void LowerBound(D d, const T* HWY_RESTRICT keys, size_t num,
+                const T* HWY_RESTRICT queries, size_t num_queries,
+                size_t* HWY_RESTRICT out) {
+  if (HWY_UNLIKELY(num == 0)) {
+    for (size_t q = 0; q < num_queries; ++q) {
+      out[q] = 0;
+    }
+    return;
+  }
+
+  const RebindToSigned<D> di;
+  using TI = TFromD<decltype(di)>;
+  using VI = Vec<decltype(di)>;
+  const size_t N = Lanes(d);
+  HWY_ALIGN TI indices[MaxLanes(di)];
+
+  size_t q = 0;
+  for (; q + N <= num_queries; q += N) {
+    const Vec<D> vq = LoadU(d, queries + q);
+    VI base = Zero(di);
+    for (size_t len = num; len > 1;) {
+      const size_t half = len / 2;
+      const VI mid = Add(base, Set(di, static_cast<TI>(half)));
+      const Mask<D> less = Lt(GatherIndex(d, keys, mid), vq);
+      base = IfThenElse(RebindMask(di, less), mid, base);
+      len -= half;
+    }
+    const Mask<D> less = Lt(GatherIndex(d, keys, base), vq);
+    base = Sub(base, VecFromMask(di, RebindMask(di, less)));  // +1 if less
+    Store(base, di, indices);
+    for (size_t i = 0; i < N; ++i) {
+      out[q + i] = static_cast<size_t>(indices[i]);
+    }
+  }
+
+  // Remainder: same algorithm, one query at a time.
+  for (; q < num_queries; ++q) {
+    const T* base = keys;
+    for (size_t len = num; len > 1;) {
+      const size_t half = len / 2;
+      base = (base[half] < queries[q]) ? base + half : base;
+      len -= half;
+    }
+    out[q] = static_cast<size_t>(base - keys) + (*base < queries[q]);
+  }
+}
+
+// ------------------------------ Search tree
+
+// The search tree is a static B+ tree ("S+ tree") whose nodes are a cache line
+// of keys. Its leaves are blocks of SearchTreeNodeKeys consecutive `keys`,
+// hence the tree only stores the inner nodes, about 1/SearchTreeNodeKeys of
+// the size of `keys`. Key j of an inner node is the largest key in its child
+// j, so the number of node keys less than the query is the index of the child
+// that contains the lower_bound. Each node is compared via one (or a few)
+// vector comparisons, independent of the target, so the tree can be built
+// once and searched by any target.
+//
+// Node n of a level has children n * (SearchTreeNodeKeys + 1) + j in the next
+// level, as in an Eytzinger layout. Levels are stored consecutively, starting
+// with the root. Only the last node of each level may have children past the
+// end of `keys`; their separators are HighestValue<T>().
+
+namespace detail {
+
+constexpr size_t kSearchTreeNodeBytes = 64;
+// Enough for 2^64 keys because nodes have at least 9 children.
+constexpr size_t kMaxSearchTreeLevels = 24;
+
+template <typename T>
+constexpr size_t SearchTreeNodeKeys() {
+  return kSearchTreeNodeBytes / sizeof(T);
+}
+
+// Number of inner levels and nodes per level.
+struct SearchTreeShape {
+  size_t height = 0;
+  size_t num_nodes = 0;                      // sum of level_nodes
+  size_t first_node[kMaxSearchTreeLevels];   // index of each level's first node
+  size_t level_nodes[kMaxSearchTreeLevels + 1];  // last entry: leaf blocks
+};
+
+template <typename T>
+SearchTreeShape MakeSearchTreeShape(size_t num) {
+  constexpr size_t kKeys = SearchTreeNodeKeys<T>();
+  SearchTreeShape shape;
+  // Nodes per level, starting with the leaf blocks.
+  size_t reversed[kMaxSearchTreeLevels + 1];
+  reversed[0] = (num + kKeys - 1) / kKeys;
+  while (reversed[shape.height] > 1) {
+    const size_t children = reversed[shape.height];
+    reversed[++shape.height] = (children + kKeys) / (kKeys + 1);
+  }
+  for (size_t level = 0; level <= shape.height; ++level) {
+    shape.level_nodes[level] = reversed[shape.height - level];
+  }
+  for (size_t level = 0; level < shape.height; ++level) {
+    shape.first_node[level] = shape.num_nodes;
+    shape.num_nodes += shape.level_nodes[level];
+  }
+  return shape;
+}
+
+// Returns the number of keys in `node` (or the leaf block) less than `key`.
+template <class DN, typename T = TFromD<DN>>
+HWY_INLINE size_t CountLess(DN dn, const T* HWY_RESTRICT node, Vec<DN> key) {
+  constexpr size_t kKeys = SearchTreeNodeKeys<T>();
+  const size_t N = Lanes(dn);
+  size_t count = 0;
+  for (size_t i = 0; i < kKeys; i += N) {
+    count += CountTrue(dn, Lt(LoadU(dn, node + i), key));
+  }
+  return count;
+}
+
+}  // namespace detail
+
+// Returns the number of T required for the `tree` argument of
+// BuildSearchTree for `num` keys.
+template <typename T>
+size_t SearchTreeSize(size_t num) {
+  return detail::MakeSearchTreeShape<T>(num).num_nodes *
+         detail::SearchTreeNodeKeys<T>();
+}
+
+// Writes the inner nodes of the search tree for the ascending `keys` to
+// `tree`, which must have at least SearchTreeSize<T>(num) elements and
+// should be cache line-aligned, e.g. from AllocateAligned.
+template <typename T>
+void BuildSearchTree(const T* HWY_RESTRICT keys, size_t num,
+                     T* HWY_RESTRICT tree) {
+  constexpr size_t kKeys = detail::SearchTreeNodeKeys<T>();
+  const detail::SearchTreeShape shape = detail::MakeSearchTreeShape<T>(num);
+
+  // Number of keys covered by each child of the root.
+  size_t child_keys = kKeys;
+  for (size_t level = 1; level < shape.height; ++level) {
+    child_keys *= kKeys + 1;
+  }
+
+  for (size_t level = 0; level < shape.height; ++level) {
+    for (size_t n = 0; n < shape.level_nodes[level]; ++n) {
+      T* HWY_RESTRICT node = tree + (shape.first_node[level] + n) * kKeys;
+      for (size_t j = 0; j < kKeys; ++j) {
+        const size_t begin = (n * (kKeys + 1) + j) * child_keys;
+        const size_t end = HWY_MIN(begin + child_keys, num);
+        // Largest key of the child, or padding if it is empty.
+        node[j] = (begin < num) ? keys[end - 1] : HighestValue<T>();
+      }
+    }
+    child_keys /= kKeys + 1;
+  }
+}
+
+// Writes to `out`[q] the lower_bound of `queries`[q] within the ascending
+// `keys`, for q in [0, num_queries), using the `tree` from BuildSearchTree
+// for the same `keys` and `num`. Queries are processed in small batches in
+// lockstep, prefetching the next node of each query before descending the
+// others, so that cache misses of different queries overlap.
+template <typename T>
+void SearchTreeLowerBound(const T* HWY_RESTRICT tree,
+                          const T* HWY_RESTRICT keys, size_t num,
+                          const T* HWY_RESTRICT queries, size_t num_queries,
+                          size_t* HWY_RESTRICT out) {
+  constexpr size_t kKeys = detail::SearchTreeNodeKeys<T>();
+  constexpr size_t kBatch = 16;
+  const CappedTag<T, kKeys> dn;
+  const detail::SearchTreeShape shape = detail::MakeSearchTreeShape<T>(num);
+
+  size_t nodes[kBatch];  // index within the current level
+  for (size_t q0 = 0; q0 < num_queries; q0 += kBatch) {
+    const size_t batch = HWY_MIN(kBatch, num_queries - q0);
+    for (size_t b = 0; b < batch; ++b) {
+      nodes[b] = 0;
+    }
+
+    for (size_t level = 0; level < shape.height; ++level) {
+      const T* HWY_RESTRICT level_tree = tree + shape.first_node[level] * kKeys;
+      // The last node may have children past the end, which we redirect to
+      // the last child because the lower_bound is then `num` either way.
+      const size_t last_child = shape.level_nodes[level + 1] - 1;
+      const bool is_last = level + 1 == shape.height;
+      const T* HWY_RESTRICT next_level =
+          is_last ? keys : tree + shape.first_node[level + 1] * kKeys;
+      for (size_t b = 0; b < batch; ++b) {
+        const size_t child = detail::CountLess(dn, level_tree + nodes[b] * kKeys,
+                                               Set(dn, queries[q0 + b]));
+        nodes[b] = HWY_MIN(nodes[b] * (kKeys + 1) + child, last_child);
+        Prefetch(next_level + nodes[b] * kKeys);
+      }
+    }
+
+    for (size_t b = 0; b < batch; ++b) {
+      const size_t begin = nodes[b] * kKeys;
+      const T query = queries[q0 + b];
+      size_t lower_bound;
+      if (begin + kKeys <= num) {
+        lower_bound = begin + detail::CountLess(dn, keys + begin,
+                                                Set(dn, query));
+      } else {
+        // Partial (or empty) last block.
+        lower_bound = begin;
+        while (lower_bound < num && keys[lower_bound] < query) ++lower_bound;
+      }
+      out[q0 + b] = lower_bound;
+    }
+  }
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#endif  // HIGHWAY_HWY_CONTRIB_ALGO_SEARCH_INL_H_
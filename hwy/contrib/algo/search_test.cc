@@ -0,0 +1,132 @@
+// Copyright 2022 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>  // std::lower_bound
+#include <vector>
+
+#include "hwy/aligned_allocator.h"
+
+// clang-format off
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "hwy/contrib/algo/search_test.cc"
+#include "hwy/foreach_target.h"  // IWYU pragma: keep
+
+#include "hwy/contrib/algo/search-inl.h"
+#include "hwy/tests/test_util-inl.h"
+// clang-format on
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+
+// Ascending keys with some duplicates, starting at 10.
+template <typename T>
+std::vector<T> SortedKeys(size_t num, RandomState& rng) {
+  std::vector<T> keys(num);
+  uint32_t key = 10;
+  for (size_t i = 0; i < num; ++i) {
+    key += Random32(&rng) % 4;  // 0 = duplicate
+    keys[i] = static_cast<T>(key);
+  }
+  return keys;
+}
+
+// Queries: each key and its neighbors, plus values outside the range.
+template <typename T>
+std::vector<T> Queries(const std::vector<T>& keys) {
+  std::vector<T> queries = {T{0}, T{9}, T{10}, HighestValue<T>()};
+  for (const T key : keys) {
+    queries.push_back(static_cast<T>(key - 1));
+    queries.push_back(key);
+    queries.push_back(static_cast<T>(key + 1));
+  }
+  return queries;
+}
+
+template <typename T>
+void VerifyLowerBound(const std::vector<T>& keys, const std::vector<T>& queries,
+                      const std::vector<size_t>& actual) {
+  for (size_t q = 0; q < queries.size(); ++q) {
+    const size_t expected = static_cast<size_t>(
+        std::lower_bound(keys.begin(), keys.end(), queries[q]) - keys.begin());
+    if (expected != actual[q]) {
+      HWY_ABORT("%s: num %zu query %zu: expected %zu, got %zu\n",
+                hwy::TargetName(HWY_TARGET), keys.size(), q, expected,
+                actual[q]);
+    }
+  }
+}
+
+struct TestLowerBound {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) {
+    RandomState rng;
+    const size_t N = Lanes(d);
+    for (size_t num = 0; num < 4 * N + 3; ++num) {
+      const std::vector<T> keys = SortedKeys<T>(num, rng);
+      const std::vector<T> queries = Queries(keys);
+      std::vector<size_t> actual(queries.size());
+      LowerBound(d, keys.data(), num, queries.data(), queries.size(),
+                 actual.data());
+      VerifyLowerBound(keys, queries, actual);
+    }
+  }
+};
+
+void TestAllLowerBound() {
+  ForUIF3264(ForPartialVectors<TestLowerBound>());
+}
+
+struct TestSearchTree {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D /*d*/) {
+    RandomState rng;
+    // Includes partial blocks and trees of up to three levels.
+    for (size_t num : {0u, 1u, 7u, 8u, 9u, 16u, 17u, 63u, 100u, 1000u, 4700u,
+                       50000u}) {
+      const std::vector<T> keys = SortedKeys<T>(num, rng);
+      const std::vector<T> queries = Queries(keys);
+      std::vector<size_t> actual(queries.size());
+
+      const size_t tree_size = SearchTreeSize<T>(num);
+      // At most 1/8 overhead plus a partial node for each of <= 4 levels.
+      HWY_ASSERT(tree_size <= num / 7 + 4 * 64 / sizeof(T));
+      AlignedFreeUniquePtr<T[]> tree = AllocateAligned<T>(tree_size + 1);
+      BuildSearchTree(keys.data(), num, tree.get());
+      SearchTreeLowerBound(tree.get(), keys.data(), num, queries.data(),
+                           queries.size(), actual.data());
+      VerifyLowerBound(keys, queries, actual);
+    }
+  }
+};
+
+void TestAllSearchTree() {
+  ForUIF3264(ForGEVectors<128, TestSearchTree>());
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+
+namespace hwy {
+HWY_BEFORE_TEST(SearchTest);
+HWY_EXPORT_AND_TEST_P(SearchTest, TestAllLowerBound);
+HWY_EXPORT_AND_TEST_P(SearchTest, TestAllSearchTree);
+}  // namespace hwy
+
+#endif
@@ -0,0 +1,355 @@
+// Copyright 2022 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Per-target include guard
+#if defined(HIGHWAY_HWY_CONTRIB_ALGO_SET_OPS_INL_H_) == \
+    defined(HWY_TARGET_TOGGLE)
+#ifdef HIGHWAY_HWY_CONTRIB_ALGO_SET_OPS_INL_H_
+#undef HIGHWAY_HWY_CONTRIB_ALGO_SET_OPS_INL_H_
+#else
+#define HIGHWAY_HWY_CONTRIB_ALGO_SET_OPS_INL_H_
+#endif
+
+#include "hwy/contrib/algo/copy-inl.h"
+#include "hwy/highway.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+
+// These functions compute the intersection, union or difference of two sets,
+// each given as a strictly ascending array (e.g. the output of vqsort followed
+// by Unique), like std::set_intersection etc. The output is also strictly
+// ascending and must not overlap the inputs.
+//
+// If both sets have similar sizes, a vector of `a` is compared with all keys
+// of a vector of `b`, and the matching (or non-matching) keys of `a` are
+// appended via CompressBlendedStore. If one set is much smaller, we instead
+// gallop (exponential search) through the larger one, which is logarithmic
+// rather than linear in its size.
+//
+// NOTE: this is only supported for 16-, 32- or 64-bit types. Float keys must
+// not be NaN, and -0.0 and +0.0 are considered equal.
+
+namespace detail {
+
+// Galloping is faster than block comparisons if one set is at least this many
+// times larger than the other.
+constexpr size_t kGallopRatio = 32;
+
+// Returns the first index in [idx, num) whose key is not less than `key`, or
+// `num` if there is none. The first vector is checked via a single comparison,
+// then we search exponentially, so the cost is logarithmic in the distance
+// from `idx` rather than in `num`.
+template <class D, typename T = TFromD<D>>
+HWY_INLINE size_t Gallop(D d, const T* HWY_RESTRICT keys, size_t idx,
+                         size_t num, T key) {
+  const size_t N = Lanes(d);
+  // Keys [idx, lo) are less than `key`; key `hi` is not, or is past the end.
+  size_t lo = idx;
+  if (idx + N <= num) {
+    const size_t num_less =
+        CountTrue(d, Lt(LoadU(d, keys + idx), Set(d, key)));
+    if (num_less != N) return idx + num_less;
+    lo = idx + N;
+  }
+
+  size_t hi = lo;
+  size_t step = N;
+  while (hi < num && keys[hi] < key) {
+    lo = hi + 1;
+    hi += step;
+    step *= 2;
+  }
+  hi = HWY_MIN(hi, num);
+  while (lo < hi) {
+    const size_t mid = lo + (hi - lo) / 2;
+    if (keys[mid] < key) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+// Appends `from`[0, `count`) to `to` and returns the new end. Short runs are
+// common when merging interleaved sets, so they avoid the Copy overhead.
+template <class D, typename T = TFromD<D>>
+HWY_INLINE T* AppendRun(D d, const T* HWY_RESTRICT from, size_t count,
+                        T* HWY_RESTRICT to) {
+  if (count < Lanes(d)) {
+    for (size_t i = 0; i < count; ++i) {
+      to[i] = from[i];
+    }
+  } else {
+    Copy(d, from, count, to);
+  }
+  return to + count;
+}
+
+// Appends the keys of `va` that are in the other set.
+template <class D, typename T = TFromD<D>>
+struct AppendFound {
+  HWY_INLINE void operator()(D d, Vec<D> va, Mask<D> found, Mask<D> valid) {
+    out += CompressBlendedStore(va, And(found, valid), d, out);
+  }
+  T* out;
+};
+
+// Appends the keys of `va` that are not in the other set.
+template <class D, typename T = TFromD<D>>
+struct AppendNotFound {
+  HWY_INLINE void operator()(D d, Vec<D> va, Mask<D> found, Mask<D> valid) {
+    out += CompressBlendedStore(va, AndNot(found, valid), d, out);
+  }
+  T* out;
+};
+
+// Counts the keys of `va` that are in the other set.
+template <class D>
+struct CountFound {
+  HWY_INLINE void operator()(D d, Vec<D> /*va*/, Mask<D> found,
+                             Mask<D> valid) {
+    count += CountTrue(d, And(found, valid));
+  }
+  size_t count;
+};
+
+// Consumes whole vectors of `a` and `b` while both have at least N keys left,
+// and advances `i` and `j` accordingly. For each vector of `a`, calls
+// `emit(d, va, found, valid)`, where `found` indicates which keys of `va` are
+// also in `b`, and only the `valid` lanes are consumed; the others will be
+// passed again.
+template <class D, class Emit, typename T = TFromD<D>>
+HWY_INLINE void BlockCompare(D d, const T* HWY_RESTRICT a, size_t num_a,
+                             const T* HWY_RESTRICT b, size_t num_b, size_t& i,
+                             size_t& j, Emit& emit) {
+  const size_t N = Lanes(d);
+  // Single keys are faster to merge via the caller's scalar loop.
+  if (N == 1) return;
+  // Invariant: the matching key (if any) of each unconsumed key of `a` is at
+  // or after `j`, and vice versa.
+  while (i + N <= num_a && j + N <= num_b) {
+    const Vec<D> va = LoadU(d, a + i);
+    const Vec<D> vb = LoadU(d, b + j);
+    const T max_a = a[i + N - 1];
+    const T max_b = b[j + N - 1];
+
+    Mask<D> found = Eq(va, Set(d, b[j]));
+    for (size_t k = 1; k < N; ++k) {
+      found = Or(found, Eq(va, Set(d, b[j + k])));
+    }
+
+    if (max_a <= max_b) {
+      // All of `va` is at most `max_b`, so their matches are within `vb`.
+      // Keys of `vb` up to `max_a` can only match keys already consumed.
+      emit(d, va, found, FirstN(d, N));
+      i += N;
+      j += CountTrue(d, Not(Gt(vb, Set(d, max_a))));
+    } else {
+      // Only the keys of `va` up to `max_b` are known to be (not) in `vb`.
+      const Mask<D> done = Not(Gt(va, Set(d, max_b)));
+      emit(d, va, found, done);
+      i += CountTrue(d, done);
+      j += N;
+    }
+  }
+}
+
+}  // namespace detail
+
+// Appends the keys that are in both `a` and `b` to `out`. Returns the
+// STL-style end of the newly written elements in `out`.
+template <class D, typename T = TFromD<D>>
+T* SetIntersection(D d, const T* HWY_RESTRICT a, size_t num_a,
+                   const T* HWY_RESTRICT b, size_t num_b, T* HWY_RESTRICT out) {
+  // Gallop through the larger set.
+  if (num_a > detail::kGallopRatio * num_b ||
+      num_b > detail::kGallopRatio * num_a) {
+    const T* few = a;
+    const T* many = b;
+    size_t num_few = num_a;
+    size_t num_many = num_b;
+    if (num_a > num_b) {
+      few = b;
+      many = a;
+      num_few = num_b;
+      num_many = num_a;
+    }
+    size_t j = 0;
+    for (size_t i = 0; i < num_few; ++i) {
+      j = detail::Gallop(d, many, j, num_many, few[i]);
+      if (j == num_many) break;
+      if (many[j] == few[i]) *out++ = few[i];
+    }
+    return out;
+  }
+
+  size_t i = 0;
+  size_t j = 0;
+  detail::AppendFound<D> emit = {out};
+  detail::BlockCompare(d, a, num_a, b, num_b, i, j, emit);
+  out = emit.out;
+
+  // Remainder: scalar merge.
+  while (i < num_a && j < num_b) {
+    if (a[i] < b[j]) {
+      ++i;
+    } else if (b[j] < a[i]) {
+      ++j;
+    } else {
+      *out++ = a[i];
+      ++i;
+      ++j;
+    }
+  }
+  return out;
+}
+
+// Returns the number of keys SetIntersection would write.
+template <class D, typename T = TFromD<D>>
+size_t SetIntersectionCount(D d, const T* HWY_RESTRICT a, size_t num_a,
+                            const T* HWY_RESTRICT b, size_t num_b) {
+  if (num_a > detail::kGallopRatio * num_b ||
+      num_b > detail::kGallopRatio * num_a) {
+    const T* few = a;
+    const T* many = b;
+    size_t num_few = num_a;
+    size_t num_many = num_b;
+    if (num_a > num_b) {
+      few = b;
+      many = a;
+      num_few = num_b;
+      num_many = num_a;
+    }
+    size_t count = 0;
+    size_t j = 0;
+    for (size_t i = 0; i < num_few; ++i) {
+      j = detail::Gallop(d, many, j, num_many, few[i]);
+      if (j == num_many) break;
+      count += (many[j] == few[i]);
+    }
+    return count;
+  }
+
+  size_t i = 0;
+  size_t j = 0;
+  detail::CountFound<D> emit = {0};
+  detail::BlockCompare(d, a, num_a, b, num_b, i, j, emit);
+  size_t count = emit.count;
+
+  while (i < num_a && j < num_b) {
+    if (a[i] < b[j]) {
+      ++i;
+    } else if (b[j] < a[i]) {
+      ++j;
+    } else {
+      ++count;
+      ++i;
+      ++j;
+    }
+  }
+  return count;
+}
+
+// Appends the keys that are in `a` or `b` (or both) to `out`. Returns the
+// STL-style end of the newly written elements in `out`.
+template <class D, typename T = TFromD<D>>
+T* SetUnion(D d, const T* HWY_RESTRICT a, size_t num_a,
+            const T* HWY_RESTRICT b, size_t num_b, T* HWY_RESTRICT out) {
+  // Alternately copy the run of `a` before the next key of `b`, and vice
+  // versa. For sets of similar size, the runs are short and Gallop only
+  // requires a single vector comparison.
+  size_t i = 0;
+  size_t j = 0;
+  while (i < num_a && j < num_b) {
+    size_t end = detail::Gallop(d, a, i, num_a, b[j]);
+    out = detail::AppendRun(d, a + i, end - i, out);
+    i = end;
+    if (i == num_a) break;
+
+    // Now a[i] >= b[j].
+    end = detail::Gallop(d, b, j, num_b, a[i]);
+    out = detail::AppendRun(d, b + j, end - j, out);
+    j = end;
+    if (j == num_b) break;
+
+    // Now b[j] >= a[i]; emit equal keys only once.
+    if (a[i] == b[j]) {
+      *out++ = a[i];
+      ++i;
+      ++j;
+    }
+  }
+
+  // At most one of these is non-empty.
+  out = detail::AppendRun(d, a + i, num_a - i, out);
+  return detail::AppendRun(d, b + j, num_b - j, out);
+}
+
+// Appends the keys that are in `a` but not in `b` to `out`. Returns the
+// STL-style end of the newly written elements in `out`.
+template <class D, typename T = TFromD<D>>
+T* SetDifference(D d, const T* HWY_RESTRICT a, size_t num_a,
+                 const T* HWY_RESTRICT b, size_t num_b, T* HWY_RESTRICT out) {
+  size_t i = 0;
+  size_t j = 0;
+  if (num_a > detail::kGallopRatio * num_b) {
+    // Few keys to remove: copy the runs of `a` between them.
+    for (; j < num_b; ++j) {
+      const size_t end = detail::Gallop(d, a, i, num_a, b[j]);
+      out = detail::AppendRun(d, a + i, end - i, out);
+      i = end;
+      if (i == num_a) break;
+      i += (a[i] == b[j]);
+    }
+    return detail::AppendRun(d, a + i, num_a - i, out);
+  }
+
+  if (num_b > detail::kGallopRatio * num_a) {
+    // Few keys to check: gallop through `b`.
+    for (; i < num_a; ++i) {
+      j = detail::Gallop(d, b, j, num_b, a[i]);
+      if (j == num_b) break;
+      if (b[j] != a[i]) *out++ = a[i];
+    }
+    return detail::AppendRun(d, a + i, num_a - i, out);
+  }
+
+  detail::AppendNotFound<D> emit = {out};
+  detail::BlockCompare(d, a, num_a, b, num_b, i, j, emit);
+  out = emit.out;
+
+  while (i < num_a && j < num_b) {
+    if (a[i] < b[j]) {
+      *out++ = a[i];
+      ++i;
+    } else if (b[j] < a[i]) {
+      ++j;
+    } else {
+      ++i;
+      ++j;
+    }
+  }
+  return detail::AppendRun(d, a + i, num_a - i, out);
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#endif  // HIGHWAY_HWY_CONTRIB_ALGO_SET_OPS_INL_H_
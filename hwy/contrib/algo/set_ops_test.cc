@@ -0,0 +1,149 @@
+// Copyright 2022 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>  // std::set_intersection etc.
+#include <iterator>   // std::back_inserter
+#include <vector>
+
+#include "hwy/aligned_allocator.h"
+
+// clang-format off
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "hwy/contrib/algo/set_ops_test.cc"
+#include "hwy/foreach_target.h"  // IWYU pragma: keep
+
+#include "hwy/contrib/algo/set_ops-inl.h"
+#include "hwy/tests/test_util-inl.h"
+// clang-format on
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+
+// Returns a strictly ascending set of up to `count` keys below `max_key`.
+template <typename T>
+std::vector<T> RandomSet(size_t count, uint32_t max_key, RandomState& rng) {
+  std::vector<T> keys(count);
+  for (size_t i = 0; i < count; ++i) {
+    keys[i] = static_cast<T>(Random32(&rng) % max_key);
+  }
+  std::sort(keys.begin(), keys.end());
+  keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+  return keys;
+}
+
+template <typename T>
+void AssertSetEqual(const std::vector<T>& expected, const T* actual,
+                    const T* actual_end, int line) {
+  const char* target_name = hwy::TargetName(HWY_TARGET);
+  HWY_ASSERT_EQ(expected.size(), static_cast<size_t>(actual_end - actual));
+  hwy::detail::AssertArrayEqual(hwy::detail::MakeTypeInfo<T>(),
+                                expected.data(), actual, expected.size(),
+                                target_name, __FILE__, line);
+}
+
+struct TestSetOps {
+  template <class D, typename T = TFromD<D>>
+  void operator()(D d, const std::vector<T>& a, const std::vector<T>& b) {
+    std::vector<T> expected;
+    // Sentinel after the expected end verifies we do not write past it.
+    AlignedFreeUniquePtr<T[]> out = AllocateAligned<T>(a.size() + b.size() + 1);
+    const T kSentinel = static_cast<T>(0x55);
+
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(),
+                          std::back_inserter(expected));
+    HWY_ASSERT_EQ(expected.size(), SetIntersectionCount(d, a.data(), a.size(),
+                                                        b.data(), b.size()));
+    out[expected.size()] = kSentinel;
+    T* end = SetIntersection(d, a.data(), a.size(), b.data(), b.size(),
+                             out.get());
+    AssertSetEqual(expected, out.get(), end, __LINE__);
+    HWY_ASSERT_EQ(kSentinel, out[expected.size()]);
+
+    expected.clear();
+    std::set_union(a.begin(), a.end(), b.begin(), b.end(),
+                   std::back_inserter(expected));
+    out[expected.size()] = kSentinel;
+    end = SetUnion(d, a.data(), a.size(), b.data(), b.size(), out.get());
+    AssertSetEqual(expected, out.get(), end, __LINE__);
+    HWY_ASSERT_EQ(kSentinel, out[expected.size()]);
+
+    expected.clear();
+    std::set_difference(a.begin(), a.end(), b.begin(), b.end(),
+                        std::back_inserter(expected));
+    out[expected.size()] = kSentinel;
+    end = SetDifference(d, a.data(), a.size(), b.data(), b.size(), out.get());
+    AssertSetEqual(expected, out.get(), end, __LINE__);
+    HWY_ASSERT_EQ(kSentinel, out[expected.size()]);
+  }
+};
+
+// Invokes Test with sets of similar and very different sizes, and of varying
+// density (hence fraction of common keys).
+template <class Test>
+struct ForeachSizes {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) const {
+    RandomState rng;
+    const size_t N = Lanes(d);
+    for (size_t num_a = 0; num_a < 3 * N + 2; ++num_a) {
+      for (size_t num_b : {size_t{0}, num_a, 2 * num_a + 1, 5 * N + 3}) {
+        for (uint32_t density : {2u, 8u}) {
+          const uint32_t max_key = static_cast<uint32_t>(
+              HWY_MAX(num_a + num_b, size_t{1}) * density / 2 + 1);
+          const std::vector<T> a = RandomSet<T>(num_a, max_key, rng);
+          const std::vector<T> b = RandomSet<T>(num_b, max_key, rng);
+          Test()(d, a, b);
+          Test()(d, b, a);
+        }
+      }
+    }
+
+    // Skewed sizes, which use Gallop.
+    for (size_t num_few : {size_t{1}, size_t{3}, N + 1}) {
+      const size_t num_many = (detail::kGallopRatio + 1) * num_few + 2 * N;
+      for (uint32_t max_key : {static_cast<uint32_t>(num_many * 2),
+                               static_cast<uint32_t>(num_many * 50)}) {
+        const std::vector<T> few = RandomSet<T>(num_few, max_key, rng);
+        // Also ensure keys shared with `few` exist.
+        std::vector<T> many = RandomSet<T>(num_many, max_key, rng);
+        many.insert(many.end(), few.begin(), few.end());
+        std::sort(many.begin(), many.end());
+        many.erase(std::unique(many.begin(), many.end()), many.end());
+        Test()(d, few, many);
+        Test()(d, many, few);
+      }
+    }
+  }
+};
+
+void TestAllSetOps() {
+  ForUI3264(ForPartialVectors<ForeachSizes<TestSetOps>>());
+  ForUI16(ForPartialVectors<ForeachSizes<TestSetOps>>());
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+
+namespace hwy {
+HWY_BEFORE_TEST(SetOpsTest);
+HWY_EXPORT_AND_TEST_P(SetOpsTest, TestAllSetOps);
+}  // namespace hwy
+
+#endif
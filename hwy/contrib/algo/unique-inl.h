@@ -0,0 +1,205 @@
+// Copyright 2022 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Per-target include guard
+#if defined(HIGHWAY_HWY_CONTRIB_ALGO_UNIQUE_INL_H_) == \
+    defined(HWY_TARGET_TOGGLE)
+#ifdef HIGHWAY_HWY_CONTRIB_ALGO_UNIQUE_INL_H_
+#undef HIGHWAY_HWY_CONTRIB_ALGO_UNIQUE_INL_H_
+#else
+#define HIGHWAY_HWY_CONTRIB_ALGO_UNIQUE_INL_H_
+#endif
+
+#include "hwy/highway.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+
+// These functions remove consecutive duplicates, typically from sorted arrays
+// (e.g. the output of vqsort), like std::unique. Each vector is compared with
+// the same vector loaded one key earlier; keys that differ from their
+// predecessor are appended via CompressBlendedStore as in CopyIf.
+//
+// `to` may equal `from` (in-place), because keys are only written to positions
+// at or before the ones they were loaded from. Otherwise, the ranges must not
+// overlap. As with operator==, +0.0 and -0.0 are duplicates and NaN is never a
+// duplicate. For float16_t and bfloat16_t keys, pass their uint16_t bits; then
+// only identical bits are duplicates.
+//
+// NOTE: this is only supported for 16-, 32- or 64-bit types.
+
+namespace detail {
+
+// Returns the mask of lanes in `v` = `from[idx, idx + N)` that differ from
+// their predecessor, for idx >= 1.
+template <class D, typename T = TFromD<D>>
+HWY_INLINE Mask<D> DiffersFromPrevious(D d, const T* HWY_RESTRICT from,
+                                       size_t idx, Vec<D> v) {
+  return Ne(v, LoadU(d, from + idx - 1));
+}
+
+}  // namespace detail
+
+// Appends `from[0]` and each `from[idx]` that differs from `from[idx - 1]`,
+// for idx in [1, count), to `to`. Returns the STL-style end of the newly
+// written elements in `to`.
+template <class D, typename T = TFromD<D>>
+T* Unique(D d, const T* from, size_t count, T* to) {
+  if (HWY_UNLIKELY(count == 0)) return to;
+  const size_t N = Lanes(d);
+
+  *to++ = from[0];
+  size_t idx = 1;
+  for (; idx + N <= count; idx += N) {
+    const Vec<D> v = LoadU(d, from + idx);
+    to += CompressBlendedStore(v, detail::DiffersFromPrevious(d, from, idx, v),
+                               d, to);
+  }
+
+  // `count - 1` was a multiple of the vector length `N`: already done.
+  if (HWY_UNLIKELY(idx == count)) return to;
+
+  if (count > N) {
+    // Start index of the last unaligned whole vector, ending at the array end.
+    // It is at least 1, so its predecessors are also valid.
+    const size_t last = count - N;
+    // Number of elements already seen.
+    const size_t invalid = idx - last;
+    HWY_DASSERT(0 != invalid && invalid < N);
+    const Vec<D> v = LoadU(d, from + last);
+    const Mask<D> mask = AndNot(FirstN(d, invalid),
+                                detail::DiffersFromPrevious(d, from, last, v));
+    to += CompressBlendedStore(v, mask, d, to);
+    return to;
+  }
+
+  // Fewer than N + 1 elements: proceed one by one.
+  const CappedTag<T, 1> d1;
+  for (; idx < count; ++idx) {
+    const Vec<decltype(d1)> v = LoadU(d1, from + idx);
+    if (CountTrue(d1, detail::DiffersFromPrevious(d1, from, idx, v)) == 0) {
+      continue;
+    }
+    StoreU(v, d1, to);
+    to += 1;
+  }
+  return to;
+}
+
+// Returns the number of elements Unique would write, i.e. the number of
+// distinct keys if `keys` are sorted.
+template <class D, typename T = TFromD<D>>
+size_t UniqueCount(D d, const T* HWY_RESTRICT keys, size_t count) {
+  if (HWY_UNLIKELY(count == 0)) return 0;
+  const size_t N = Lanes(d);
+
+  size_t num_unique = 1;
+  size_t idx = 1;
+  for (; idx + N <= count; idx += N) {
+    const Vec<D> v = LoadU(d, keys + idx);
+    num_unique += CountTrue(d, detail::DiffersFromPrevious(d, keys, idx, v));
+  }
+
+  if (HWY_UNLIKELY(idx == count)) return num_unique;
+
+  if (count > N) {
+    const size_t last = count - N;
+    const size_t invalid = idx - last;
+    const Vec<D> v = LoadU(d, keys + last);
+    num_unique += CountTrue(
+        d, AndNot(FirstN(d, invalid),
+                  detail::DiffersFromPrevious(d, keys, last, v)));
+    return num_unique;
+  }
+
+  for (; idx < count; ++idx) {
+    num_unique += (keys[idx] != keys[idx - 1]);
+  }
+  return num_unique;
+}
+
+// Same as Unique, for `count` 128-bit keys, each stored as two consecutive u64
+// (e.g. uint128_t or K64V64), which are duplicates if both halves are equal.
+// `d64` is a u64 tag with at least two lanes.
+template <class D64>
+uint64_t* Unique128(D64 d64, const uint64_t* from, size_t count,
+                    uint64_t* to) {
+  if (HWY_UNLIKELY(count == 0)) return to;
+  to[0] = from[0];
+  to[1] = from[1];
+  to += 2;
+  size_t idx = 1;  // in units of keys
+
+#if HWY_TARGET != HWY_SCALAR
+  const size_t N = Lanes(d64);
+  HWY_DASSERT(N >= 2);
+  const size_t keys_per_vec = N / 2;
+  for (; idx + keys_per_vec <= count; idx += keys_per_vec) {
+    const Vec<D64> v = LoadU(d64, from + 2 * idx);
+    const Vec<D64> prev = LoadU(d64, from + 2 * idx - 2);
+    to += CompressBlendedStore(v, Not(Eq128(d64, v, prev)), d64, to);
+  }
+#else
+  (void)d64;
+#endif
+
+  // Remainder (or all keys, for HWY_SCALAR): one key at a time.
+  for (; idx < count; ++idx) {
+    const uint64_t lo = from[2 * idx];
+    const uint64_t hi = from[2 * idx + 1];
+    if (lo == from[2 * idx - 2] && hi == from[2 * idx - 1]) continue;
+    to[0] = lo;
+    to[1] = hi;
+    to += 2;
+  }
+  return to;
+}
+
+// Returns the number of keys Unique128 would write.
+template <class D64>
+size_t UniqueCount128(D64 d64, const uint64_t* HWY_RESTRICT keys,
+                      size_t count) {
+  if (HWY_UNLIKELY(count == 0)) return 0;
+  size_t num_unique = 1;
+  size_t idx = 1;  // in units of keys
+
+#if HWY_TARGET != HWY_SCALAR
+  const size_t N = Lanes(d64);
+  HWY_DASSERT(N >= 2);
+  const size_t keys_per_vec = N / 2;
+  for (; idx + keys_per_vec <= count; idx += keys_per_vec) {
+    const Vec<D64> v = LoadU(d64, keys + 2 * idx);
+    const Vec<D64> prev = LoadU(d64, keys + 2 * idx - 2);
+    // Both lanes of a key are either set or clear.
+    num_unique += CountTrue(d64, Not(Eq128(d64, v, prev))) / 2;
+  }
+#else
+  (void)d64;
+#endif
+
+  for (; idx < count; ++idx) {
+    num_unique += (keys[2 * idx] != keys[2 * idx - 2] ||
+                   keys[2 * idx + 1] != keys[2 * idx - 1]);
+  }
+  return num_unique;
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#endif  // HIGHWAY_HWY_CONTRIB_ALGO_UNIQUE_INL_H_
@@ -0,0 +1,160 @@
+// Copyright 2022 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>  // std::sort, std::unique
+#include <utility>    // std::pair
+#include <vector>
+
+#include "hwy/aligned_allocator.h"
+
+// clang-format off
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "hwy/contrib/algo/unique_test.cc"
+#include "hwy/foreach_target.h"  // IWYU pragma: keep
+
+#include "hwy/contrib/algo/unique-inl.h"
+#include "hwy/tests/test_util-inl.h"
+// clang-format on
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+
+// Returns sorted keys with the given number of random bits, hence mostly
+// duplicates for few bits and mostly unique keys otherwise.
+template <typename T>
+std::vector<T> SortedKeys(size_t count, uint32_t bits, RandomState& rng) {
+  std::vector<T> keys(count);
+  for (size_t i = 0; i < count; ++i) {
+    keys[i] = static_cast<T>(Random32(&rng) & ((1u << bits) - 1));
+  }
+  std::sort(keys.begin(), keys.end());
+  return keys;
+}
+
+// Invokes Test with all counts up to several vectors, each with few and many
+// unique keys.
+template <class Test>
+struct ForeachCountAndBits {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d) const {
+    RandomState rng;
+    const size_t N = Lanes(d);
+    for (size_t count = 0; count < 3 * N + 2; ++count) {
+      for (uint32_t bits : {1u, 3u, 7u}) {
+        Test()(d, SortedKeys<T>(count, bits, rng));
+      }
+    }
+  }
+};
+
+struct TestUnique {
+  template <class D, typename T = TFromD<D>>
+  void operator()(D d, const std::vector<T>& keys) {
+    const size_t count = keys.size();
+    std::vector<T> expected = keys;
+    expected.erase(std::unique(expected.begin(), expected.end()),
+                   expected.end());
+
+    HWY_ASSERT_EQ(expected.size(), UniqueCount(d, keys.data(), count));
+
+    // Separate output, with padding and a sentinel after the expected end.
+    const size_t padding = Lanes(ScalableTag<T>());
+    AlignedFreeUniquePtr<T[]> out = AllocateAligned<T>(count + 1 + padding);
+    for (size_t i = 0; i < count + 1 + padding; ++i) {
+      out[i] = T{0};
+    }
+    out[expected.size()] = static_cast<T>(99);
+    T* end = Unique(d, keys.data(), count, out.get());
+    HWY_ASSERT_EQ(expected.size(), static_cast<size_t>(end - out.get()));
+    HWY_ASSERT_EQ(static_cast<T>(99), out[expected.size()]);
+
+    const auto info = hwy::detail::MakeTypeInfo<T>();
+    const char* target_name = hwy::TargetName(HWY_TARGET);
+    hwy::detail::AssertArrayEqual(info, expected.data(), out.get(),
+                                  expected.size(), target_name, __FILE__,
+                                  __LINE__);
+
+    // In-place
+    std::vector<T> in_place = keys;
+    end = Unique(d, in_place.data(), count, in_place.data());
+    HWY_ASSERT_EQ(expected.size(), static_cast<size_t>(end - in_place.data()));
+    hwy::detail::AssertArrayEqual(info, expected.data(), in_place.data(),
+                                  expected.size(), target_name, __FILE__,
+                                  __LINE__);
+  }
+};
+
+void TestAllUnique() {
+  ForUI16(ForPartialVectors<ForeachCountAndBits<TestUnique>>());
+  ForUIF3264(ForPartialVectors<ForeachCountAndBits<TestUnique>>());
+}
+
+struct TestUnique128 {
+  template <typename T, class D>
+  HWY_NOINLINE void operator()(T /*unused*/, D d64) {
+    RandomState rng;
+    const size_t keys_per_vec = HWY_MAX(Lanes(d64) / 2, 1);
+    for (size_t count = 0; count < 3 * keys_per_vec + 2; ++count) {
+      // Few bits per half, so that halves are equal independently.
+      std::vector<uint64_t> keys(2 * count);
+      std::vector<std::pair<uint64_t, uint64_t>> pairs(count);
+      for (size_t i = 0; i < count; ++i) {
+        pairs[i].first = Random32(&rng) & 1;   // upper half
+        pairs[i].second = Random32(&rng) & 3;  // lower half
+      }
+      std::sort(pairs.begin(), pairs.end());
+      for (size_t i = 0; i < count; ++i) {
+        keys[2 * i + 0] = pairs[i].second;
+        keys[2 * i + 1] = pairs[i].first;
+      }
+      pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+
+      HWY_ASSERT_EQ(pairs.size(), UniqueCount128(d64, keys.data(), count));
+
+      // In-place
+      uint64_t* end = Unique128(d64, keys.data(), count, keys.data());
+      HWY_ASSERT_EQ(2 * pairs.size(), static_cast<size_t>(end - keys.data()));
+      for (size_t i = 0; i < pairs.size(); ++i) {
+        HWY_ASSERT_EQ(pairs[i].second, keys[2 * i + 0]);
+        HWY_ASSERT_EQ(pairs[i].first, keys[2 * i + 1]);
+      }
+    }
+  }
+};
+
+void TestAllUnique128() {
+#if HWY_TARGET == HWY_SCALAR
+  TestUnique128()(uint64_t(), ScalableTag<uint64_t>());
+#else
+  // Eq128 requires at least two lanes.
+  ForGEVectors<128, TestUnique128>()(uint64_t());
+#endif
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+
+namespace hwy {
+HWY_BEFORE_TEST(UniqueTest);
+HWY_EXPORT_AND_TEST_P(UniqueTest, TestAllUnique);
+HWY_EXPORT_AND_TEST_P(UniqueTest, TestAllUnique128);
+}  // namespace hwy
+
+#endif
@@ -0,0 +1,284 @@
+// Copyright 2022 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures the throughput of the array functions in math.h for each target,
+// versus a loop calling the standard library.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "hwy/aligned_allocator.h"
+#include "hwy/base.h"
+#include "hwy/contrib/math/math.h"
+#include "hwy/nanobenchmark.h"
+#include "hwy/targets.h"
+#include "gtest/gtest.h"
+
+namespace hwy {
+namespace {
+
+constexpr size_t kNum = 4096;  // L1-resident
+constexpr size_t kReps = 101;
+
+template <typename T>
+struct MathFunc {
+  const char* name;
+  void (*array_func)(const T*, T*, size_t);
+  T (*std_func)(T);
+  T min;
+  T max;
+};
+
+template <typename T>
+T Sigmoid(T x) {
+  return T{1} / (T{1} + std::exp(-x));
+}
+
+template <typename T>
+std::vector<MathFunc<T>> MathFuncs() {
+  // Lambdas because taking the address of std:: functions is unspecified.
+  return {
+      {"Acos", AcosArray, [](T x) -> T { return std::acos(x); }, -1, 1},
+      {"Acosh", AcoshArray, [](T x) -> T { return std::acosh(x); }, 1, 1E6},
+      {"Asin", AsinArray, [](T x) -> T { return std::asin(x); }, -1, 1},
+      {"Asinh", AsinhArray, [](T x) -> T { return std::asinh(x); }, -1E6, 1E6},
+      {"Atan", AtanArray, [](T x) -> T { return std::atan(x); }, -1E6, 1E6},
+      {"Atanh", AtanhArray, [](T x) -> T { return std::atanh(x); }, -0.99,
+       0.99},
+      {"Cbrt", CbrtArray, [](T x) -> T { return std::cbrt(x); }, -1E6, 1E6},
+      {"Cos", CosArray, [](T x) -> T { return std::cos(x); }, -1E4, 1E4},
+      {"Erf", ErfArray, [](T x) -> T { return std::erf(x); }, -5, 5},
+      {"Erfc", ErfcArray, [](T x) -> T { return std::erfc(x); }, -5, 20},
+      {"Exp", ExpArray, [](T x) -> T { return std::exp(x); }, -80, 80},
+      {"Exp2", Exp2Array, [](T x) -> T { return std::exp2(x); }, -100, 100},
+      {"Expm1", Expm1Array, [](T x) -> T { return std::expm1(x); }, -80, 80},
+      {"FastExp", FastExpArray, [](T x) -> T { return std::exp(x); }, -80, 80},
+      {"FastLog", FastLogArray, [](T x) -> T { return std::log(x); }, 1E-6,
+       1E6},
+      {"FastSigmoid", FastSigmoidArray, Sigmoid<T>, -20, 20},
+      {"FastTanh", FastTanhArray, [](T x) -> T { return std::tanh(x); }, -20,
+       20},
+      {"Log", LogArray, [](T x) -> T { return std::log(x); }, 1E-6, 1E6},
+      {"Log10", Log10Array, [](T x) -> T { return std::log10(x); }, 1E-6, 1E6},
+      {"Log1p", Log1pArray, [](T x) -> T { return std::log1p(x); }, 0, 1E6},
+      {"Log2", Log2Array, [](T x) -> T { return std::log2(x); }, 1E-6, 1E6},
+      {"Sigmoid", SigmoidArray, Sigmoid<T>, -20, 20},
+      {"Sin", SinArray, [](T x) -> T { return std::sin(x); }, -1E4, 1E4},
+      {"Sinh", SinhArray, [](T x) -> T { return std::sinh(x); }, -80, 80},
+      {"Tan", TanArray, [](T x) -> T { return std::tan(x); }, -1E4, 1E4},
+      {"Tanh", TanhArray, [](T x) -> T { return std::tanh(x); }, -20, 20},
+  };
+}
+
+// Returns the minimum duration in seconds of kReps calls to `func`.
+template <class Func>
+double MinSeconds(const Func& func) {
+  double best = 1E30;
+  for (size_t rep = 0; rep < kReps; ++rep) {
+    const double t0 = platform::Now();
+    func();
+    best = HWY_MIN(best, platform::Now() - t0);
+  }
+  return best;
+}
+
+template <typename T>
+void BenchMathArrays(const char* type_name) {
+  auto in = AllocateAligned<T>(kNum);
+  auto out = AllocateAligned<T>(kNum);
+  for (const MathFunc<T>& func : MathFuncs<T>()) {
+    for (size_t i = 0; i < kNum; ++i) {
+      in[i] = func.min + (func.max - func.min) * static_cast<T>(i) / kNum;
+    }
+
+    const double sec_std = MinSeconds([&]() {
+      for (size_t i = 0; i < kNum; ++i) {
+        out[i] = func.std_func(in[i]);
+      }
+    });
+    fprintf(stderr, "%-5s %-11s std    %7.2f ns/elem\n", type_name, func.name,
+            sec_std * 1E9 / kNum);
+
+    for (int64_t target : SupportedAndGeneratedTargets()) {
+      SetSupportedTargetsForTest(target);
+      const double sec = MinSeconds(
+          [&]() { func.array_func(in.get(), out.get(), kNum); });
+      fprintf(stderr, "%-5s %-11s %-6s %7.2f ns/elem (%5.1fx)\n", type_name,
+              func.name, TargetName(target), sec * 1E9 / kNum, sec_std / sec);
+    }
+    SetSupportedTargetsForTest(0);
+  }
+}
+
+// Compares SinCosArray with separate SinArray and CosArray calls.
+template <typename T>
+void BenchSinCos(const char* type_name) {
+  auto in = AllocateAligned<T>(kNum);
+  auto out_sin = AllocateAligned<T>(kNum);
+  auto out_cos = AllocateAligned<T>(kNum);
+  for (size_t i = 0; i < kNum; ++i) {
+    in[i] = static_cast<T>(-1E4 + 2E4 * static_cast<double>(i) / kNum);
+  }
+
+  for (int64_t target : SupportedAndGeneratedTargets()) {
+    SetSupportedTargetsForTest(target);
+    const double sec_separate = MinSeconds([&]() {
+      SinArray(in.get(), out_sin.get(), kNum);
+      CosArray(in.get(), out_cos.get(), kNum);
+    });
+    const double sec_fused = MinSeconds(
+        [&]() { SinCosArray(in.get(), out_sin.get(), out_cos.get(), kNum); });
+    fprintf(stderr,
+            "%-5s SinCos %-6s %7.2f ns/elem, Sin+Cos %7.2f ns/elem (%4.2fx)\n",
+            type_name, TargetName(target), sec_fused * 1E9 / kNum,
+            sec_separate * 1E9 / kNum, sec_separate / sec_fused);
+  }
+  SetSupportedTargetsForTest(0);
+}
+
+// Compares both tiers of the Fast* functions with the corresponding accurate
+// functions.
+template <typename T>
+void BenchFastMath(const char* type_name) {
+  struct FastTriple {
+    const char* name;
+    void (*accurate)(const T*, T*, size_t);
+    void (*approx)(const T*, T*, size_t);
+    void (*precise)(const T*, T*, size_t);
+    T min;
+    T max;
+  };
+  const FastTriple triples[] = {
+      {"Exp", ExpArray, FastExpArray, FastExpPreciseArray, -80, 80},
+      {"Log", LogArray, FastLogArray, FastLogPreciseArray, 1E-6, 1E6},
+      {"Sigmoid", SigmoidArray, FastSigmoidArray, FastSigmoidPreciseArray, -20,
+       20},
+      {"Tanh", TanhArray, FastTanhArray, FastTanhPreciseArray, -20, 20},
+  };
+
+  auto in = AllocateAligned<T>(kNum);
+  auto out = AllocateAligned<T>(kNum);
+  for (const FastTriple& triple : triples) {
+    for (size_t i = 0; i < kNum; ++i) {
+      in[i] = triple.min + (triple.max - triple.min) * static_cast<T>(i) / kNum;
+    }
+    for (int64_t target : SupportedAndGeneratedTargets()) {
+      SetSupportedTargetsForTest(target);
+      const double sec_accurate =
+          MinSeconds([&]() { triple.accurate(in.get(), out.get(), kNum); });
+      const double sec_approx =
+          MinSeconds([&]() { triple.approx(in.get(), out.get(), kNum); });
+      const double sec_precise =
+          MinSeconds([&]() { triple.precise(in.get(), out.get(), kNum); });
+      fprintf(stderr,
+              "%-5s Fast%-7s %-6s approx %7.2f ns/elem (%4.2fx), precise "
+              "%7.2f ns/elem (%4.2fx), accurate %7.2f ns/elem\n",
+              type_name, triple.name, TargetName(target),
+              sec_approx * 1E9 / kNum, sec_accurate / sec_approx,
+              sec_precise * 1E9 / kNum, sec_accurate / sec_precise,
+              sec_accurate * 1E9 / kNum);
+    }
+    SetSupportedTargetsForTest(0);
+  }
+}
+
+// Truncating conversions suffice for generating the inputs.
+void TruncateFromF32(float f, bfloat16_t* HWY_RESTRICT out) {
+  *out = BF16FromF32(f);
+}
+
+// Only for f32 within the range of float16_t; smaller magnitudes become zero.
+void TruncateFromF32(float f, float16_t* HWY_RESTRICT out) {
+  uint32_t bits32;
+  CopySameSize(&f, &bits32);
+  const uint32_t sign16 = (bits32 >> 16) & 0x8000;
+  const uint32_t abs_bits = bits32 & 0x7FFFFFFF;
+  const uint16_t bits16 = static_cast<uint16_t>(
+      abs_bits < (113u << 23) ? sign16
+                              : sign16 | ((abs_bits - (112u << 23)) >> 13));
+  CopySameSize(&bits16, out);
+}
+
+// Compares the half-precision Fast* arrays with their f32 versions.
+template <typename T16>
+void BenchHalfMath(const char* type_name) {
+  struct HalfFunc {
+    const char* name;
+    void (*half)(const T16*, T16*, size_t);
+    void (*f32)(const float*, float*, size_t);
+    float min;
+    float max;
+  };
+  const HalfFunc funcs[] = {
+      {"Exp", FastExpArray, FastExpArray, -10.0f, 10.0f},
+      {"Log", FastLogArray, FastLogArray, 1E-4f, 6E4f},
+      {"Sigmoid", FastSigmoidArray, FastSigmoidArray, -20.0f, 20.0f},
+      {"Tanh", FastTanhArray, FastTanhArray, -20.0f, 20.0f},
+  };
+
+  auto in = AllocateAligned<T16>(kNum);
+  auto out = AllocateAligned<T16>(kNum);
+  auto in_f32 = AllocateAligned<float>(kNum);
+  auto out_f32 = AllocateAligned<float>(kNum);
+  for (const HalfFunc& func : funcs) {
+    for (size_t i = 0; i < kNum; ++i) {
+      in_f32[i] = func.min + (func.max - func.min) * static_cast<float>(i) /
+                                 static_cast<float>(kNum);
+    }
+    for (size_t i = 0; i < kNum; ++i) {
+      TruncateFromF32(in_f32[i], &in[i]);
+    }
+    for (int64_t target : SupportedAndGeneratedTargets()) {
+      SetSupportedTargetsForTest(target);
+      const double sec_f32 = MinSeconds(
+          [&]() { func.f32(in_f32.get(), out_f32.get(), kNum); });
+      const double sec_half =
+          MinSeconds([&]() { func.half(in.get(), out.get(), kNum); });
+      fprintf(stderr,
+              "%-5s Fast%-7s %-6s %7.2f ns/elem, f32 %7.2f ns/elem (%4.2fx)\n",
+              type_name, func.name, TargetName(target), sec_half * 1E9 / kNum,
+              sec_f32 * 1E9 / kNum, sec_f32 / sec_half);
+    }
+    SetSupportedTargetsForTest(0);
+  }
+}
+
+TEST(BenchMath, Throughput) {
+  BenchMathArrays<float>("f32");
+  BenchMathArrays<double>("f64");
+}
+
+TEST(BenchMath, Fast) {
+  BenchFastMath<float>("f32");
+  BenchFastMath<double>("f64");
+}
+
+TEST(BenchMath, Half) {
+  BenchHalfMath<float16_t>("f16");
+  BenchHalfMath<bfloat16_t>("bf16");
+}
+
+TEST(BenchMath, SinCos) {
+  BenchSinCos<float>("f32");
+  BenchSinCos<double>("f64");
+}
+
+}  // namespace
+}  // namespace hwy
@@ -103,6 +103,21 @@ HWY_NOINLINE V CallAtan(const D d, VecArg<V> x) {
   return Atan(d, x);
 }
 
+/**
+ * Highway SIMD version of std::atan2(y, x).
+ *
+ * Valid Lane Types: float32, float64
+ *        Max Error: ULP = 2
+ *      Valid Range: float32[-FLT_MAX, +FLT_MAX], float64[-DBL_MAX, +DBL_MAX]
+ * @return angle of the point ('x', 'y') in [-pi, +pi]
+ */
+template <class D, class V>
+HWY_INLINE V Atan2(const D d, V y, V x);
+template <class D, class V>
+HWY_NOINLINE V CallAtan2(const D d, VecArg<V> y, VecArg<V> x) {
+  return Atan2(d, y, x);
+}
+
 /**
  * Highway SIMD version of std::atanh(x).
  *
@@ -118,6 +133,21 @@ HWY_NOINLINE V CallAtanh(const D d, VecArg<V> x) {
   return Atanh(d, x);
 }
 
+/**
+ * Highway SIMD version of std::cbrt(x).
+ *
+ * Valid Lane Types: float32, float64
+ *        Max Error: ULP = 3
+ *      Valid Range: float32[-FLT_MAX, +FLT_MAX], float64[-DBL_MAX, +DBL_MAX]
+ * @return cube root of 'x'
+ */
+template <class D, class V>
+HWY_INLINE V Cbrt(const D d, V x);
+template <class D, class V>
+HWY_NOINLINE V CallCbrt(const D d, VecArg<V> x) {
+  return Cbrt(d, x);
+}
+
 /**
  * Highway SIMD version of std::cos(x).
  *
@@ -133,6 +163,36 @@ HWY_NOINLINE V CallCos(const D d, VecArg<V> x) {
   return Cos(d, x);
 }
 
+/**
+ * Highway SIMD version of std::erf(x).
+ *
+ * Valid Lane Types: float32, float64
+ *        Max Error: ULP = 2
+ *      Valid Range: float32[-FLT_MAX, +FLT_MAX], float64[-DBL_MAX, +DBL_MAX]
+ * @return error function of 'x'
+ */
+template <class D, class V>
+HWY_INLINE V Erf(const D d, V x);
+template <class D, class V>
+HWY_NOINLINE V CallErf(const D d, VecArg<V> x) {
+  return Erf(d, x);
+}
+
+/**
+ * Highway SIMD version of std::erfc(x).
+ *
+ * Valid Lane Types: float32, float64
+ *        Max Error: ULP = 4
+ *      Valid Range: float32[-FLT_MAX, +FLT_MAX], float64[-DBL_MAX, +DBL_MAX]
+ * @return complementary error function of 'x'
+ */
+template <class D, class V>
+HWY_INLINE V Erfc(const D d, V x);
+template <class D, class V>
+HWY_NOINLINE V CallErfc(const D d, VecArg<V> x) {
+  return Erfc(d, x);
+}
+
 /**
  * Highway SIMD version of std::exp(x).
  *
@@ -148,6 +208,37 @@ HWY_NOINLINE V CallExp(const D d, VecArg<V> x) {
   return Exp(d, x);
 }
 
+/**
+ * Highway SIMD version of std::exp2(x).
+ *
+ * Valid Lane Types: float32, float64
+ *        Max Error: ULP = 1
+ *      Valid Range: float32[-FLT_MAX, +128], float64[-DBL_MAX, +1024]
+ * @return 2^x
+ */
+template <class D, class V>
+HWY_INLINE V Exp2(const D d, V x);
+template <class D, class V>
+HWY_NOINLINE V CallExp2(const D d, VecArg<V> x) {
+  return Exp2(d, x);
+}
+
+/**
+ * Computes Exp and Expm1 of the same 'x', sharing the range reduction and
+ * polynomial. The results are identical to those of the separate functions.
+ *
+ * Valid Lane Types: float32, float64
+ *        Max Error: ULP = 1 (exp), 4 (expm1)
+ *      Valid Range: float32[-FLT_MAX, +104], float64[-DBL_MAX, +706]
+ * Sets 'exp' to e^x and 'expm1' to e^x - 1.
+ */
+template <class D, class V>
+HWY_INLINE void ExpAndExpm1(const D d, V x, V& exp, V& expm1);
+template <class D, class V>
+HWY_NOINLINE void CallExpAndExpm1(const D d, VecArg<V> x, V& exp, V& expm1) {
+  ExpAndExpm1(d, x, exp, expm1);
+}
+
 /**
  * Highway SIMD version of std::expm1(x).
  *
@@ -163,6 +254,96 @@ HWY_NOINLINE V CallExpm1(const D d, VecArg<V> x) {
   return Expm1(d, x);
 }
 
+// Accuracy of the Fast* functions below, which skip some of the range handling
+// of the accurate functions. kApprox has a relative error of about 1E-5 for
+// float32 and 1E-13 for float64 (hundreds of ULP), for callers such as machine
+// learning that tolerate it. kPrecise is within 2 ULP, as are the accurate
+// functions such as Exp, but is still faster.
+enum class FastPrecision { kApprox, kPrecise };
+
+/**
+ * Fast version of Exp. Uses a single-step reduction (kApprox) or a shorter
+ * reconstruction than Exp (kPrecise), and no overflow handling.
+ *
+ * Valid Lane Types: float32, float64
+ *        Max Error: kApprox: relative 8E-6 (float32), 1E-13 (float64)
+ *                   kPrecise: ULP = 1
+ *      Valid Range: float32[-FLT_MAX, +88], float64[-DBL_MAX, +709]
+ * @return e^x, or zero if the result would be less than about 2^-125 (float32)
+ *         or 2^-1021 (float64)
+ */
+template <FastPrecision kPrecision = FastPrecision::kApprox, class D, class V>
+HWY_INLINE V FastExp(const D d, V x);
+template <FastPrecision kPrecision = FastPrecision::kApprox, class D, class V>
+HWY_NOINLINE V CallFastExp(const D d, VecArg<V> x) {
+  return FastExp<kPrecision>(d, x);
+}
+
+/**
+ * Fast version of Log, which does not handle zero, negative or subnormal
+ * inputs. For float32, kApprox also avoids the division of Log.
+ *
+ * Valid Lane Types: float32, float64
+ *        Max Error: kApprox: relative 1E-5 (float32), 1E-13 (float64)
+ *                   kPrecise: ULP = 1
+ *      Valid Range: float32[FLT_MIN, +FLT_MAX], float64[DBL_MIN, +DBL_MAX]
+ * @return natural logarithm of 'x'
+ */
+template <FastPrecision kPrecision = FastPrecision::kApprox, class D, class V>
+HWY_INLINE V FastLog(const D d, V x);
+template <FastPrecision kPrecision = FastPrecision::kApprox, class D, class V>
+HWY_NOINLINE V CallFastLog(const D d, VecArg<V> x) {
+  return FastLog<kPrecision>(d, x);
+}
+
+/**
+ * Fast version of Sigmoid, based on FastExp.
+ *
+ * Valid Lane Types: float32, float64
+ *        Max Error: kApprox: relative 8E-6 (float32), 1E-13 (float64)
+ *                   kPrecise: ULP = 2
+ *      Valid Range: float32[-86, +FLT_MAX], float64[-707, +DBL_MAX]
+ * @return 1 / (1 + e^-x)
+ */
+template <FastPrecision kPrecision = FastPrecision::kApprox, class D, class V>
+HWY_INLINE V FastSigmoid(const D d, V x);
+template <FastPrecision kPrecision = FastPrecision::kApprox, class D, class V>
+HWY_NOINLINE V CallFastSigmoid(const D d, VecArg<V> x) {
+  return FastSigmoid<kPrecision>(d, x);
+}
+
+/**
+ * Fast version of Tanh. kApprox uses a polynomial for small inputs and FastExp
+ * otherwise; kPrecise is Tanh with the shorter reconstruction of FastExp.
+ *
+ * Valid Lane Types: float32, float64
+ *        Max Error: kApprox: relative 5E-6 (float32), 1E-13 (float64)
+ *                   kPrecise: ULP = 2
+ *      Valid Range: float32[-FLT_MAX, +FLT_MAX], float64[-DBL_MAX, +DBL_MAX]
+ * @return hyperbolic tangent of 'x'
+ */
+template <FastPrecision kPrecision = FastPrecision::kApprox, class D, class V>
+HWY_INLINE V FastTanh(const D d, V x);
+template <FastPrecision kPrecision = FastPrecision::kApprox, class D, class V>
+HWY_NOINLINE V CallFastTanh(const D d, VecArg<V> x) {
+  return FastTanh<kPrecision>(d, x);
+}
+
+/**
+ * Highway SIMD version of std::hypot(x, y).
+ *
+ * Valid Lane Types: float32, float64
+ *        Max Error: ULP = 1
+ *      Valid Range: float32[-FLT_MAX, +FLT_MAX], float64[-DBL_MAX, +DBL_MAX]
+ * @return sqrt(x^2 + y^2) without undue overflow or underflow
+ */
+template <class D, class V>
+HWY_INLINE V Hypot(const D d, V x, V y);
+template <class D, class V>
+HWY_NOINLINE V CallHypot(const D d, VecArg<V> x, VecArg<V> y) {
+  return Hypot(d, x, y);
+}
+
 /**
  * Highway SIMD version of std::log(x).
  *
@@ -223,6 +404,53 @@ HWY_NOINLINE V CallLog2(const D d, VecArg<V> x) {
   return Log2(d, x);
 }
 
+/**
+ * Computes Log and std::logb of the same 'x', sharing the exponent extraction.
+ * The logarithm is identical to that of Log.
+ *
+ * Valid Lane Types: float32, float64
+ *        Max Error: ULP = 4 (log), 0 (logb)
+ *      Valid Range: float32(0, +FLT_MAX], float64(0, +DBL_MAX]
+ * Sets 'log' to the natural logarithm of 'x' and 'logb' to its unbiased
+ * binary exponent, floor(log2(x)).
+ */
+template <class D, class V>
+HWY_INLINE void LogAndLogb(const D d, V x, V& log, V& logb);
+template <class D, class V>
+HWY_NOINLINE void CallLogAndLogb(const D d, VecArg<V> x, V& log, V& logb) {
+  LogAndLogb(d, x, log, logb);
+}
+
+/**
+ * Highway SIMD version of std::pow(x, y).
+ *
+ * Valid Lane Types: float32, float64
+ *        Max Error: ULP = 2
+ *      Valid Range: float32[-FLT_MAX, +FLT_MAX], float64[-DBL_MAX, +DBL_MAX]
+ * @return 'x' raised to the power 'y'
+ */
+template <class D, class V>
+HWY_INLINE V Pow(const D d, V x, V y);
+template <class D, class V>
+HWY_NOINLINE V CallPow(const D d, VecArg<V> x, VecArg<V> y) {
+  return Pow(d, x, y);
+}
+
+/**
+ * Logistic function, as used in machine learning.
+ *
+ * Valid Lane Types: float32, float64
+ *        Max Error: ULP = 2
+ *      Valid Range: float32[-FLT_MAX, +FLT_MAX], float64[-DBL_MAX, +DBL_MAX]
+ * @return 1 / (1 + e^-x)
+ */
+template <class D, class V>
+HWY_INLINE V Sigmoid(const D d, V x);
+template <class D, class V>
+HWY_NOINLINE V CallSigmoid(const D d, VecArg<V> x) {
+  return Sigmoid(d, x);
+}
+
 /**
  * Highway SIMD version of std::sin(x).
  *
@@ -238,6 +466,22 @@ HWY_NOINLINE V CallSin(const D d, VecArg<V> x) {
   return Sin(d, x);
 }
 
+/**
+ * Computes Sin and Cos of the same 'x' with a single range reduction into
+ * [-pi/4, +pi/4], where both polynomials are shorter than that of Sin.
+ *
+ * Valid Lane Types: float32, float64
+ *        Max Error: ULP = 2
+ *      Valid Range: [-39000, +39000]
+ * Sets 's' to the sine and 'c' to the cosine of 'x'.
+ */
+template <class D, class V>
+HWY_INLINE void SinCos(const D d, V x, V& s, V& c);
+template <class D, class V>
+HWY_NOINLINE void CallSinCos(const D d, VecArg<V> x, V& s, V& c) {
+  SinCos(d, x, s, c);
+}
+
 /**
  * Highway SIMD version of std::sinh(x).
  *
@@ -253,6 +497,21 @@ HWY_NOINLINE V CallSinh(const D d, VecArg<V> x) {
   return Sinh(d, x);
 }
 
+/**
+ * Highway SIMD version of std::tan(x).
+ *
+ * Valid Lane Types: float32, float64
+ *        Max Error: ULP = 3
+ *      Valid Range: [-39000, +39000]
+ * @return tangent of 'x'
+ */
+template <class D, class V>
+HWY_INLINE V Tan(const D d, V x);
+template <class D, class V>
+HWY_NOINLINE V CallTan(const D d, VecArg<V> x) {
+  return Tan(d, x);
+}
+
 /**
  * Highway SIMD version of std::tanh(x).
  *
@@ -461,6 +720,71 @@ HWY_INLINE HWY_MAYBE_UNUSED T Estrin(T x, T c0, T c1, T c2, T c3, T c4, T c5,
                     MulAdd(x2, MulAdd(c3, x, c2), MulAdd(c1, x, c0)))));
 }
 
+// Error-free transformations: each returns the rounding error of an addition or
+// multiplication whose rounded result is `sum` or `prod`. Together they
+// represent a value as the unevaluated sum of two floating-point numbers,
+// which is used where the working precision is insufficient, e.g. for Pow.
+//
+// These require that each operation is rounded separately. GCC fuses a
+// multiplication and a subsequent addition by default (-ffp-contract=fast),
+// including on targets without HWY_NATIVE_FMA if FMA is enabled for the whole
+// translation unit, e.g. via -march=haswell. The sums below only add, hence
+// this is safe unless an operand is a product that the compiler could fuse
+// into them; callers therefore obtain products from TwoProduct.
+
+// Returns (a + b) - sum, where sum = a + b rounded.
+template <class V>
+HWY_INLINE HWY_MAYBE_UNUSED V TwoSumError(V a, V b, V sum) {
+  const V b_rounded = Sub(sum, a);
+  return Add(Sub(a, Sub(sum, b_rounded)), Sub(b, b_rounded));
+}
+
+// As above, but requires |a| >= |b| or a = 0.
+template <class V>
+HWY_INLINE HWY_MAYBE_UNUSED V FastTwoSumError(V a, V b, V sum) {
+  return Sub(b, Sub(sum, a));
+}
+
+// Returns prod = a * b rounded and sets `err` to a * b - prod. The compiler
+// does not fuse `prod` into later additions, so it can be passed to the above.
+template <class D, class V>
+HWY_INLINE HWY_MAYBE_UNUSED V TwoProduct(D d, V a, V b, V& err) {
+  V prod = Mul(a, b);
+#if HWY_NATIVE_FMA
+  // `prod` is also an operand of an FMA, which prevents fusing it elsewhere.
+  (void)d;
+  err = MulSub(a, b, prod);
+#else
+#if HWY_COMPILER_GCC  // Also Clang, for -ffp-contract=fast.
+  // Hide the origin of `prod` so that it is not fused into later additions.
+#if HWY_ARCH_X86 && HWY_TARGET != HWY_SCALAR && HWY_TARGET != HWY_EMU128
+  asm("" : "+x"(prod.raw));
+#else
+  asm("" : "+m"(prod));
+#endif
+#endif  // HWY_COMPILER_GCC
+
+  // Dekker's algorithm: split each factor into halves whose products are
+  // exact, hence the result does not depend on whether they are fused. The
+  // usual split via multiplication by 2^s + 1 is not exact if fused, so instead
+  // round to the upper half of the mantissa bits. The lower halves are signed
+  // and thus have at most 12 (f32) or 26 (f64) bits.
+  using T = TFromD<D>;
+  const RebindToUnsigned<D> du;
+  using TU = TFromD<decltype(du)>;
+  constexpr int kLowerBits = sizeof(T) == 4 ? 12 : 27;
+  const auto round = Set(du, static_cast<TU>(TU{1} << (kLowerBits - 1)));
+  const auto upper = Set(du, static_cast<TU>(~TU{0} << kLowerBits));
+  const V a_hi = BitCast(d, And(Add(BitCast(du, a), round), upper));
+  const V a_lo = Sub(a, a_hi);
+  const V b_hi = BitCast(d, And(Add(BitCast(du, b), round), upper));
+  const V b_lo = Sub(b, b_hi);
+  const V err_hi = Add(Sub(Mul(a_hi, b_hi), prod), Mul(a_hi, b_lo));
+  err = MulAdd(a_lo, b_lo, MulAdd(a_lo, b_hi, err_hi));
+#endif  // HWY_NATIVE_FMA
+  return prod;
+}
+
 template <class FloatOrDouble>
 struct AsinImpl {};
 template <class FloatOrDouble>
@@ -468,8 +792,12 @@ struct AtanImpl {};
 template <class FloatOrDouble>
 struct CosSinImpl {};
 template <class FloatOrDouble>
+struct ErfImpl {};
+template <class FloatOrDouble>
 struct ExpImpl {};
 template <class FloatOrDouble>
+struct FastImpl {};
+template <class FloatOrDouble>
 struct LogImpl {};
 
 template <>
@@ -587,6 +915,45 @@ struct CosSinImpl<float> {
     return MulAdd(Estrin(y, k0, k1, k2, k3), Mul(y, x), x);
   }
 
+  // Polynomial approximation for sin(x) over the range [-pi/4, +pi/4], which
+  // requires fewer terms than Poly.
+  template <class D, class V>
+  HWY_INLINE V SinPoly(D d, V x) {
+    const auto k0 = Set(d, -0.166666642f);
+    const auto k1 = Set(d, +0.00833274797f);
+    const auto k2 = Set(d, -0.00019587866f);
+
+    const auto y = Mul(x, x);
+    return MulAdd(Estrin(y, k0, k1, k2), Mul(y, x), x);
+  }
+
+  // Polynomial approximation for cos(x) over the range [-pi/4, +pi/4].
+  template <class D, class V>
+  HWY_INLINE V CosPoly(D d, V x) {
+    const auto k0 = Set(d, +0.0416666642f);
+    const auto k1 = Set(d, -0.00138883025f);
+    const auto k2 = Set(d, +2.45479168e-05f);
+
+    const auto y = Mul(x, x);
+    const auto z = MulAdd(Estrin(y, k0, k1, k2), y, Set(d, -0.5f));
+    return MulAdd(z, y, Set(d, 1.0f));
+  }
+
+  // Polynomial approximation for tan(x) over the range [-pi/4, +pi/4].
+  template <class D, class V>
+  HWY_INLINE V TanPoly(D d, V x) {
+    const auto k0 = Set(d, +0.333333343f);
+    const auto k1 = Set(d, +0.133332312f);
+    const auto k2 = Set(d, +0.0539944805f);
+    const auto k3 = Set(d, +0.0216210019f);
+    const auto k4 = Set(d, +0.00996258575f);
+    const auto k5 = Set(d, +0.0011846202f);
+    const auto k6 = Set(d, +0.00384355593f);
+
+    const auto y = Mul(x, x);
+    return MulAdd(Estrin(y, k0, k1, k2, k3, k4, k5, k6), Mul(y, x), x);
+  }
+
   template <class D, class V, class VI32>
   HWY_INLINE V CosReduce(D d, V x, VI32 q) {
     // kHalfPiPart0f + kHalfPiPart1f + kHalfPiPart2f + kHalfPiPart3f ~= -pi/2
@@ -662,6 +1029,62 @@ struct CosSinImpl<double> {
     return MulAdd(Estrin(y, k0, k1, k2, k3, k4, k5, k6, k7, k8), Mul(y, x), x);
   }
 
+  // Polynomial approximation for sin(x) over the range [-pi/4, +pi/4], which
+  // requires fewer terms than Poly.
+  template <class D, class V>
+  HWY_INLINE V SinPoly(D d, V x) {
+    const auto k0 = Set(d, -0.16666666666666666);
+    const auto k1 = Set(d, +0.008333333333330948);
+    const auto k2 = Set(d, -0.00019841269836756774);
+    const auto k3 = Set(d, +2.7557316101617874e-06);
+    const auto k4 = Set(d, -2.5051131650235181e-08);
+    const auto k5 = Set(d, +1.5918115263265974e-10);
+
+    const auto y = Mul(x, x);
+    return MulAdd(Estrin(y, k0, k1, k2, k3, k4, k5), Mul(y, x), x);
+  }
+
+  // Polynomial approximation for cos(x) over the range [-pi/4, +pi/4].
+  template <class D, class V>
+  HWY_INLINE V CosPoly(D d, V x) {
+    const auto k0 = Set(d, +0.041666666666666664);
+    const auto k1 = Set(d, -0.0013888888888887398);
+    const auto k2 = Set(d, +2.4801587298764561e-05);
+    const auto k3 = Set(d, -2.7557317271145144e-07);
+    const auto k4 = Set(d, +2.087614614655861e-09);
+    const auto k5 = Set(d, -1.1382623647474604e-11);
+
+    const auto y = Mul(x, x);
+    const auto z = MulAdd(Estrin(y, k0, k1, k2, k3, k4, k5), y, Set(d, -0.5));
+    return MulAdd(z, y, Set(d, 1.0));
+  }
+
+  // Polynomial approximation for tan(x) over the range [-pi/4, +pi/4].
+  template <class D, class V>
+  HWY_INLINE V TanPoly(D d, V x) {
+    const auto k0 = Set(d, +0.33333333333333331);
+    const auto k1 = Set(d, +0.13333333333333361);
+    const auto k2 = Set(d, +0.053968253968216556);
+    const auto k3 = Set(d, +0.021869488538183754);
+    const auto k4 = Set(d, +0.0088632354722768796);
+    const auto k5 = Set(d, +0.0035921290237988742);
+    const auto k6 = Set(d, +0.001455823320259715);
+    const auto k7 = Set(d, +0.00059011282974907105);
+    const auto k8 = Set(d, +0.00023866111232275354);
+    const auto k9 = Set(d, +9.8770485611053856e-05);
+    const auto k10 = Set(d, +3.3924436350624791e-05);
+    const auto k11 = Set(d, +2.7116774398170046e-05);
+    const auto k12 = Set(d, -1.0207686890432195e-05);
+    const auto k13 = Set(d, +1.9545627331217013e-05);
+    const auto k14 = Set(d, -9.7495928716894771e-06);
+    const auto k15 = Set(d, +3.9505710449529166e-06);
+
+    const auto y = Mul(x, x);
+    return MulAdd(Estrin(y, k0, k1, k2, k3, k4, k5, k6, k7, k8, k9, k10, k11,
+                         k12, k13, k14, k15),
+                  Mul(y, x), x);
+  }
+
   template <class D, class V, class VI32>
   HWY_INLINE V CosReduce(D d, V x, VI32 q) {
     // kHalfPiPart0d + kHalfPiPart1d + kHalfPiPart2d + kHalfPiPart3d ~= -pi/2
@@ -764,6 +1187,48 @@ struct ExpImpl<float> {
   }
 };
 
+// Polynomials for FastPrecision::kApprox.
+template <>
+struct FastImpl<float> {
+  // Approximates 2^f for f in [-0.5, +0.5].
+  template <class D, class V>
+  HWY_INLINE V Exp2Poly(D d, V f) {
+    const V k0 = Set(d, +1.0f);
+    const V k1 = Set(d, +0.693121016f);
+    const V k2 = Set(d, +0.240223497f);
+    const V k3 = Set(d, +0.0559219755f);
+    const V k4 = Set(d, +0.00966636837f);
+
+    return Estrin(f, k0, k1, k2, k3, k4);
+  }
+
+  // Approximates log(m) for m in [sqrt(2)/2, sqrt(2)] as f * P(f) with
+  // f = m - 1 in [-0.29, +0.41], which requires no division.
+  template <class D, class V>
+  HWY_INLINE V LogPoly(D d, V m) {
+    const V k0 = Set(d, +1.0000037f);
+    const V k1 = Set(d, -0.499894798f);
+    const V k2 = Set(d, +0.332659066f);
+    const V k3 = Set(d, -0.254333556f);
+    const V k4 = Set(d, +0.219657078f);
+    const V k5 = Set(d, -0.140216231f);
+
+    const V f = Sub(m, Set(d, 1.0f));
+    return Mul(f, Estrin(f, k0, k1, k2, k3, k4, k5));
+  }
+
+  // Approximates tanh(x) / x from x2 = x^2, for |x| < 0.625.
+  template <class D, class V>
+  HWY_INLINE V TanhPoly(D d, V x2) {
+    const V k0 = Set(d, +0.999997079f);
+    const V k1 = Set(d, -0.333090544f);
+    const V k2 = Set(d, +0.130142704f);
+    const V k3 = Set(d, -0.0400093384f);
+
+    return Estrin(x2, k0, k1, k2, k3);
+  }
+};
+
 template <>
 struct LogImpl<float> {
   template <class D, class V>
@@ -786,6 +1251,56 @@ struct LogImpl<float> {
     const V x4 = Mul(x2, x2);
     return MulAdd(MulAdd(k2, x4, k0), x2, Mul(MulAdd(k3, x4, k1), x4));
   }
+
+  // Approximates (2 * atanh(s) - 2 * s - 2/3 * s^3) / s^5 from x2 = s^2, for
+  // s in [-(3 - 2 * sqrt(2)), +(3 - 2 * sqrt(2))].
+  template <class D, class V>
+  HWY_INLINE V LogTailPoly(D d, V x2) {
+    const V k0 = Set(d, 0.400000006f);
+    const V k1 = Set(d, 0.285715312f);
+    const V k2 = Set(d, 0.222046897f);
+    const V k3 = Set(d, 0.191224307f);
+
+    return Estrin(x2, k0, k1, k2, k3);
+  }
+};
+
+template <>
+struct ErfImpl<float> {
+  // Approximates erf(x) / x - 1 from x2 = x^2 over the range [0, 1).
+  template <class D, class V>
+  HWY_INLINE V ErfPoly(D d, V x2) {
+    const V k0 = Set(d, +0.128379166f);
+    const V k1 = Set(d, -0.37612626f);
+    const V k2 = Set(d, +0.112835944f);
+    const V k3 = Set(d, -0.0268542115f);
+    const V k4 = Set(d, +0.00518908724f);
+    const V k5 = Set(d, -0.00080168643f);
+    const V k6 = Set(d, +7.87587487e-05f);
+
+    return Estrin(x2, k0, k1, k2, k3, k4, k5, k6);
+  }
+
+  // Approximates log(erfc(x) / t) + x^2 from t = 2 / (2 + x), for x in
+  // [0, 10.5].
+  template <class D, class V>
+  HWY_INLINE V ErfcPoly(D d, V t) {
+    const V k0 = Set(d, -0.563156784f);
+    const V k1 = Set(d, +1.368119f);
+    const V k2 = Set(d, +0.0947634429f);
+    const V k3 = Set(d, -0.406917185f);
+    const V k4 = Set(d, -0.0396313518f);
+    const V k5 = Set(d, +0.296685725f);
+    const V k6 = Set(d, -0.0467248f);
+    const V k7 = Set(d, -0.25515005f);
+    const V k8 = Set(d, +0.136702955f);
+    const V k9 = Set(d, +0.18661049f);
+    const V k10 = Set(d, -0.14027378f);
+    const V k11 = Set(d, -0.0779863968f);
+
+    const V u = Sub(t, Set(d, 0.58f));
+    return Estrin(u, k0, k1, k2, k3, k4, k5, k6, k7, k8, k9, k10, k11);
+  }
 };
 
 #if HWY_HAVE_FLOAT64 && HWY_HAVE_INTEGER64
@@ -845,6 +1360,61 @@ struct ExpImpl<double> {
   }
 };
 
+// Polynomials for FastPrecision::kApprox. These are longer than for float
+// because the relative error is about 1E-13 rather than 1E-5.
+template <>
+struct FastImpl<double> {
+  // Approximates 2^f for f in [-0.5, +0.5].
+  template <class D, class V>
+  HWY_INLINE V Exp2Poly(D d, V f) {
+    const V k0 = Set(d, +1.0);
+    const V k1 = Set(d, +0.6931471805599453);
+    const V k2 = Set(d, +0.2402265069581299);
+    const V k3 = Set(d, +0.055504108664760424);
+    const V k4 = Set(d, +0.009618129159402558);
+    const V k5 = Set(d, +0.0013333558179043112);
+    const V k6 = Set(d, +0.00015403455852453838);
+    const V k7 = Set(d, +1.525268684626772e-05);
+    const V k8 = Set(d, +1.3255224878668817e-06);
+    const V k9 = Set(d, +1.0203121063391729e-07);
+
+    return Estrin(f, k0, k1, k2, k3, k4, k5, k6, k7, k8, k9);
+  }
+
+  // Approximates log(m) for m in [sqrt(2)/2, sqrt(2)] as 2 * atanh(z) with
+  // z = (m - 1) / (m + 1). A polynomial in m - 1 would be much longer.
+  template <class D, class V>
+  HWY_INLINE V LogPoly(D d, V m) {
+    const V k0 = Set(d, +0.6666666666737509);
+    const V k1 = Set(d, +0.3999999879733759);
+    const V k2 = Set(d, +0.2857175453591449);
+    const V k3 = Set(d, +0.22191400830308503);
+    const V k4 = Set(d, +0.19362653714202008);
+    const V kOne = Set(d, +1.0);
+
+    const V z = Div(Sub(m, kOne), Add(m, kOne));
+    const V z2 = Mul(z, z);
+    return MulAdd(Mul(z, z2), Estrin(z2, k0, k1, k2, k3, k4), Add(z, z));
+  }
+
+  // Approximates tanh(x) / x from x2 = x^2, for |x| < 0.625.
+  template <class D, class V>
+  HWY_INLINE V TanhPoly(D d, V x2) {
+    const V k0 = Set(d, +0.9999999999999928);
+    const V k1 = Set(d, -0.33333333332962617);
+    const V k2 = Set(d, +0.13333333301889638);
+    const V k3 = Set(d, -0.05396824358657983);
+    const V k4 = Set(d, +0.02186931369810686);
+    const V k5 = Set(d, -0.008861533898008209);
+    const V k6 = Set(d, +0.0035819502590578034);
+    const V k7 = Set(d, -0.0014175438724747613);
+    const V k8 = Set(d, +0.0005001644979308088);
+    const V k9 = Set(d, -0.00011314592094804542);
+
+    return Estrin(x2, k0, k1, k2, k3, k4, k5, k6, k7, k8, k9);
+  }
+};
+
 template <>
 struct LogImpl<double> {
   template <class D, class V>
@@ -871,24 +1441,106 @@ struct LogImpl<double> {
     return MulAdd(MulAdd(MulAdd(MulAdd(k6, x4, k4), x4, k2), x4, k0), x2,
                   (Mul(MulAdd(MulAdd(k5, x4, k3), x4, k1), x4)));
   }
+
+  // Approximates (2 * atanh(s) - 2 * s - 2/3 * s^3) / s^5 from x2 = s^2, for
+  // s in [-(3 - 2 * sqrt(2)), +(3 - 2 * sqrt(2))].
+  template <class D, class V>
+  HWY_INLINE V LogTailPoly(D d, V x2) {
+    const V k0 = Set(d, 0.40000000000000002);
+    const V k1 = Set(d, 0.2857142857142938);
+    const V k2 = Set(d, 0.22222222221648821);
+    const V k3 = Set(d, 0.1818181833699257);
+    const V k4 = Set(d, 0.15384594791762352);
+    const V k5 = Set(d, 0.13334813971292003);
+    const V k6 = Set(d, 0.11705988156500907);
+    const V k7 = Set(d, 0.11725771221811145);
+
+    return Estrin(x2, k0, k1, k2, k3, k4, k5, k6, k7);
+  }
+};
+
+template <>
+struct ErfImpl<double> {
+  // Approximates erf(x) / x - 1 from x2 = x^2 over the range [0, 1).
+  template <class D, class V>
+  HWY_INLINE V ErfPoly(D d, V x2) {
+    const V k0 = Set(d, +0.12837916709551259);
+    const V k1 = Set(d, -0.37612638903183748);
+    const V k2 = Set(d, +0.11283791670954879);
+    const V k3 = Set(d, -0.026866170645076792);
+    const V k4 = Set(d, +0.0052239776248180145);
+    const V k5 = Set(d, -0.000854832698083379);
+    const V k6 = Set(d, +0.0001205533111164271);
+    const V k7 = Set(d, -1.4925595266831182e-05);
+    const V k8 = Set(d, +1.6461000484121368e-06);
+    const V k9 = Set(d, -1.6350312701054695e-07);
+    const V k10 = Set(d, +1.4659775274047436e-08);
+    const V k11 = Set(d, -1.1372848856791674e-09);
+    const V k12 = Set(d, +5.9571761477489113e-11);
+
+    return Estrin(x2, k0, k1, k2, k3, k4, k5, k6, k7, k8, k9, k10, k11, k12);
+  }
+
+  // Approximates log(erfc(x) / t) + x^2 from t = 2 / (2 + x), for x in
+  // [0, 31.3]. Separate polynomials cover t < 0.5 and t >= 0.5.
+  template <class D, class V>
+  HWY_INLINE V ErfcPoly(D d, V t) {
+    const auto is_lo = Lt(t, Set(d, 0.5));
+    const V k0 = IfThenElse(is_lo, Set(d, -0.95509262890407987),
+                            Set(d, -0.32983011628582232));
+    const V k1 = IfThenElse(is_lo, Set(d, +1.2169619994241274),
+                            Set(d, +1.3654416199452144));
+    const V k2 = IfThenElse(is_lo, Set(d, +0.36781990144568427),
+                            Set(d, -0.10629171661149037));
+    const V k3 = IfThenElse(is_lo, Set(d, -0.14378733191790377),
+                            Set(d, -0.35880062881822272));
+    const V k4 = IfThenElse(is_lo, Set(d, -0.3024026781386035),
+                            Set(d, +0.15895005262017969));
+    const V k5 = IfThenElse(is_lo, Set(d, -0.056388144769944137),
+                            Set(d, +0.14618534711831183));
+    const V k6 = IfThenElse(is_lo, Set(d, +0.26617966417208216),
+                            Set(d, -0.19185588225077671));
+    const V k7 = IfThenElse(is_lo, Set(d, +0.17832422462947464),
+                            Set(d, +0.009212822702226604));
+    const V k8 = IfThenElse(is_lo, Set(d, -0.26043017659822243),
+                            Set(d, +0.14989523383975131));
+    const V k9 = IfThenElse(is_lo, Set(d, -0.30785729072603341),
+                            Set(d, -0.11959733440741527));
+    const V k10 = IfThenElse(is_lo, Set(d, +0.29361803081944121),
+                             Set(d, -0.036751712004090005));
+    const V k11 = IfThenElse(is_lo, Set(d, +0.48105032119621),
+                             Set(d, +0.13627123422775761));
+    const V k12 = IfThenElse(is_lo, Set(d, -0.40367438041408138),
+                             Set(d, -0.082022198826911044));
+    const V k13 = IfThenElse(is_lo, Set(d, -0.72010202170516469),
+                             Set(d, -0.05232647334799051));
+    const V k14 = IfThenElse(is_lo, Set(d, +0.65537009023486237),
+                             Set(d, +0.12096048406439959));
+    const V k15 = IfThenElse(is_lo, Set(d, +0.99113156254544021),
+                             Set(d, -0.058100870227599154));
+    const V k16 = IfThenElse(is_lo, Set(d, -0.89039087436653186),
+                             Set(d, -0.062922610822257696));
+    const V k17 = IfThenElse(is_lo, Set(d, -0.99440686216633667),
+                             Set(d, +0.087192245603262664));
+
+    const V u = Sub(t, IfThenElse(is_lo, Set(d, 0.28), Set(d, 0.75)));
+    return Estrin(u, k0, k1, k2, k3, k4, k5, k6, k7, k8, k9, k10, k11, k12, k13,
+                  k14, k15, k16, k17);
+  }
 };
 
 #endif
 
-template <class D, class V, bool kAllowSubnormals = true>
-HWY_INLINE V Log(const D d, V x) {
-  // http://git.musl-libc.org/cgit/musl/tree/src/math/log.c for more info.
+// Splits positive finite 'x' into 2^exp * y, with y in [sqrt(2)/2, sqrt(2)].
+// Returns y and sets 'exp' to the (integer-valued) exponent.
+template <class D, class V, bool kAllowSubnormals>
+HWY_INLINE V LogReduce(const D d, V x, V& exp) {
   using T = TFromD<D>;
   impl::LogImpl<T> impl;
 
   constexpr bool kIsF32 = (sizeof(T) == 4);
 
   // Float Constants
-  const V kLn2Hi = Set(d, kIsF32 ? static_cast<T>(0.69313812256f)
-                                 : static_cast<T>(0.693147180369123816490));
-  const V kLn2Lo = Set(d, kIsF32 ? static_cast<T>(9.0580006145e-6f)
-                                 : static_cast<T>(1.90821492927058770002e-10));
-  const V kOne = Set(d, static_cast<T>(+1.0));
   const V kMinNormal = Set(d, kIsF32 ? static_cast<T>(1.175494351e-38f)
                                      : static_cast<T>(2.2250738585072014e-308));
   const V kScale = Set(d, kIsF32 ? static_cast<T>(3.355443200e+7f)
@@ -911,7 +1563,6 @@ HWY_INLINE V Log(const D d, V x) {
 
   // Scale up 'x' so that it is no longer denormalized.
   VI exp_bits;
-  V exp;
   if (kAllowSubnormals == true) {
     const auto is_denormal = Lt(x, kMinNormal);
     x = IfThenElse(is_denormal, Mul(x, kScale), x);
@@ -929,8 +1580,26 @@ HWY_INLINE V Log(const D d, V x) {
   }
 
   // Renormalize.
-  const V y = Or(And(x, BitCast(d, kLowerBits)),
-                 BitCast(d, Add(And(exp_bits, kManMask), kMagic)));
+  return Or(And(x, BitCast(d, kLowerBits)),
+            BitCast(d, Add(And(exp_bits, kManMask), kMagic)));
+}
+
+// Returns log(2^exp * y) for y in [sqrt(2)/2, sqrt(2)] as computed by
+// LogReduce.
+template <class D, class V>
+HWY_INLINE V LogReconstruct(const D d, V y, V exp) {
+  // http://git.musl-libc.org/cgit/musl/tree/src/math/log.c for more info.
+  using T = TFromD<D>;
+  impl::LogImpl<T> impl;
+
+  constexpr bool kIsF32 = (sizeof(T) == 4);
+
+  // Float Constants
+  const V kLn2Hi = Set(d, kIsF32 ? static_cast<T>(0.69313812256f)
+                                 : static_cast<T>(0.693147180369123816490));
+  const V kLn2Lo = Set(d, kIsF32 ? static_cast<T>(9.0580006145e-6f)
+                                 : static_cast<T>(1.90821492927058770002e-10));
+  const V kOne = Set(d, static_cast<T>(+1.0));
 
   // Approximate and reconstruct.
   const V ym1 = Sub(y, kOne);
@@ -941,6 +1610,117 @@ HWY_INLINE V Log(const D d, V x) {
       Sub(MulSub(z, Sub(ym1, impl.LogPoly(d, z)), Mul(exp, kLn2Lo)), ym1));
 }
 
+template <class D, class V, bool kAllowSubnormals = true>
+HWY_INLINE V Log(const D d, V x) {
+  V exp;
+  const V y = LogReduce<D, V, kAllowSubnormals>(d, x, exp);
+  return LogReconstruct(d, y, exp);
+}
+
+// Returns hi and sets 'lo' such that hi + lo ~= log(x), with a relative error
+// about 2^-12 times that of Log. Requires positive finite 'x'.
+template <class D, class V>
+HWY_INLINE V LogDoubleWord(const D d, V x, V& lo) {
+  using T = TFromD<D>;
+  impl::LogImpl<T> impl;
+
+  constexpr bool kIsF32 = (sizeof(T) == 4);
+
+  // kLn2Part0 has trailing zeros, so its product with the exponent is exact.
+  const V kLn2Part0 =
+      Set(d, kIsF32 ? static_cast<T>(0.693145751953125f)
+                    : static_cast<T>(0.6931471805596629565116018));
+  const V kLn2Part1 =
+      Set(d, kIsF32 ? static_cast<T>(1.428606765330187045e-6f)
+                    : static_cast<T>(0.28235290563031577122588448175e-12));
+  const V kTwoThirdsHi = Set(d, kIsF32 ? static_cast<T>(0.6666666865348816f)
+                                       : static_cast<T>(0.6666666666666666));
+  const V kTwoThirdsLo = Set(d, kIsF32 ? static_cast<T>(-1.9868215517249155e-8f)
+                                       : static_cast<T>(3.700743415417188e-17));
+  const V kOne = Set(d, static_cast<T>(+1.0));
+
+  V exp;
+  const V y = LogReduce<D, V, /*kAllowSubnormals=*/true>(d, x, exp);
+
+  // log(y) = 2 * atanh(z) = 2 * (z + z^3 / 3 + z^5 / 5 + ...), with
+  // z = (y - 1) / (y + 1) computed as the double-word z + z_lo.
+  const V ym1 = Sub(y, kOne);  // Exact.
+  const V yp1 = Add(y, kOne);
+  const V yp1_lo = TwoSumError(y, kOne, yp1);
+  const V z = Div(ym1, yp1);
+  V z_yp1_err;
+  const V z_yp1 = TwoProduct(d, z, yp1, z_yp1_err);
+  const V remainder = Sub(Sub(ym1, z_yp1), z_yp1_err);
+  const V z_lo = Div(NegMulAdd(z, yp1_lo, remainder), yp1);
+
+  // z^2 and 2/3 * z^3 also require double-words; the remaining terms do not.
+  V z2_err, z3_err, t3_err;
+  const V z2 = TwoProduct(d, z, z, z2_err);
+  const V z2_lo = MulAdd(Add(z, z), z_lo, z2_err);
+  const V z3 = TwoProduct(d, z2, z, z3_err);
+  const V z3_lo = MulAdd(z2, z_lo, MulAdd(z2_lo, z, z3_err));
+  const V t3 = TwoProduct(d, z3, kTwoThirdsHi, t3_err);
+  const V t3_lo =
+      MulAdd(z3, kTwoThirdsLo, MulAdd(z3_lo, kTwoThirdsHi, t3_err));
+  const V t5 = Mul(Mul(z3, z2), impl.LogTailPoly(d, z2));
+
+  // Sum from largest to smallest magnitude: exp * log(2) + 2 * z + t3 + t5.
+  const V e_ln2 = Mul(exp, kLn2Part0);
+  const V two_z = Add(z, z);
+  const V sum0 = Add(e_ln2, two_z);
+  V sum_lo = Add(TwoSumError(e_ln2, two_z, sum0),
+                 MulAdd(exp, kLn2Part1, Add(z_lo, z_lo)));
+  const V sum1 = Add(sum0, t3);
+  sum_lo = Add(sum_lo, Add(FastTwoSumError(sum0, t3, sum1), Add(t3_lo, t5)));
+  const V hi = Add(sum1, sum_lo);
+  lo = FastTwoSumError(sum1, sum_lo, hi);
+  return hi;
+}
+
+// Returns e^(hi + lo), where |lo| is at most about ulp(hi). Callers are
+// responsible for handling overflow and underflow.
+template <class D, class V>
+HWY_INLINE V ExpDoubleWord(const D d, V hi, V lo) {
+  using T = TFromD<D>;
+
+  const V kHalf = Set(d, static_cast<T>(+0.5));
+  const V kNegZero = Set(d, static_cast<T>(-0.0));
+  const V kOne = Set(d, static_cast<T>(+1.0));
+  const V kOneOverLog2 = Set(d, static_cast<T>(+1.442695040888963407359924681));
+
+  impl::ExpImpl<T> impl;
+
+  // q = static_cast<int32>((hi / log(2)) + ((hi < 0) ? -0.5 : +0.5))
+  const auto q =
+      impl.ToInt32(d, MulAdd(hi, kOneOverLog2, Or(kHalf, And(hi, kNegZero))));
+
+  // Reduce, approximate, and then reconstruct.
+  const V r = Add(impl.ExpReduce(d, hi, q), lo);
+  return impl.LoadExpShortRange(d, Add(impl.ExpPoly(d, r), kOne), q);
+}
+
+// Returns erfc(x) for x >= 0, computed as t * e^(-x^2 + ErfcPoly(t)) with
+// t = 2 / (2 + x). The exponent is a double-word because x^2 is large.
+template <class D, class V>
+HWY_INLINE V ErfcNonNegative(const D d, V x) {
+  using T = TFromD<D>;
+
+  const V kTwo = Set(d, static_cast<T>(+2.0));
+  const V kLowerBound =
+      Set(d, static_cast<T>((sizeof(T) == 4 ? -104.0 : -1000.0)));
+
+  impl::ErfImpl<T> impl;
+
+  const V t = Div(kTwo, Add(kTwo, x));
+  V x2_lo;
+  const V x2 = TwoProduct(d, x, x, x2_lo);
+  const V poly = impl.ErfcPoly(d, t);
+  const V hi = Sub(poly, x2);
+  const V lo = Sub(TwoSumError(poly, Neg(x2), hi), x2_lo);
+  return IfThenZeroElse(Lt(hi, kLowerBound),
+                        Mul(t, ExpDoubleWord(d, hi, lo)));
+}
+
 }  // namespace impl
 
 template <class D, class V>
@@ -1067,6 +1847,45 @@ HWY_INLINE V Atan(const D d, V x) {
   return Or(IfThenElse(mask, Sub(kPiOverTwo, y), y), sign);
 }
 
+template <class D, class V>
+HWY_INLINE V Atan2(const D d, V y, V x) {
+  using T = TFromD<D>;
+
+  const V kZero = Zero(d);
+  const V kOne = Set(d, static_cast<T>(+1.0));
+  const V kTwo = Set(d, static_cast<T>(+2.0));
+  // kPiOverTwoHi + kPiOverTwoLo ~= pi/2
+  const V kPiOverTwoHi = Set(d, static_cast<T>(+1.57079632679489661923132169));
+  const V kPiOverTwoLo =
+      Set(d, sizeof(T) == 4 ? static_cast<T>(-4.37113883e-8f)
+                            : static_cast<T>(+6.123233995736766e-17));
+
+  const Rebind<MakeSigned<T>, D> di;
+  const auto is_x_neg = RebindMask(d, Lt(BitCast(di, x), Zero(di)));
+  const V sign_y = And(SignBit(d), y);
+  const V abs_x = Abs(x);
+  const V abs_y = Abs(y);
+
+  // Divide the smaller magnitude by the larger so that the quotient is within
+  // [-1, +1]. Equal magnitudes (including zeros and infinities) are exact.
+  const auto swap = Gt(abs_y, abs_x);
+  const V num = IfThenElse(swap, Neg(abs_x), abs_y);
+  const V den = IfThenElse(swap, abs_y, abs_x);
+  const V ratio =
+      IfThenElse(Eq(abs_x, abs_y), IfThenZeroElse(Eq(abs_x, kZero), kOne),
+                 Div(num, den));
+
+  impl::AtanImpl<T> impl;
+  const V z = impl.AtanPoly(d, ratio);
+
+  // Result = k * pi/2 +/- z, where k is the number of quarter turns.
+  const V k = IfThenElse(swap, kOne, IfThenElseZero(is_x_neg, kTwo));
+  const V signed_z = IfThenElse(is_x_neg, Neg(z), z);
+  const V angle =
+      MulAdd(k, kPiOverTwoHi, MulAdd(k, kPiOverTwoLo, signed_z));
+  return Or(angle, sign_y);
+}
+
 template <class D, class V>
 HWY_INLINE V Atanh(const D d, V x) {
   using T = TFromD<D>;
@@ -1080,6 +1899,77 @@ HWY_INLINE V Atanh(const D d, V x) {
              Xor(kHalf, sign));
 }
 
+template <class D, class V>
+HWY_INLINE V Cbrt(const D d, V x) {
+  using T = TFromD<D>;
+  using TI = MakeSigned<T>;
+  const Rebind<TI, D> di;
+  using VI = decltype(Zero(di));
+
+  constexpr bool kIsF32 = (sizeof(T) == 4);
+
+  // Float Constants
+  const V kZero = Zero(d);
+  const V kHalf = Set(d, static_cast<T>(+0.5));
+  const V kOne = Set(d, static_cast<T>(+1.0));
+  const V kTwo = Set(d, static_cast<T>(+2.0));
+  const V kThree = Set(d, static_cast<T>(+3.0));
+  const V kFour = Set(d, static_cast<T>(+4.0));
+  const V kOneThird = Set(d, static_cast<T>(0.333333333333333333333));
+  const V kCbrt2 = Set(d, static_cast<T>(1.25992104989487316476721));
+  const V kCbrt4 = Set(d, static_cast<T>(1.58740105196819947475171));
+  const V kMinNormal = Set(d, kIsF32 ? static_cast<T>(1.175494351e-38f)
+                                     : static_cast<T>(2.2250738585072014e-308));
+  // Subnormals are scaled by 2^(3 * kScaleExp) so that their exponent is exact.
+  const V kScale = Set(d, kIsF32 ? static_cast<T>(16777216.0f)
+                                 : static_cast<T>(1.8014398509481984e+16));
+  const V kScaleExp =
+      Set(d, kIsF32 ? static_cast<T>(-8.0) : static_cast<T>(-18.0));
+
+  // Integer Constants
+  const VI kMantissaMask = Set(di, static_cast<TI>(MantissaMask<T>()));
+  const VI kOneBits = BitCast(di, kOne);
+  const VI kBias =
+      Set(di, kIsF32 ? static_cast<TI>(0x7F) : static_cast<TI>(0x3FF));
+
+  const V abs_x = Abs(x);
+  const V sign_x = Xor(abs_x, x);
+  const auto is_subnormal = Lt(abs_x, kMinNormal);
+  const VI bits =
+      BitCast(di, IfThenElse(is_subnormal, Mul(abs_x, kScale), abs_x));
+
+  // |x| = 2^e * m with m in [1, 2), and e = 3 * k + rem with rem in {0, 1, 2}.
+  const V m = BitCast(d, Or(And(bits, kMantissaMask), kOneBits));
+  const V e = ConvertTo(d, Sub(ShiftRight<MantissaBits<T>()>(bits), kBias));
+  const V k = Floor(Mul(Add(e, kHalf), kOneThird));
+  const V rem = NegMulAdd(k, kThree, e);
+  const auto is_rem1 = Eq(rem, kOne);
+  const auto is_rem2 = Eq(rem, kTwo);
+
+  // cbrt(u) with u = m * 2^rem in [1, 8): polynomial with 1E-4 relative error,
+  // then Halley iterations, each of which triples the number of correct bits.
+  const V u =
+      Mul(m, IfThenElse(is_rem1, kTwo, IfThenElse(is_rem2, kFour, kOne)));
+  const V poly = impl::Estrin(Sub(m, Set(d, static_cast<T>(1.5))),
+                              Set(d, static_cast<T>(1.14479184)),
+                              Set(d, static_cast<T>(0.254342735)),
+                              Set(d, static_cast<T>(-0.0589933135)),
+                              Set(d, static_cast<T>(0.0221486986)));
+  V c = Mul(poly,
+            IfThenElse(is_rem1, kCbrt2, IfThenElse(is_rem2, kCbrt4, kOne)));
+  for (int i = 0; i < (kIsF32 ? 1 : 2); ++i) {
+    const V c3 = Mul(Mul(c, c), c);
+    c = NegMulAdd(c, Div(Sub(c3, u), MulAdd(kTwo, c3, u)), c);
+  }
+
+  // Reconstruct, and return zero, infinity and NaN unchanged.
+  impl::ExpImpl<T> exp_impl;
+  const V scale = exp_impl.Pow2I(
+      d, exp_impl.ToInt32(d, Add(k, IfThenElseZero(is_subnormal, kScaleExp))));
+  const V y = Or(Mul(c, scale), sign_x);
+  return IfThenElse(And(IsFinite(x), Ne(x, kZero)), y, x);
+}
+
 template <class D, class V>
 HWY_INLINE V Cos(const D d, V x) {
   using T = TFromD<D>;
@@ -1103,6 +1993,29 @@ HWY_INLINE V Cos(const D d, V x) {
       d, Xor(impl.CosReduce(d, y, q), impl.CosSignFromQuadrant(d, q)));
 }
 
+template <class D, class V>
+HWY_INLINE V Erf(const D d, V x) {
+  using T = TFromD<D>;
+  const V kOne = Set(d, static_cast<T>(+1.0));
+
+  impl::ErfImpl<T> impl;
+
+  const V abs_x = Abs(x);
+  const V sign_x = Xor(abs_x, x);
+  const V small = MulAdd(impl.ErfPoly(d, Mul(abs_x, abs_x)), abs_x, abs_x);
+  const V large = Sub(kOne, impl::ErfcNonNegative(d, abs_x));
+  return Or(IfThenElse(Lt(abs_x, kOne), small, large), sign_x);
+}
+
+template <class D, class V>
+HWY_INLINE V Erfc(const D d, V x) {
+  using T = TFromD<D>;
+  const V kTwo = Set(d, static_cast<T>(+2.0));
+
+  const V y = impl::ErfcNonNegative(d, Abs(x));
+  return IfThenElse(Lt(x, Zero(d)), Sub(kTwo, y), y);  // erfc(-x) = 2 - erfc(x)
+}
+
 template <class D, class V>
 HWY_INLINE V Exp(const D d, V x) {
   using T = TFromD<D>;
@@ -1126,6 +2039,55 @@ HWY_INLINE V Exp(const D d, V x) {
   return IfThenElseZero(Ge(x, kLowerBound), y);
 }
 
+template <class D, class V>
+HWY_INLINE V Exp2(const D d, V x) {
+  using T = TFromD<D>;
+
+  const V kLowerBound =
+      Set(d, static_cast<T>((sizeof(T) == 4 ? -150.0 : -1075.0)));
+  const V kOne = Set(d, static_cast<T>(+1.0));
+  const V kLog2 = Set(d, static_cast<T>(+0.693147180559945309417232121458));
+
+  impl::ExpImpl<T> impl;
+
+  // x = q + r, with integer q and r in [-0.5, +0.5].
+  const V qf = Round(x);
+  const auto q = impl.ToInt32(d, qf);
+
+  // 2^r = e^(r * log(2)); approximate and then reconstruct.
+  const V y = impl.LoadExpShortRange(
+      d, Add(impl.ExpPoly(d, Mul(Sub(x, qf), kLog2)), kOne), q);
+  return IfThenElseZero(Ge(x, kLowerBound), y);
+}
+
+template <class D, class V>
+HWY_INLINE void ExpAndExpm1(const D d, V x, V& exp, V& expm1) {
+  using T = TFromD<D>;
+
+  const V kHalf = Set(d, static_cast<T>(+0.5));
+  const V kLowerBound =
+      Set(d, static_cast<T>((sizeof(T) == 4 ? -104.0 : -1000.0)));
+  const V kLn2Over2 = Set(d, static_cast<T>(+0.346573590279972654708616));
+  const V kNegOne = Set(d, static_cast<T>(-1.0));
+  const V kNegZero = Set(d, static_cast<T>(-0.0));
+  const V kOne = Set(d, static_cast<T>(+1.0));
+  const V kOneOverLog2 = Set(d, static_cast<T>(+1.442695040888963407359924681));
+
+  impl::ExpImpl<T> impl;
+
+  // q = static_cast<int32>((x / log(2)) + ((x < 0) ? -0.5 : +0.5))
+  const auto q =
+      impl.ToInt32(d, MulAdd(x, kOneOverLog2, Or(kHalf, And(x, kNegZero))));
+
+  // Reduce and approximate once, then reconstruct both results.
+  const V y = impl.ExpPoly(d, impl.ExpReduce(d, x, q));
+  const V e = impl.LoadExpShortRange(d, Add(y, kOne), q);
+  const auto is_lower = Lt(x, kLowerBound);
+  exp = IfThenZeroElse(is_lower, e);
+  expm1 = IfThenElse(is_lower, kNegOne,
+                     IfThenElse(Lt(Abs(x), kLn2Over2), y, Sub(e, kOne)));
+}
+
 template <class D, class V>
 HWY_INLINE V Expm1(const D d, V x) {
   using T = TFromD<D>;
@@ -1152,6 +2114,154 @@ HWY_INLINE V Expm1(const D d, V x) {
   return IfThenElse(Lt(x, kLowerBound), kNegOne, z);
 }
 
+template <FastPrecision kPrecision, class D, class V>
+HWY_INLINE V FastExp(const D d, V x) {
+  using T = TFromD<D>;
+  using TI = MakeSigned<T>;
+  const Rebind<TI, D> di;
+
+  constexpr bool kIsF32 = (sizeof(T) == 4);
+  constexpr int kMantissaBits = MantissaBits<T>();
+
+  // 2^t * [sqrt(2)/2, sqrt(2)] is normal for t within these bounds.
+  const V kLowerBound = Set(d, static_cast<T>(kIsF32 ? -125.0 : -1021.0));
+  const V kUpperBound = Set(d, static_cast<T>(kIsF32 ? 127.0 : 1023.0));
+  const V kLog2e = Set(d, static_cast<T>(+1.442695040888963407359924681));
+  // Adding 1.5 * 2^kMantissaBits rounds to an integer, which is then in the
+  // lower mantissa bits.
+  const V kRound = Set(d, static_cast<T>(kIsF32 ? 12582912.0
+                                                : 6755399441055744.0));
+
+  // e^x = 2^t = 2^q * 2^f, with integer q and f in [-0.5, +0.5].
+  const V t = Mul(x, kLog2e);
+  const V clamped = Min(t, kUpperBound);
+  const V rounded = Add(clamped, kRound);
+  const V q = Sub(rounded, kRound);
+  V poly;
+  if (kPrecision == FastPrecision::kPrecise) {
+    // The rounding error of t would be amplified by q, hence compute
+    // x - q * ln(2) with ln(2) split into two parts, as in Exp.
+    const V kNegLn2Part0 =
+        Set(d, kIsF32 ? static_cast<T>(-0.693145751953125f)
+                      : static_cast<T>(-0.6931471805596629565116018));
+    const V kNegLn2Part1 =
+        Set(d, kIsF32 ? static_cast<T>(-1.428606765330187045e-6f)
+                      : static_cast<T>(-0.28235290563031577122588448175e-12));
+    const V r = MulAdd(q, kNegLn2Part1, MulAdd(q, kNegLn2Part0, x));
+    poly = Add(impl::ExpImpl<T>().ExpPoly(d, r), Set(d, static_cast<T>(1.0)));
+  } else {
+    poly = impl::FastImpl<T>().Exp2Poly(d, Sub(clamped, q));
+  }
+
+  // Add q to the exponent. The shift discards the upper bits of 'rounded'.
+  const V y = BitCast(d, Add(BitCast(di, poly),
+                             ShiftLeft<kMantissaBits>(BitCast(di, rounded))));
+  return IfThenZeroElse(Lt(t, kLowerBound), y);
+}
+
+template <FastPrecision kPrecision, class D, class V>
+HWY_INLINE V FastLog(const D d, V x) {
+  using T = TFromD<D>;
+  using TI = MakeSigned<T>;
+  const Rebind<TI, D> di;
+  using VI = decltype(Zero(di));
+
+  constexpr bool kIsF32 = (sizeof(T) == 4);
+  constexpr int kMantissaBits = MantissaBits<T>();
+
+  // Bits of sqrt(2)/2.
+  const VI kMagic = Set(di, kIsF32 ? static_cast<TI>(0x3F3504F3L)
+                                   : static_cast<TI>(0x3FE6A09E667F3BCDLL));
+
+  // x = 2^e * m with m in [sqrt(2)/2, sqrt(2)), computed with integer ops.
+  const VI bits = BitCast(di, x);
+  const VI e = ShiftRight<kMantissaBits>(Sub(bits, kMagic));
+  const V m = BitCast(d, Sub(bits, ShiftLeft<kMantissaBits>(e)));
+
+  if (kPrecision == FastPrecision::kPrecise) {
+    return impl::LogReconstruct(d, m, ConvertTo(d, e));
+  }
+  const V kLn2 = Set(d, static_cast<T>(+0.693147180559945309417232121458));
+  return MulAdd(ConvertTo(d, e), kLn2, impl::FastImpl<T>().LogPoly(d, m));
+}
+
+template <FastPrecision kPrecision, class D, class V>
+HWY_INLINE V FastSigmoid(const D d, V x) {
+  using T = TFromD<D>;
+  const V kOne = Set(d, static_cast<T>(+1.0));
+
+  // As in Sigmoid, but with FastExp.
+  const V e = FastExp<kPrecision>(d, Neg(Abs(x)));
+  const V recip = Div(kOne, Add(kOne, e));
+  return IfThenElse(Lt(x, Zero(d)), Mul(e, recip), recip);
+}
+
+template <FastPrecision kPrecision, class D, class V>
+HWY_INLINE V FastTanh(const D d, V x) {
+  using T = TFromD<D>;
+  const V kOne = Set(d, static_cast<T>(+1.0));
+  const V kTwo = Set(d, static_cast<T>(+2.0));
+
+  const V sign = And(SignBit(d), x);  // Extract the sign bit
+  const V abs_x = Xor(x, sign);
+
+  V z;
+  if (kPrecision == FastPrecision::kPrecise) {
+    // As in Tanh: tanh(x) = y / (y + 2) with y = e^2x - 1, which is more
+    // accurate than FastExp minus one for small x.
+    const V kLimit = Set(d, static_cast<T>(18.714973875));
+    const V kLn2Over2 = Set(d, static_cast<T>(+0.346573590279972654708616));
+    const V two_x = Mul(abs_x, kTwo);
+    const V y =
+        IfThenElse(Lt(two_x, kLn2Over2), impl::ExpImpl<T>().ExpPoly(d, two_x),
+                   Sub(FastExp<kPrecision>(d, two_x), kOne));
+    z = IfThenElse(Gt(abs_x, kLimit), kOne, Div(y, Add(y, kTwo)));
+  } else {
+    // Polynomial for small |x|, where 1 - 2 / (e^2x + 1) would cancel.
+    const V kSmall = Set(d, static_cast<T>(0.625));
+    const V small =
+        Mul(abs_x, impl::FastImpl<T>().TanhPoly(d, Mul(abs_x, abs_x)));
+    const V large =
+        Sub(kOne, Div(kTwo, Add(FastExp(d, Mul(abs_x, kTwo)), kOne)));
+    z = IfThenElse(Lt(abs_x, kSmall), small, large);
+  }
+  return Xor(z, sign);  // Reapply the sign bit
+}
+
+template <class D, class V>
+HWY_INLINE V Hypot(const D d, V x, V y) {
+  using T = TFromD<D>;
+
+  constexpr bool kIsF32 = (sizeof(T) == 4);
+
+  // Inputs with a large or small maximum are scaled by powers of two such that
+  // the sum of squares neither overflows nor underflows.
+  const V kLarge = Set(d, kIsF32 ? static_cast<T>(1.125899906842624e15)
+                                 : static_cast<T>(3.2733906078961419e150));
+  const V kSmall = Set(d, kIsF32 ? static_cast<T>(8.8817841970012523e-16)
+                                 : static_cast<T>(3.0549363634996047e-151));
+  const V kScaleDown = Set(d, kIsF32 ? static_cast<T>(8.0779356694631609e-28)
+                                     : static_cast<T>(2.4099198651028841e-181));
+  const V kScaleUp = Set(d, kIsF32 ? static_cast<T>(1.2379400392853803e27)
+                                   : static_cast<T>(4.1495155688809929e180));
+  const V kOne = Set(d, static_cast<T>(+1.0));
+
+  const V max = Max(Abs(x), Abs(y));
+  const auto is_large = Gt(max, kLarge);
+  const auto is_small = Lt(max, kSmall);
+  const V scale =
+      IfThenElse(is_large, kScaleDown, IfThenElse(is_small, kScaleUp, kOne));
+  const V unscale =
+      IfThenElse(is_large, kScaleUp, IfThenElse(is_small, kScaleDown, kOne));
+
+  const V scaled_x = Mul(x, scale);
+  const V scaled_y = Mul(y, scale);
+  const V h =
+      Mul(Sqrt(MulAdd(scaled_x, scaled_x, Mul(scaled_y, scaled_y))), unscale);
+  // hypot(inf, NaN) is inf.
+  return IfThenElse(Or(IsInf(x), IsInf(y)), Inf(d), h);
+}
+
 template <class D, class V>
 HWY_INLINE V Log(const D d, V x) {
   return impl::Log<D, V, /*kAllowSubnormals=*/true>(d, x);
@@ -1182,6 +2292,71 @@ HWY_INLINE V Log2(const D d, V x) {
   return Mul(Log(d, x), Set(d, static_cast<T>(1.44269504088896340735992)));
 }
 
+template <class D, class V>
+HWY_INLINE void LogAndLogb(const D d, V x, V& log, V& logb) {
+  using T = TFromD<D>;
+  const V kOne = Set(d, static_cast<T>(+1.0));
+
+  V exp;
+  const V y = impl::LogReduce<D, V, /*kAllowSubnormals=*/true>(d, x, exp);
+  log = impl::LogReconstruct(d, y, exp);
+  // y is in [sqrt(2)/2, sqrt(2)], hence the exponent is one less if y < 1.
+  logb = IfThenElse(Lt(y, kOne), Sub(exp, kOne), exp);
+}
+
+template <class D, class V>
+HWY_INLINE V Pow(const D d, V x, V y) {
+  using T = TFromD<D>;
+
+  const V kZero = Zero(d);
+  const V kHalf = Set(d, static_cast<T>(+0.5));
+  const V kOne = Set(d, static_cast<T>(+1.0));
+  const V kNegOne = Set(d, static_cast<T>(-1.0));
+  const V kInf = Inf(d);
+  const V kBound = Set(d, static_cast<T>((sizeof(T) == 4 ? 104.0 : 1000.0)));
+
+  // x^y = e^(y * log|x|). The product can be large, so it and log|x| are
+  // double-words, otherwise the error would grow with the magnitude of y.
+  const V abs_x = Abs(x);
+  V log_lo;
+  V log_hi = impl::LogDoubleWord(d, abs_x, log_lo);
+  log_hi = IfThenElse(Eq(abs_x, kZero), Neg(kInf), log_hi);
+  log_hi = IfThenElse(IsInf(x), kInf, log_hi);
+  V t_err;
+  const V t_hi = impl::TwoProduct(d, y, log_hi, t_err);
+  const V t_lo = MulAdd(y, log_lo, t_err);
+  V z = impl::ExpDoubleWord(d, t_hi, t_lo);
+  z = IfThenElse(Gt(t_hi, kBound), kInf,
+                 IfThenZeroElse(Lt(t_hi, Neg(kBound)), z));
+
+  // Negative x: the result is negative for odd integer y, and NaN for
+  // non-integer y unless x is -inf.
+  const auto is_int = Eq(Round(y), y);
+  const V half_y = Mul(y, kHalf);
+  const auto is_odd = AndNot(Eq(Round(half_y), half_y), is_int);
+  z = Xor(z, IfThenElseZero(is_odd, And(SignBit(d), x)));
+  z = IfThenElse(And(Lt(x, kZero), AndNot(is_int, IsFinite(x))), NaN(d), z);
+
+  // NaN inputs propagate, except that pow(x, 0), pow(1, y) and pow(-1, inf)
+  // are 1.
+  z = IfThenElse(Or(IsNaN(x), IsNaN(y)), Add(x, y), z);
+  const auto is_one = Or(Or(Eq(y, kZero), Eq(x, kOne)),
+                         And(Eq(x, kNegOne), IsInf(y)));
+  return IfThenElse(is_one, kOne, z);
+}
+
+template <class D, class V>
+HWY_INLINE V Sigmoid(const D d, V x) {
+  using T = TFromD<D>;
+  const V kOne = Set(d, static_cast<T>(+1.0));
+
+  // With e = e^-|x| in (0, 1], which neither overflows nor loses precision,
+  // sigmoid(|x|) = 1 / (1 + e) and sigmoid(-|x|) = e / (1 + e).
+  const V e = Exp(d, Neg(Abs(x)));
+  const V recip = Div(kOne, Add(kOne, e));
+  return IfThenElse(Lt(x, Zero(d)), Mul(e, recip), recip);
+}
+
 template <class D, class V>
 HWY_INLINE V Sin(const D d, V x) {
   using T = TFromD<D>;
@@ -1206,6 +2381,43 @@ HWY_INLINE V Sin(const D d, V x) {
                           Xor(impl.SinSignFromQuadrant(d, q), sign_x)));
 }
 
+template <class D, class V>
+HWY_INLINE void SinCos(const D d, V x, V& s, V& c) {
+  using T = TFromD<D>;
+  impl::CosSinImpl<T> impl;
+
+  // Float Constants
+  const V kTwoOverPi = Set(d, static_cast<T>(0.63661977236758134308));
+  const V kHalf = Set(d, static_cast<T>(0.5));
+
+  // Integer Constants
+  const Rebind<int32_t, D> di32;
+  using VI32 = decltype(Zero(di32));
+  const VI32 kOne = Set(di32, 1);
+  const VI32 kTwo = Set(di32, 2);
+  const Rebind<MakeSigned<T>, D> di;
+
+  const V abs_x = Abs(x);
+  const V sign_x = Xor(abs_x, x);
+
+  // Compute the quadrant, q = int((|x| * 2 / pi) + 0.5), and reduce the range
+  // to [-pi/4, +pi/4], where both polynomials are short.
+  const VI32 q = impl.ToInt32(d, MulAdd(abs_x, kTwoOverPi, kHalf));
+  const V r = impl.CosReduce(d, abs_x, q);
+  const V sin_r = impl.SinPoly(d, r);
+  const V cos_r = impl.CosPoly(d, r);
+
+  // Odd quadrants swap sine and cosine. Sine is negated in quadrants 2 and 3
+  // (mod 4), and cosine in quadrants 1 and 2. CosSignFromQuadrant(q) is
+  // negative if (q & 2) == 0, hence these offsets.
+  const auto is_odd = RebindMask(
+      d, Lt(BitCast(di, impl.SinSignFromQuadrant(d, q)), Zero(di)));
+  const V sign_s = impl.CosSignFromQuadrant(d, Add(q, kTwo));
+  const V sign_c = impl.CosSignFromQuadrant(d, Add(q, Add(kTwo, kOne)));
+  s = Xor(IfThenElse(is_odd, cos_r, sin_r), Xor(sign_s, sign_x));
+  c = Xor(IfThenElse(is_odd, sin_r, cos_r), sign_c);
+}
+
 template <class D, class V>
 HWY_INLINE V Sinh(const D d, V x) {
   using T = TFromD<D>;
@@ -1220,6 +2432,34 @@ HWY_INLINE V Sinh(const D d, V x) {
   return Xor(z, sign);  // Reapply the sign bit
 }
 
+template <class D, class V>
+HWY_INLINE V Tan(const D d, V x) {
+  using T = TFromD<D>;
+  impl::CosSinImpl<T> impl;
+
+  // Float Constants
+  const V kTwoOverPi = Set(d, static_cast<T>(0.63661977236758134308));
+  const V kHalf = Set(d, static_cast<T>(0.5));
+  const V kNegZero = Set(d, static_cast<T>(-0.0));
+  const V kNegOne = Set(d, static_cast<T>(-1.0));
+
+  // Integer Constants
+  const Rebind<int32_t, D> di32;
+  using VI32 = decltype(Zero(di32));
+  const Rebind<MakeSigned<T>, D> di;
+
+  // Compute the quadrant, q = int((x * 2 / pi) + ((x < 0) ? -0.5 : +0.5))
+  const VI32 q =
+      impl.ToInt32(d, MulAdd(x, kTwoOverPi, Or(kHalf, And(x, kNegZero))));
+
+  // Reduce range to [-pi/4, +pi/4] and approximate. For odd quadrants,
+  // tan(x) = -1 / tan(x - q * pi/2).
+  const V y = impl.TanPoly(d, impl.CosReduce(d, x, q));
+  const auto is_odd = RebindMask(
+      d, Lt(BitCast(di, impl.SinSignFromQuadrant(d, q)), Zero(di)));
+  return IfThenElse(is_odd, Div(kNegOne, y), y);
+}
+
 template <class D, class V>
 HWY_INLINE V Tanh(const D d, V x) {
   using T = TFromD<D>;
@@ -0,0 +1,603 @@
+// Copyright 2022 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hwy/contrib/math/math.h"
+
+#include <stddef.h>
+
+#include <cmath>
+
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "hwy/contrib/math/math.cc"
+#include "hwy/foreach_target.h"  // IWYU pragma: keep
+
+// After foreach_target
+#include "hwy/contrib/math/math-inl.h"
+#include "hwy/highway.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+namespace {
+
+// Sets `out[i] = func(d, in[i])` for i in [0, n). The main loop handles two
+// vectors per iteration, so that their (long) dependency chains overlap.
+template <class D, class Func, typename T = TFromD<D>>
+HWY_INLINE void MathArray(D d, const T* in, T* out, size_t n,
+                          const Func& func) {
+  const size_t N = Lanes(d);
+
+  size_t i = 0;
+  if (n >= 2 * N) {
+    for (; i <= n - 2 * N; i += 2 * N) {
+      const Vec<D> v0 = LoadU(d, in + i);
+      const Vec<D> v1 = LoadU(d, in + i + N);
+      StoreU(func(d, v0), d, out + i);
+      StoreU(func(d, v1), d, out + i + N);
+    }
+  }
+  for (; i + N <= n; i += N) {
+    StoreU(func(d, LoadU(d, in + i)), d, out + i);
+  }
+
+  // `n` was a multiple of the vector length `N`: already done.
+  if (HWY_UNLIKELY(i == n)) return;
+
+#if HWY_MEM_OPS_MIGHT_FAULT
+  // Proceed one by one.
+  const CappedTag<T, 1> d1;
+  for (; i < n; ++i) {
+    StoreU(func(d1, LoadU(d1, in + i)), d1, out + i);
+  }
+#else
+  const Mask<D> mask = FirstN(d, n - i);
+  const Vec<D> v = MaskedLoad(mask, d, in + i);
+  BlendedStore(func(d, v), mask, d, out + i);
+#endif
+}
+
+// As MathArray, but `func(d, v, out0, out1)` has two outputs, which are
+// stored to `out0[i]` and `out1[i]`. Both inputs are loaded before storing
+// either output, so `out0` or `out1` may equal `in`.
+template <class D, class Func, typename T = TFromD<D>>
+HWY_INLINE void MathArray2(D d, const T* in, T* out0, T* out1, size_t n,
+                           const Func& func) {
+  const size_t N = Lanes(d);
+  Vec<D> v0, v1, v2, v3;
+
+  size_t i = 0;
+  if (n >= 2 * N) {
+    for (; i <= n - 2 * N; i += 2 * N) {
+      const Vec<D> in0 = LoadU(d, in + i);
+      const Vec<D> in1 = LoadU(d, in + i + N);
+      func(d, in0, v0, v1);
+      func(d, in1, v2, v3);
+      StoreU(v0, d, out0 + i);
+      StoreU(v1, d, out1 + i);
+      StoreU(v2, d, out0 + i + N);
+      StoreU(v3, d, out1 + i + N);
+    }
+  }
+  for (; i + N <= n; i += N) {
+    func(d, LoadU(d, in + i), v0, v1);
+    StoreU(v0, d, out0 + i);
+    StoreU(v1, d, out1 + i);
+  }
+
+  // `n` was a multiple of the vector length `N`: already done.
+  if (HWY_UNLIKELY(i == n)) return;
+
+#if HWY_MEM_OPS_MIGHT_FAULT
+  // Proceed one by one.
+  const CappedTag<T, 1> d1;
+  Vec<decltype(d1)> v0_1, v1_1;
+  for (; i < n; ++i) {
+    func(d1, LoadU(d1, in + i), v0_1, v1_1);
+    StoreU(v0_1, d1, out0 + i);
+    StoreU(v1_1, d1, out1 + i);
+  }
+#else
+  const Mask<D> mask = FirstN(d, n - i);
+  func(d, MaskedLoad(mask, d, in + i), v0, v1);
+  BlendedStore(v0, mask, d, out0 + i);
+  BlendedStore(v1, mask, d, out1 + i);
+#endif
+}
+
+// Scalar fallback for Sigmoid, which is not in the standard library.
+HWY_INLINE double ScalarSigmoid(double x) { return 1.0 / (1.0 + std::exp(-x)); }
+
+// Targets without double-precision vectors fall back to the standard library.
+template <class Func>
+HWY_INLINE void MathArrayF64(const double* in, double* out, size_t n,
+                             const Func& func, double (*std_func)(double)) {
+#if HWY_HAVE_FLOAT64
+  (void)std_func;
+  MathArray(ScalableTag<double>(), in, out, n, func);
+#else
+  (void)func;
+  for (size_t i = 0; i < n; ++i) {
+    out[i] = std_func(in[i]);
+  }
+#endif
+}
+
+// Demotes to bfloat16_t, rounding to nearest even rather than truncating as
+// DemoteTo does. This halves the error of the half-precision results.
+template <class DF>
+HWY_INLINE Vec<Rebind<bfloat16_t, DF>> DemoteNearest(
+    DF df, Rebind<bfloat16_t, DF> dbf16, Vec<DF> v) {
+  const RebindToUnsigned<DF> du32;
+  const Vec<decltype(du32)> bits = BitCast(du32, v);
+  const Vec<decltype(du32)> odd = And(ShiftRight<16>(bits), Set(du32, 1));
+  const Vec<decltype(du32)> rounded = Add(bits, Add(Set(du32, 0x7FFF), odd));
+  // NaN may carry into the exponent or sign; those are truncated instead.
+  return DemoteTo(dbf16, IfThenElse(IsNaN(v), v, BitCast(df, rounded)));
+}
+
+// Demotes to float16_t, rounding to nearest even. Hardware conversions already
+// do so, but the emulated DemoteTo truncates.
+template <class DF>
+HWY_INLINE Vec<Rebind<float16_t, DF>> DemoteNearest(DF df,
+                                                    Rebind<float16_t, DF> df16,
+                                                    Vec<DF> v) {
+#if (HWY_ARCH_X86 && HWY_TARGET <= HWY_AVX2 && !defined(HWY_DISABLE_F16C)) || \
+    HWY_ARCH_ARM_A64 || HWY_TARGET == HWY_RVV
+  (void)df;
+  return DemoteTo(df16, v);
+#else
+  const RebindToSigned<DF> di32;
+  const RebindToUnsigned<decltype(df16)> du16;
+  using VI = Vec<decltype(di32)>;
+  const VI bits = BitCast(di32, v);
+  const VI abs_bits = And(bits, Set(di32, 0x7FFFFFFF));
+  const VI sign16 = And(ShiftRight<16>(bits), Set(di32, 0x8000));
+
+  // Below 2^-14, the result is subnormal or zero: adding 0.5 makes the FPU
+  // round the mantissa at 2^-24.
+  const Vec<DF> k0_5 = Set(df, 0.5f);
+  const VI subnormal = Sub(BitCast(di32, Add(BitCast(df, abs_bits), k0_5)),
+                           BitCast(di32, k0_5));
+  // Normal: rebias the exponent, then round at bit 13. Adding 0xFFF plus the
+  // lowest kept bit rounds ties to even, and may carry into the exponent.
+  const VI odd = And(ShiftRight<13>(abs_bits), Set(di32, 1));
+  const VI rebias = Set(di32, 0xFFF - ((127 - 15) << 23));
+  const VI normal = ShiftRight<13>(Add(Add(abs_bits, rebias), odd));
+  // At least 2^16 overflows to infinity; NaN becomes the canonical quiet NaN.
+  const VI inf_nan = IfThenElse(Gt(abs_bits, Set(di32, 0x7F800000)),
+                                Set(di32, 0x7E00), Set(di32, 0x7C00));
+
+  VI bits16 =
+      IfThenElse(Lt(abs_bits, Set(di32, (127 - 14) << 23)), subnormal, normal);
+  bits16 = IfThenElse(Gt(abs_bits, Set(di32, ((127 + 16) << 23) - 1)), inf_nan,
+                      bits16);
+  bits16 = Or(bits16, sign16);
+  return BitCast(df16, DemoteTo(du16, bits16));
+#endif
+}
+
+// Promotes to float32. bfloat16_t conversions are exact on all targets.
+template <class DF>
+HWY_INLINE Vec<DF> PromoteHalf(DF df, Vec<Rebind<bfloat16_t, DF>> v) {
+  return PromoteTo(df, v);
+}
+
+// Promotes to float32. The emulated PromoteTo treats the maximum exponent as
+// finite, so infinity and NaN are converted here.
+template <class DF>
+HWY_INLINE Vec<DF> PromoteHalf(DF df, Vec<Rebind<float16_t, DF>> v) {
+#if (HWY_ARCH_X86 && HWY_TARGET <= HWY_AVX2 && !defined(HWY_DISABLE_F16C)) || \
+    HWY_ARCH_ARM_A64 || HWY_TARGET == HWY_RVV
+  return PromoteTo(df, v);
+#else
+  const RebindToSigned<DF> di32;
+  const Rebind<uint16_t, DF> du16;
+  using VI = Vec<decltype(di32)>;
+  const VI bits = PromoteTo(di32, BitCast(du16, v));
+  const VI abs_bits = And(bits, Set(di32, 0x7FFF));
+  // Infinity or NaN: set all exponent bits and keep the mantissa.
+  const VI sign32 = ShiftLeft<16>(And(bits, Set(di32, 0x8000)));
+  const VI mantissa32 = ShiftLeft<13>(And(bits, Set(di32, 0x3FF)));
+  const VI inf_nan = Or(Or(sign32, Set(di32, 0x7F800000)), mantissa32);
+  return IfThenElse(RebindMask(df, Gt(abs_bits, Set(di32, 0x7BFF))),
+                    BitCast(df, inf_nan), PromoteTo(df, v));
+#endif
+}
+
+// Sets `out[i] = func(df, in[i])` for float16_t or bfloat16_t `in` and `out`,
+// evaluating `func` on promoted f32 vectors. Otherwise as MathArray.
+template <class DF, class Func, typename T16>
+HWY_INLINE void MathArrayHalf(DF df, const T16* in, T16* out, size_t n,
+                              const Func& func) {
+  const Rebind<T16, DF> d16;
+  const size_t N = Lanes(df);
+
+  size_t i = 0;
+  if (n >= 2 * N) {
+    for (; i <= n - 2 * N; i += 2 * N) {
+      const Vec<DF> v0 = PromoteHalf(df, LoadU(d16, in + i));
+      const Vec<DF> v1 = PromoteHalf(df, LoadU(d16, in + i + N));
+      StoreU(DemoteNearest(df, d16, func(df, v0)), d16, out + i);
+      StoreU(DemoteNearest(df, d16, func(df, v1)), d16, out + i + N);
+    }
+  }
+  for (; i + N <= n; i += N) {
+    const Vec<DF> v = PromoteHalf(df, LoadU(d16, in + i));
+    StoreU(DemoteNearest(df, d16, func(df, v)), d16, out + i);
+  }
+
+  // `n` was a multiple of the vector length `N`: already done.
+  if (HWY_UNLIKELY(i == n)) return;
+
+  // HWY_SCALAR lacks MaskedLoad of 16-bit floats, but never reaches here.
+#if HWY_MEM_OPS_MIGHT_FAULT || HWY_TARGET == HWY_SCALAR
+  // Proceed one by one.
+  const CappedTag<float, 1> d1;
+  const Rebind<T16, decltype(d1)> d16_1;
+  for (; i < n; ++i) {
+    const Vec<decltype(d1)> v = PromoteHalf(d1, LoadU(d16_1, in + i));
+    StoreU(DemoteNearest(d1, d16_1, func(d1, v)), d16_1, out + i);
+  }
+#else
+  const Mask<decltype(d16)> mask = FirstN(d16, n - i);
+  const Vec<DF> v = PromoteHalf(df, MaskedLoad(mask, d16, in + i));
+  BlendedStore(DemoteNearest(df, d16, func(df, v)), mask, d16, out + i);
+#endif
+}
+
+#if !HWY_HAVE_FLOAT16
+
+// Scalar conversions for targets without float16_t vectors.
+float F32FromF16(float16_t f16) {
+  uint16_t bits16;
+  CopySameSize(&f16, &bits16);
+  const uint32_t sign = static_cast<uint32_t>(bits16 >> 15);
+  const uint32_t biased_exp = (bits16 >> 10) & 0x1F;
+  const uint32_t mantissa = bits16 & 0x3FF;
+
+  // Subnormal or zero
+  if (biased_exp == 0) {
+    const float subnormal =
+        (1.0f / 16384) * (static_cast<float>(mantissa) * (1.0f / 1024));
+    return sign ? -subnormal : subnormal;
+  }
+
+  // Normalized, infinity or NaN: only the exponent bias changes.
+  const uint32_t biased_exp32 =
+      biased_exp == 0x1F ? 0xFF : biased_exp + (127 - 15);
+  const uint32_t bits32 =
+      (sign << 31) | (biased_exp32 << 23) | (mantissa << 13);
+  float f32;
+  CopySameSize(&bits32, &f32);
+  return f32;
+}
+
+// Rounds to nearest even, as does DemoteTo on other targets.
+float16_t F16FromF32(float f32) {
+  uint32_t bits32;
+  CopySameSize(&f32, &bits32);
+  const uint32_t sign = bits32 >> 31;
+  const uint32_t biased_exp32 = (bits32 >> 23) & 0xFF;
+  const uint32_t mantissa32 = bits32 & 0x7FFFFF;
+  const int exp = static_cast<int>(biased_exp32) - 127;
+
+  uint32_t bits16;
+  if (biased_exp32 == 0xFF) {  // Infinity or NaN
+    bits16 = 0x7C00 | (mantissa32 != 0 ? 0x200 : 0);
+  } else if (exp > 15) {  // Overflow
+    bits16 = 0x7C00;
+  } else if (exp >= -25) {
+    // Normal: keep the upper 10 mantissa bits. Subnormal: also shift in the
+    // implicit leading 1. Rounding may carry into the exponent, as intended.
+    const bool is_normal = exp >= -14;
+    const uint32_t full = is_normal ? mantissa32 : (mantissa32 | 0x800000);
+    const int shift = is_normal ? 13 : -exp - 1;
+    const uint32_t half = 1u << (shift - 1);
+    const uint32_t rem = full & ((1u << shift) - 1);
+    bits16 = (is_normal ? static_cast<uint32_t>(exp + 15) << 10 : 0u) +
+             (full >> shift);
+    if (rem > half || (rem == half && (bits16 & 1))) ++bits16;
+  } else {  // Underflow
+    bits16 = 0;
+  }
+
+  const uint16_t bits = static_cast<uint16_t>(bits16 | (sign << 15));
+  float16_t f16;
+  CopySameSize(&bits, &f16);
+  return f16;
+}
+
+template <class DF, class Func>
+HWY_INLINE void MathArrayHalf(DF /*df*/, const float16_t* in, float16_t* out,
+                              size_t n, const Func& func) {
+  const CappedTag<float, 1> d1;
+  for (size_t i = 0; i < n; ++i) {
+    out[i] = F16FromF32(GetLane(func(d1, Set(d1, F32FromF16(in[i])))));
+  }
+}
+
+#endif  // !HWY_HAVE_FLOAT16
+
+}  // namespace
+
+// For each function in math-inl.h, defines a functor and the per-target
+// NAME##ArrayF32 and NAME##ArrayF64. SCALAR_FUNC is the fallback for targets
+// without double-precision vectors.
+#define HWY_MATH_ARRAY_FUNCTIONS(NAME, SCALAR_FUNC)                       \
+  struct NAME##Func {                                                     \
+    template <class D, class V>                                           \
+    HWY_INLINE V operator()(D d, V v) const {                             \
+      return NAME(d, v);                                                  \
+    }                                                                     \
+  };                                                                      \
+  void NAME##ArrayF32(const float* in, float* out, size_t n) {            \
+    MathArray(ScalableTag<float>(), in, out, n, NAME##Func());            \
+  }                                                                       \
+  void NAME##ArrayF64(const double* in, double* out, size_t n) {          \
+    MathArrayF64(in, out, n, NAME##Func(),                                \
+                 [](double x) -> double { return SCALAR_FUNC(x); });      \
+  }
+
+HWY_MATH_ARRAY_FUNCTIONS(Acos, std::acos)
+HWY_MATH_ARRAY_FUNCTIONS(Acosh, std::acosh)
+HWY_MATH_ARRAY_FUNCTIONS(Asin, std::asin)
+HWY_MATH_ARRAY_FUNCTIONS(Asinh, std::asinh)
+HWY_MATH_ARRAY_FUNCTIONS(Atan, std::atan)
+HWY_MATH_ARRAY_FUNCTIONS(Atanh, std::atanh)
+HWY_MATH_ARRAY_FUNCTIONS(Cbrt, std::cbrt)
+HWY_MATH_ARRAY_FUNCTIONS(Cos, std::cos)
+HWY_MATH_ARRAY_FUNCTIONS(Erf, std::erf)
+HWY_MATH_ARRAY_FUNCTIONS(Erfc, std::erfc)
+HWY_MATH_ARRAY_FUNCTIONS(Exp, std::exp)
+HWY_MATH_ARRAY_FUNCTIONS(Exp2, std::exp2)
+HWY_MATH_ARRAY_FUNCTIONS(Expm1, std::expm1)
+HWY_MATH_ARRAY_FUNCTIONS(FastExp, std::exp)
+HWY_MATH_ARRAY_FUNCTIONS(FastLog, std::log)
+HWY_MATH_ARRAY_FUNCTIONS(FastSigmoid, ScalarSigmoid)
+HWY_MATH_ARRAY_FUNCTIONS(FastTanh, std::tanh)
+HWY_MATH_ARRAY_FUNCTIONS(Log, std::log)
+HWY_MATH_ARRAY_FUNCTIONS(Log10, std::log10)
+HWY_MATH_ARRAY_FUNCTIONS(Log1p, std::log1p)
+HWY_MATH_ARRAY_FUNCTIONS(Log2, std::log2)
+HWY_MATH_ARRAY_FUNCTIONS(Sigmoid, ScalarSigmoid)
+HWY_MATH_ARRAY_FUNCTIONS(Sin, std::sin)
+HWY_MATH_ARRAY_FUNCTIONS(Sinh, std::sinh)
+HWY_MATH_ARRAY_FUNCTIONS(Tan, std::tan)
+HWY_MATH_ARRAY_FUNCTIONS(Tanh, std::tanh)
+
+// Same for the FastPrecision::kPrecise version of NAME, as NAME##Precise.
+#define HWY_MATH_ARRAY_PRECISE_FUNCTIONS(NAME, SCALAR_FUNC)               \
+  struct NAME##PreciseFunc {                                              \
+    template <class D, class V>                                           \
+    HWY_INLINE V operator()(D d, V v) const {                             \
+      return NAME<FastPrecision::kPrecise>(d, v);                         \
+    }                                                                     \
+  };                                                                      \
+  void NAME##PreciseArrayF32(const float* in, float* out, size_t n) {     \
+    MathArray(ScalableTag<float>(), in, out, n, NAME##PreciseFunc());     \
+  }                                                                       \
+  void NAME##PreciseArrayF64(const double* in, double* out, size_t n) {   \
+    MathArrayF64(in, out, n, NAME##PreciseFunc(),                         \
+                 [](double x) -> double { return SCALAR_FUNC(x); });      \
+  }
+
+HWY_MATH_ARRAY_PRECISE_FUNCTIONS(FastExp, std::exp)
+HWY_MATH_ARRAY_PRECISE_FUNCTIONS(FastLog, std::log)
+HWY_MATH_ARRAY_PRECISE_FUNCTIONS(FastSigmoid, ScalarSigmoid)
+HWY_MATH_ARRAY_PRECISE_FUNCTIONS(FastTanh, std::tanh)
+
+// FastExp and FastLog skip the handling of some inputs that Exp and Log
+// support. Half-precision data more often contains them, e.g. bfloat16_t zero
+// or subnormals, and the fix-ups are cheap relative to the conversions. Hence
+// the half-precision arrays handle them as std::exp and std::log would.
+struct FastExpHalfFunc {
+  template <class D, class V>
+  HWY_INLINE V operator()(D d, V v) const {
+    // Above log(FLT_MAX), FastExp returns a finite value.
+    const V kMaxLog = Set(d, 88.7228394f);
+    const V exp = IfThenElse(Gt(v, kMaxLog), Inf(d), FastExp(d, v));
+    return IfThenElse(IsNaN(v), v, exp);
+  }
+};
+
+struct FastLogHalfFunc {
+  template <class D, class V>
+  HWY_INLINE V operator()(D d, V v) const {
+    const V kMinNormal = Set(d, 1.17549435E-38f);
+    const V kScale = Set(d, 16777216.0f);  // 2^24
+    const V kLogScale = Set(d, 16.6355323f);
+
+    // bfloat16_t subnormals are also float32 subnormals. Scaling them up
+    // leaves negative numbers and zero to the fix-ups below.
+    const auto is_small = Lt(v, kMinNormal);
+    const V x = IfThenElse(is_small, Mul(v, kScale), v);
+    V log = FastLog(d, x);
+    log = IfThenElse(is_small, Sub(log, kLogScale), log);
+    // +inf and NaN return themselves.
+    log = IfThenElse(IsFinite(v), log, v);
+    log = IfThenElse(Eq(v, Zero(d)), Neg(Inf(d)), log);
+    return IfThenElse(Lt(v, Zero(d)), NaN(d), log);
+  }
+};
+
+// Per-target NAME##ArrayF16 and NAME##ArrayBF16, which evaluate FUNC in f32.
+#define HWY_MATH_ARRAY_HALF_FUNCTIONS(NAME, FUNC)                         \
+  void NAME##ArrayF16(const float16_t* in, float16_t* out, size_t n) {    \
+    MathArrayHalf(ScalableTag<float>(), in, out, n, FUNC());              \
+  }                                                                       \
+  void NAME##ArrayBF16(const bfloat16_t* in, bfloat16_t* out, size_t n) { \
+    MathArrayHalf(ScalableTag<float>(), in, out, n, FUNC());              \
+  }
+
+HWY_MATH_ARRAY_HALF_FUNCTIONS(Acos, AcosFunc)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(Acosh, AcoshFunc)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(Asin, AsinFunc)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(Asinh, AsinhFunc)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(Atan, AtanFunc)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(Atanh, AtanhFunc)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(Cbrt, CbrtFunc)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(Cos, CosFunc)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(Erf, ErfFunc)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(Erfc, ErfcFunc)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(Exp, ExpFunc)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(Exp2, Exp2Func)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(Expm1, Expm1Func)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(FastExp, FastExpHalfFunc)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(FastLog, FastLogHalfFunc)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(FastSigmoid, FastSigmoidFunc)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(FastTanh, FastTanhFunc)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(Log, LogFunc)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(Log10, Log10Func)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(Log1p, Log1pFunc)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(Log2, Log2Func)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(Sigmoid, SigmoidFunc)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(Sin, SinFunc)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(Sinh, SinhFunc)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(Tan, TanFunc)
+HWY_MATH_ARRAY_HALF_FUNCTIONS(Tanh, TanhFunc)
+
+#undef HWY_MATH_ARRAY_HALF_FUNCTIONS
+#undef HWY_MATH_ARRAY_PRECISE_FUNCTIONS
+#undef HWY_MATH_ARRAY_FUNCTIONS
+
+struct SinCosFunc {
+  template <class D, class V>
+  HWY_INLINE void operator()(D d, V v, V& s, V& c) const {
+    SinCos(d, v, s, c);
+  }
+};
+
+void SinCosArrayF32(const float* in, float* out_sin, float* out_cos,
+                    size_t n) {
+  MathArray2(ScalableTag<float>(), in, out_sin, out_cos, n, SinCosFunc());
+}
+
+void SinCosArrayF64(const double* in, double* out_sin, double* out_cos,
+                    size_t n) {
+#if HWY_HAVE_FLOAT64
+  MathArray2(ScalableTag<double>(), in, out_sin, out_cos, n, SinCosFunc());
+#else
+  for (size_t i = 0; i < n; ++i) {
+    // Read first in case `in` is one of the outputs.
+    const double x = in[i];
+    out_sin[i] = std::sin(x);
+    out_cos[i] = std::cos(x);
+  }
+#endif
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+namespace hwy {
+
+#define HWY_MATH_ARRAY_EXPORT(NAME)                                    \
+  HWY_EXPORT(NAME##ArrayF32);                                          \
+  HWY_EXPORT(NAME##ArrayF64);                                          \
+  void NAME##Array(const float* in, float* out, size_t n) {            \
+    HWY_DYNAMIC_DISPATCH(NAME##ArrayF32)(in, out, n);                  \
+  }                                                                    \
+  void NAME##Array(const double* in, double* out, size_t n) {          \
+    HWY_DYNAMIC_DISPATCH(NAME##ArrayF64)(in, out, n);                  \
+  }
+
+HWY_MATH_ARRAY_EXPORT(Acos)
+HWY_MATH_ARRAY_EXPORT(Acosh)
+HWY_MATH_ARRAY_EXPORT(Asin)
+HWY_MATH_ARRAY_EXPORT(Asinh)
+HWY_MATH_ARRAY_EXPORT(Atan)
+HWY_MATH_ARRAY_EXPORT(Atanh)
+HWY_MATH_ARRAY_EXPORT(Cbrt)
+HWY_MATH_ARRAY_EXPORT(Cos)
+HWY_MATH_ARRAY_EXPORT(Erf)
+HWY_MATH_ARRAY_EXPORT(Erfc)
+HWY_MATH_ARRAY_EXPORT(Exp)
+HWY_MATH_ARRAY_EXPORT(Exp2)
+HWY_MATH_ARRAY_EXPORT(Expm1)
+HWY_MATH_ARRAY_EXPORT(FastExp)
+HWY_MATH_ARRAY_EXPORT(FastExpPrecise)
+HWY_MATH_ARRAY_EXPORT(FastLog)
+HWY_MATH_ARRAY_EXPORT(FastLogPrecise)
+HWY_MATH_ARRAY_EXPORT(FastSigmoid)
+HWY_MATH_ARRAY_EXPORT(FastSigmoidPrecise)
+HWY_MATH_ARRAY_EXPORT(FastTanh)
+HWY_MATH_ARRAY_EXPORT(FastTanhPrecise)
+HWY_MATH_ARRAY_EXPORT(Log)
+HWY_MATH_ARRAY_EXPORT(Log10)
+HWY_MATH_ARRAY_EXPORT(Log1p)
+HWY_MATH_ARRAY_EXPORT(Log2)
+HWY_MATH_ARRAY_EXPORT(Sigmoid)
+HWY_MATH_ARRAY_EXPORT(Sin)
+HWY_MATH_ARRAY_EXPORT(Sinh)
+HWY_MATH_ARRAY_EXPORT(Tan)
+HWY_MATH_ARRAY_EXPORT(Tanh)
+
+#define HWY_MATH_ARRAY_HALF_EXPORT(NAME)                                 \
+  HWY_EXPORT(NAME##ArrayF16);                                            \
+  HWY_EXPORT(NAME##ArrayBF16);                                           \
+  void NAME##Array(const float16_t* in, float16_t* out, size_t n) {      \
+    HWY_DYNAMIC_DISPATCH(NAME##ArrayF16)(in, out, n);                    \
+  }                                                                      \
+  void NAME##Array(const bfloat16_t* in, bfloat16_t* out, size_t n) {    \
+    HWY_DYNAMIC_DISPATCH(NAME##ArrayBF16)(in, out, n);                   \
+  }
+
+HWY_MATH_ARRAY_HALF_EXPORT(Acos)
+HWY_MATH_ARRAY_HALF_EXPORT(Acosh)
+HWY_MATH_ARRAY_HALF_EXPORT(Asin)
+HWY_MATH_ARRAY_HALF_EXPORT(Asinh)
+HWY_MATH_ARRAY_HALF_EXPORT(Atan)
+HWY_MATH_ARRAY_HALF_EXPORT(Atanh)
+HWY_MATH_ARRAY_HALF_EXPORT(Cbrt)
+HWY_MATH_ARRAY_HALF_EXPORT(Cos)
+HWY_MATH_ARRAY_HALF_EXPORT(Erf)
+HWY_MATH_ARRAY_HALF_EXPORT(Erfc)
+HWY_MATH_ARRAY_HALF_EXPORT(Exp)
+HWY_MATH_ARRAY_HALF_EXPORT(Exp2)
+HWY_MATH_ARRAY_HALF_EXPORT(Expm1)
+HWY_MATH_ARRAY_HALF_EXPORT(FastExp)
+HWY_MATH_ARRAY_HALF_EXPORT(FastLog)
+HWY_MATH_ARRAY_HALF_EXPORT(FastSigmoid)
+HWY_MATH_ARRAY_HALF_EXPORT(FastTanh)
+HWY_MATH_ARRAY_HALF_EXPORT(Log)
+HWY_MATH_ARRAY_HALF_EXPORT(Log10)
+HWY_MATH_ARRAY_HALF_EXPORT(Log1p)
+HWY_MATH_ARRAY_HALF_EXPORT(Log2)
+HWY_MATH_ARRAY_HALF_EXPORT(Sigmoid)
+HWY_MATH_ARRAY_HALF_EXPORT(Sin)
+HWY_MATH_ARRAY_HALF_EXPORT(Sinh)
+HWY_MATH_ARRAY_HALF_EXPORT(Tan)
+HWY_MATH_ARRAY_HALF_EXPORT(Tanh)
+
+#undef HWY_MATH_ARRAY_HALF_EXPORT
+#undef HWY_MATH_ARRAY_EXPORT
+
+HWY_EXPORT(SinCosArrayF32);
+HWY_EXPORT(SinCosArrayF64);
+
+void SinCosArray(const float* in, float* out_sin, float* out_cos, size_t n) {
+  HWY_DYNAMIC_DISPATCH(SinCosArrayF32)(in, out_sin, out_cos, n);
+}
+
+void SinCosArray(const double* in, double* out_sin, double* out_cos,
+                 size_t n) {
+  HWY_DYNAMIC_DISPATCH(SinCosArrayF64)(in, out_sin, out_cos, n);
+}
+
+}  // namespace hwy
+#endif  // HWY_ONCE
@@ -0,0 +1,257 @@
+// Copyright 2022 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HIGHWAY_HWY_CONTRIB_MATH_MATH_H_
+#define HIGHWAY_HWY_CONTRIB_MATH_MATH_H_
+
+// Array versions of the functions in math-inl.h, which can be called from
+// normal (non-SIMD) code. They dynamically dispatch to the best available
+// target, so callers need not write their own loops nor HWY_EXPORT.
+//
+// Each function sets `out[i] = F(in[i])` for i in [0, n). `out` may equal
+// `in` (in-place), but must not otherwise overlap it. Accuracy and valid
+// input ranges are the same as for the corresponding function in math-inl.h.
+//
+// The float16_t and bfloat16_t versions promote to float, evaluate the float32
+// function and round to the nearest half-precision value, so their error is
+// mostly that final rounding. The half-precision FastExpArray and FastLogArray
+// also return infinity, zero or NaN outside the valid range of FastExp and
+// FastLog, as std::exp and std::log would, and support subnormal inputs.
+
+#include <stddef.h>
+
+#include "hwy/base.h"
+#include "hwy/highway_export.h"
+
+namespace hwy {
+
+HWY_CONTRIB_DLLEXPORT void AcosArray(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void AcosArray(const double* in, double* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void AcosArray(const float16_t* in, float16_t* out,
+                                     size_t n);
+HWY_CONTRIB_DLLEXPORT void AcosArray(const bfloat16_t* in, bfloat16_t* out,
+                                     size_t n);
+
+HWY_CONTRIB_DLLEXPORT void AcoshArray(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void AcoshArray(const double* in, double* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void AcoshArray(const float16_t* in, float16_t* out,
+                                      size_t n);
+HWY_CONTRIB_DLLEXPORT void AcoshArray(const bfloat16_t* in, bfloat16_t* out,
+                                      size_t n);
+
+HWY_CONTRIB_DLLEXPORT void AsinArray(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void AsinArray(const double* in, double* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void AsinArray(const float16_t* in, float16_t* out,
+                                     size_t n);
+HWY_CONTRIB_DLLEXPORT void AsinArray(const bfloat16_t* in, bfloat16_t* out,
+                                     size_t n);
+
+HWY_CONTRIB_DLLEXPORT void AsinhArray(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void AsinhArray(const double* in, double* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void AsinhArray(const float16_t* in, float16_t* out,
+                                      size_t n);
+HWY_CONTRIB_DLLEXPORT void AsinhArray(const bfloat16_t* in, bfloat16_t* out,
+                                      size_t n);
+
+HWY_CONTRIB_DLLEXPORT void AtanArray(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void AtanArray(const double* in, double* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void AtanArray(const float16_t* in, float16_t* out,
+                                     size_t n);
+HWY_CONTRIB_DLLEXPORT void AtanArray(const bfloat16_t* in, bfloat16_t* out,
+                                     size_t n);
+
+HWY_CONTRIB_DLLEXPORT void AtanhArray(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void AtanhArray(const double* in, double* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void AtanhArray(const float16_t* in, float16_t* out,
+                                      size_t n);
+HWY_CONTRIB_DLLEXPORT void AtanhArray(const bfloat16_t* in, bfloat16_t* out,
+                                      size_t n);
+
+HWY_CONTRIB_DLLEXPORT void CbrtArray(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void CbrtArray(const double* in, double* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void CbrtArray(const float16_t* in, float16_t* out,
+                                     size_t n);
+HWY_CONTRIB_DLLEXPORT void CbrtArray(const bfloat16_t* in, bfloat16_t* out,
+                                     size_t n);
+
+HWY_CONTRIB_DLLEXPORT void CosArray(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void CosArray(const double* in, double* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void CosArray(const float16_t* in, float16_t* out,
+                                    size_t n);
+HWY_CONTRIB_DLLEXPORT void CosArray(const bfloat16_t* in, bfloat16_t* out,
+                                    size_t n);
+
+HWY_CONTRIB_DLLEXPORT void ErfArray(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void ErfArray(const double* in, double* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void ErfArray(const float16_t* in, float16_t* out,
+                                    size_t n);
+HWY_CONTRIB_DLLEXPORT void ErfArray(const bfloat16_t* in, bfloat16_t* out,
+                                    size_t n);
+
+HWY_CONTRIB_DLLEXPORT void ErfcArray(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void ErfcArray(const double* in, double* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void ErfcArray(const float16_t* in, float16_t* out,
+                                     size_t n);
+HWY_CONTRIB_DLLEXPORT void ErfcArray(const bfloat16_t* in, bfloat16_t* out,
+                                     size_t n);
+
+HWY_CONTRIB_DLLEXPORT void ExpArray(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void ExpArray(const double* in, double* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void ExpArray(const float16_t* in, float16_t* out,
+                                    size_t n);
+HWY_CONTRIB_DLLEXPORT void ExpArray(const bfloat16_t* in, bfloat16_t* out,
+                                    size_t n);
+
+HWY_CONTRIB_DLLEXPORT void Exp2Array(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void Exp2Array(const double* in, double* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void Exp2Array(const float16_t* in, float16_t* out,
+                                     size_t n);
+HWY_CONTRIB_DLLEXPORT void Exp2Array(const bfloat16_t* in, bfloat16_t* out,
+                                     size_t n);
+
+HWY_CONTRIB_DLLEXPORT void Expm1Array(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void Expm1Array(const double* in, double* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void Expm1Array(const float16_t* in, float16_t* out,
+                                      size_t n);
+HWY_CONTRIB_DLLEXPORT void Expm1Array(const bfloat16_t* in, bfloat16_t* out,
+                                      size_t n);
+
+// Fast versions, see math-inl.h for their accuracy. Fast*Array use
+// FastPrecision::kApprox, and Fast*PreciseArray use FastPrecision::kPrecise.
+// The latter have no half-precision versions: the rounding to half precision
+// dominates the error of both tiers.
+HWY_CONTRIB_DLLEXPORT void FastExpArray(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void FastExpArray(const double* in, double* out,
+                                        size_t n);
+HWY_CONTRIB_DLLEXPORT void FastExpArray(const float16_t* in, float16_t* out,
+                                        size_t n);
+HWY_CONTRIB_DLLEXPORT void FastExpArray(const bfloat16_t* in, bfloat16_t* out,
+                                        size_t n);
+HWY_CONTRIB_DLLEXPORT void FastExpPreciseArray(const float* in, float* out,
+                                               size_t n);
+HWY_CONTRIB_DLLEXPORT void FastExpPreciseArray(const double* in, double* out,
+                                               size_t n);
+
+HWY_CONTRIB_DLLEXPORT void FastLogArray(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void FastLogArray(const double* in, double* out,
+                                        size_t n);
+HWY_CONTRIB_DLLEXPORT void FastLogArray(const float16_t* in, float16_t* out,
+                                        size_t n);
+HWY_CONTRIB_DLLEXPORT void FastLogArray(const bfloat16_t* in, bfloat16_t* out,
+                                        size_t n);
+HWY_CONTRIB_DLLEXPORT void FastLogPreciseArray(const float* in, float* out,
+                                               size_t n);
+HWY_CONTRIB_DLLEXPORT void FastLogPreciseArray(const double* in, double* out,
+                                               size_t n);
+
+HWY_CONTRIB_DLLEXPORT void FastSigmoidArray(const float* in, float* out,
+                                            size_t n);
+HWY_CONTRIB_DLLEXPORT void FastSigmoidArray(const double* in, double* out,
+                                            size_t n);
+HWY_CONTRIB_DLLEXPORT void FastSigmoidArray(const float16_t* in, float16_t* out,
+                                            size_t n);
+HWY_CONTRIB_DLLEXPORT void FastSigmoidArray(const bfloat16_t* in,
+                                            bfloat16_t* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void FastSigmoidPreciseArray(const float* in, float* out,
+                                                   size_t n);
+HWY_CONTRIB_DLLEXPORT void FastSigmoidPreciseArray(const double* in,
+                                                   double* out, size_t n);
+
+HWY_CONTRIB_DLLEXPORT void FastTanhArray(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void FastTanhArray(const double* in, double* out,
+                                         size_t n);
+HWY_CONTRIB_DLLEXPORT void FastTanhArray(const float16_t* in, float16_t* out,
+                                         size_t n);
+HWY_CONTRIB_DLLEXPORT void FastTanhArray(const bfloat16_t* in, bfloat16_t* out,
+                                         size_t n);
+HWY_CONTRIB_DLLEXPORT void FastTanhPreciseArray(const float* in, float* out,
+                                                size_t n);
+HWY_CONTRIB_DLLEXPORT void FastTanhPreciseArray(const double* in, double* out,
+                                                size_t n);
+
+HWY_CONTRIB_DLLEXPORT void LogArray(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void LogArray(const double* in, double* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void LogArray(const float16_t* in, float16_t* out,
+                                    size_t n);
+HWY_CONTRIB_DLLEXPORT void LogArray(const bfloat16_t* in, bfloat16_t* out,
+                                    size_t n);
+
+HWY_CONTRIB_DLLEXPORT void Log10Array(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void Log10Array(const double* in, double* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void Log10Array(const float16_t* in, float16_t* out,
+                                      size_t n);
+HWY_CONTRIB_DLLEXPORT void Log10Array(const bfloat16_t* in, bfloat16_t* out,
+                                      size_t n);
+
+HWY_CONTRIB_DLLEXPORT void Log1pArray(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void Log1pArray(const double* in, double* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void Log1pArray(const float16_t* in, float16_t* out,
+                                      size_t n);
+HWY_CONTRIB_DLLEXPORT void Log1pArray(const bfloat16_t* in, bfloat16_t* out,
+                                      size_t n);
+
+HWY_CONTRIB_DLLEXPORT void Log2Array(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void Log2Array(const double* in, double* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void Log2Array(const float16_t* in, float16_t* out,
+                                     size_t n);
+HWY_CONTRIB_DLLEXPORT void Log2Array(const bfloat16_t* in, bfloat16_t* out,
+                                     size_t n);
+
+HWY_CONTRIB_DLLEXPORT void SigmoidArray(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void SigmoidArray(const double* in, double* out,
+                                        size_t n);
+HWY_CONTRIB_DLLEXPORT void SigmoidArray(const float16_t* in, float16_t* out,
+                                        size_t n);
+HWY_CONTRIB_DLLEXPORT void SigmoidArray(const bfloat16_t* in, bfloat16_t* out,
+                                        size_t n);
+
+HWY_CONTRIB_DLLEXPORT void SinArray(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void SinArray(const double* in, double* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void SinArray(const float16_t* in, float16_t* out,
+                                    size_t n);
+HWY_CONTRIB_DLLEXPORT void SinArray(const bfloat16_t* in, bfloat16_t* out,
+                                    size_t n);
+
+// Sets `out_sin[i] = sin(in[i])` and `out_cos[i] = cos(in[i])`, which is
+// faster than SinArray plus CosArray. Either output may equal `in`.
+HWY_CONTRIB_DLLEXPORT void SinCosArray(const float* in, float* out_sin,
+                                       float* out_cos, size_t n);
+HWY_CONTRIB_DLLEXPORT void SinCosArray(const double* in, double* out_sin,
+                                       double* out_cos, size_t n);
+
+HWY_CONTRIB_DLLEXPORT void SinhArray(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void SinhArray(const double* in, double* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void SinhArray(const float16_t* in, float16_t* out,
+                                     size_t n);
+HWY_CONTRIB_DLLEXPORT void SinhArray(const bfloat16_t* in, bfloat16_t* out,
+                                     size_t n);
+
+HWY_CONTRIB_DLLEXPORT void TanArray(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void TanArray(const double* in, double* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void TanArray(const float16_t* in, float16_t* out,
+                                    size_t n);
+HWY_CONTRIB_DLLEXPORT void TanArray(const bfloat16_t* in, bfloat16_t* out,
+                                    size_t n);
+
+HWY_CONTRIB_DLLEXPORT void TanhArray(const float* in, float* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void TanhArray(const double* in, double* out, size_t n);
+HWY_CONTRIB_DLLEXPORT void TanhArray(const float16_t* in, float16_t* out,
+                                     size_t n);
+HWY_CONTRIB_DLLEXPORT void TanhArray(const bfloat16_t* in, bfloat16_t* out,
+                                     size_t n);
+
+}  // namespace hwy
+
+#endif  // HIGHWAY_HWY_CONTRIB_MATH_MATH_H_
@@ -19,10 +19,16 @@
 #include <inttypes.h>
 #include <stdio.h>
 
+#include <string.h>  // memcmp
+
 #include <cfloat>  // FLT_MAX
-#include <cmath>   // std::abs
+#include <cmath>   // std::abs, std::ldexp
+#include <limits>
 #include <type_traits>
 
+#include "hwy/aligned_allocator.h"
+#include "hwy/contrib/math/math.h"
+
 // clang-format off
 #undef HWY_TARGET_INCLUDE
 #define HWY_TARGET_INCLUDE "hwy/contrib/math/math_test.cc"
@@ -102,6 +108,121 @@ HWY_NOINLINE void TestMath(const std::string name, T (*fx1)(T),
   HWY_ASSERT(max_ulp <= max_error_ulp);
 }
 
+// Returns a value whose bit pattern is uniformly distributed within [min, max].
+// If the range spans zero, positive and negative values are equally likely.
+template <typename T>
+T RandomInRange(RandomState& rng, T min, T max) {
+  using UintT = MakeUnsigned<T>;
+  const bool negative = (max <= 0) || ((min < 0) && (Random32(&rng) & 1));
+  const T lo = negative ? (max < 0 ? -max : T(0)) : (min > 0 ? min : T(0));
+  const T hi = negative ? -min : max;
+  const UintT lo_bits = BitCast<UintT>(lo);
+  const UintT hi_bits = BitCast<UintT>(hi);
+  const uint64_t range = static_cast<uint64_t>(hi_bits - lo_bits) + 1;
+  const UintT bits = static_cast<UintT>(lo_bits + Random64(&rng) % range);
+  const T magnitude = BitCast<T>(bits);
+  return negative ? -magnitude : magnitude;
+}
+
+// Two-argument version of TestMath: compares random pairs within the given
+// ranges, plus all pairs of special values, against the standard library.
+template <class T, class D>
+HWY_NOINLINE void TestMath2(const std::string name, T (*fx1)(T, T),
+                            Vec<D> (*fxN)(D, VecArg<Vec<D>>, VecArg<Vec<D>>),
+                            D d, T min0, T max0, T min1, T max1,
+                            uint64_t max_error_ulp) {
+  const T kInf = std::numeric_limits<T>::infinity();
+  const T kSpecial[] = {T(0),   T(-0.0), T(0.5), T(-0.5), T(1),
+                        T(-1),  T(1.5),  T(-1.5), T(2),   T(-2),
+                        T(3),   T(-3),   kInf,   -kInf,   GetLane(NaN(d))};
+
+  uint64_t max_ulp = 0;
+  const auto verify = [&](T value0, T value1) {
+    const T actual = GetLane(fxN(d, Set(d, value0), Set(d, value1)));
+    const T expected = fx1(value0, value1);
+
+    // Skip small inputs and outputs on armv7, it flushes subnormals to zero.
+#if HWY_TARGET == HWY_NEON && HWY_ARCH_ARM_V7
+    if ((std::abs(value0) < 1e-37f) || (std::abs(value1) < 1e-37f) ||
+        (std::abs(expected) < 1e-37f)) {
+      return;
+    }
+#endif
+
+    const auto ulp = hwy::detail::ComputeUlpDelta(actual, expected);
+    max_ulp = HWY_MAX(max_ulp, ulp);
+    if (ulp > max_error_ulp) {
+      fprintf(stderr,
+              "%s: %s(%g, %g) expected %g actual %g ulp %" PRIu64
+              " max ulp %u\n",
+              hwy::TypeName(T(), Lanes(d)).c_str(), name.c_str(),
+              static_cast<double>(value0), static_cast<double>(value1),
+              static_cast<double>(expected), static_cast<double>(actual),
+              static_cast<uint64_t>(ulp), static_cast<uint32_t>(max_error_ulp));
+    }
+  };
+
+  for (const T value0 : kSpecial) {
+    for (const T value1 : kSpecial) {
+      verify(value0, value1);
+    }
+  }
+
+  RandomState rng;
+  // Emulation is slower, so cannot afford as many.
+  const size_t num = AdjustedReps(8000);
+  for (size_t i = 0; i < num; ++i) {
+    verify(RandomInRange(rng, min0, max0), RandomInRange(rng, min1, max1));
+  }
+  fprintf(stderr, "%s: %s max_ulp %" PRIu64 "\n",
+          hwy::TypeName(T(), Lanes(d)).c_str(), name.c_str(), max_ulp);
+  HWY_ASSERT(max_ulp <= max_error_ulp);
+}
+
+// For the Fast* approximations: measures both the max ULP and the max relative
+// error of random inputs within [min, max] versus the standard library, and
+// checks the relative error.
+template <class T, class D>
+HWY_NOINLINE void TestFastMath(const std::string name, T (*fx1)(T),
+                               Vec<D> (*fxN)(D, VecArg<Vec<D>>), D d, T min,
+                               T max, double max_rel_error) {
+  uint64_t max_ulp = 0;
+  double max_rel = 0.0;
+  RandomState rng;
+  // Emulation is slower, so cannot afford as many.
+  const size_t num = AdjustedReps(20000);
+  for (size_t i = 0; i < num; ++i) {
+    const T value = RandomInRange(rng, min, max);
+    const T actual = GetLane(fxN(d, Set(d, value)));
+    const T expected = fx1(value);
+
+    // Skip small inputs and outputs on armv7, it flushes subnormals to zero.
+#if HWY_TARGET == HWY_NEON && HWY_ARCH_ARM_V7
+    if ((std::abs(value) < 1e-37f) || (std::abs(expected) < 1e-37f)) {
+      continue;
+    }
+#endif
+
+    const double expected_d = static_cast<double>(expected);
+    const double abs_error = std::abs(static_cast<double>(actual) - expected_d);
+    // Relative to 1 if the expected value is zero (e.g. Log(1)).
+    const double rel =
+        expected == T(0) ? abs_error : abs_error / std::abs(expected_d);
+    max_rel = HWY_MAX(max_rel, rel);
+    max_ulp = HWY_MAX(max_ulp, hwy::detail::ComputeUlpDelta(actual, expected));
+    if (rel > max_rel_error) {
+      fprintf(stderr, "%s: %s(%g) expected %g actual %g rel %g max %g\n",
+              hwy::TypeName(T(), Lanes(d)).c_str(), name.c_str(),
+              static_cast<double>(value), static_cast<double>(expected),
+              static_cast<double>(actual), rel, max_rel_error);
+    }
+  }
+  fprintf(stderr, "%s: %s max_ulp %" PRIu64 " max_rel %.3E\n",
+          hwy::TypeName(T(), Lanes(d)).c_str(), name.c_str(), max_ulp,
+          max_rel);
+  HWY_ASSERT(max_rel <= max_rel_error);
+}
+
 #define DEFINE_MATH_TEST_FUNC(NAME)                 \
   HWY_NOINLINE void TestAll##NAME() {               \
     ForFloatTypes(ForPartialVectors<Test##NAME>()); \
@@ -166,12 +287,24 @@ DEFINE_MATH_TEST(Atan,
 DEFINE_MATH_TEST(Atanh,
   std::atanh, CallAtanh, -kNearOneF, +kNearOneF,  4,  // NEON is 4 instead of 3
   std::atanh, CallAtanh, -kNearOneD, +kNearOneD,  3)
+DEFINE_MATH_TEST(Cbrt,
+  std::cbrt,  CallCbrt,  -FLT_MAX,   +FLT_MAX,    1,
+  std::cbrt,  CallCbrt,  -DBL_MAX,   +DBL_MAX,    3)
 DEFINE_MATH_TEST(Cos,
   std::cos,   CallCos,   -39000.0f,  +39000.0f,   3,
   std::cos,   CallCos,   -39000.0,   +39000.0,    Cos64ULP())
+DEFINE_MATH_TEST(Erf,
+  std::erf,   CallErf,   -FLT_MAX,   +FLT_MAX,    2,
+  std::erf,   CallErf,   -DBL_MAX,   +DBL_MAX,    2)
+DEFINE_MATH_TEST(Erfc,
+  std::erfc,  CallErfc,  -FLT_MAX,   +FLT_MAX,    4,
+  std::erfc,  CallErfc,  -DBL_MAX,   +DBL_MAX,    4)
 DEFINE_MATH_TEST(Exp,
   std::exp,   CallExp,   -FLT_MAX,   +104.0f,     1,
   std::exp,   CallExp,   -DBL_MAX,   +104.0,      1)
+DEFINE_MATH_TEST(Exp2,
+  std::exp2,  CallExp2,  -FLT_MAX,   +128.0f,     1,
+  std::exp2,  CallExp2,  -DBL_MAX,   +1024.0,     1)
 DEFINE_MATH_TEST(Expm1,
   std::expm1, CallExpm1, -FLT_MAX,   +104.0f,     4,
   std::expm1, CallExpm1, -DBL_MAX,   +104.0,      4)
@@ -193,11 +326,549 @@ DEFINE_MATH_TEST(Sin,
 DEFINE_MATH_TEST(Sinh,
   std::sinh,  CallSinh,  -80.0f,     +80.0f,      4,
   std::sinh,  CallSinh,  -709.0,     +709.0,      4)
+DEFINE_MATH_TEST(Tan,
+  std::tan,   CallTan,   -39000.0f,  +39000.0f,   3,
+  std::tan,   CallTan,   -39000.0,   +39000.0,    3)
 DEFINE_MATH_TEST(Tanh,
   std::tanh,  CallTanh,  -FLT_MAX,   +FLT_MAX,    4,
   std::tanh,  CallTanh,  -DBL_MAX,   +DBL_MAX,    4)
 // clang-format on
 
+struct TestAtan2 {
+  template <class T, class D>
+  HWY_NOINLINE void operator()(T, D d) {
+    const T kMax = HighestValue<T>();
+    TestMath2<T, D>("Atan2", std::atan2, CallAtan2, d, -kMax, kMax, -kMax,
+                    kMax, 2);
+  }
+};
+DEFINE_MATH_TEST_FUNC(Atan2)
+
+struct TestHypot {
+  template <class T, class D>
+  HWY_NOINLINE void operator()(T, D d) {
+    const T kMax = HighestValue<T>();
+    TestMath2<T, D>("Hypot", std::hypot, CallHypot, d, -kMax, kMax, -kMax,
+                    kMax, 1);
+  }
+};
+DEFINE_MATH_TEST_FUNC(Hypot)
+
+struct TestPow {
+  template <class T, class D>
+  HWY_NOINLINE void operator()(T, D d) {
+    const T kMax = HighestValue<T>();
+    // Also holds without native FMA, including if the compiler contracts the
+    // separate multiplications and additions (e.g. -march=haswell for SSE4).
+    const uint64_t max_ulp = 2;
+    // All positive x, with exponents whose results are mostly finite.
+    TestMath2<T, D>("Pow", std::pow, CallPow, d, T(0), kMax, T(-1), T(1),
+                    max_ulp);
+    // x near one and large exponents, up to overflow and underflow.
+    TestMath2<T, D>("Pow", std::pow, CallPow, d, T(0.5), T(2), T(-2000),
+                    T(2000), max_ulp);
+    TestMath2<T, D>("Pow", std::pow, CallPow, d, T(0), T(1E4), T(-200),
+                    T(200), max_ulp);
+  }
+};
+DEFINE_MATH_TEST_FUNC(Pow)
+
+// Reference implementation with higher intermediate precision.
+template <typename T>
+T SigmoidRef(T x) {
+  return static_cast<T>(1.0L / (1.0L + std::exp(-static_cast<long double>(x))));
+}
+
+struct TestSigmoid {
+  template <class T, class D>
+  HWY_NOINLINE void operator()(T, D d) {
+    const T kMax = HighestValue<T>();
+    TestMath<T, D>("Sigmoid", SigmoidRef<T>, CallSigmoid, d, -kMax, kMax,
+                   2);
+  }
+};
+DEFINE_MATH_TEST_FUNC(Sigmoid)
+
+struct TestFastMathFunctions {
+  template <class T, class D>
+  HWY_NOINLINE void operator()(T, D d) {
+    const bool kIsF32 = sizeof(T) == 4;
+    const T kMax = HighestValue<T>();
+    const T kMinNormal = std::numeric_limits<T>::min();
+    const T kMinExp = static_cast<T>(kIsF32 ? -86.0 : -707.0);
+    const T kMaxExp = static_cast<T>(kIsF32 ? 88.0 : 709.0);
+
+    // FastPrecision::kApprox
+    TestFastMath<T, D>("FastExp", std::exp, CallFastExp, d, kMinExp, kMaxExp,
+                       kIsF32 ? 8E-6 : 1E-13);
+    // Results that would be (nearly) subnormal are flushed to zero.
+    HWY_ASSERT_VEC_EQ(d, Zero(d), CallFastExp(d, Set(d, -kMax)));
+    HWY_ASSERT_VEC_EQ(d, Zero(d),
+                      CallFastExp(d, Set(d, static_cast<T>(-1000.0))));
+    TestFastMath<T, D>("FastLog", std::log, CallFastLog, d, kMinNormal, kMax,
+                       kIsF32 ? 1E-5 : 1E-13);
+    TestFastMath<T, D>("FastSigmoid", SigmoidRef<T>, CallFastSigmoid, d,
+                       kMinExp, kMax, kIsF32 ? 8E-6 : 1E-13);
+    TestFastMath<T, D>("FastTanh", std::tanh, CallFastTanh, d, -kMax, kMax,
+                       kIsF32 ? 5E-6 : 1E-13);
+
+    // FastPrecision::kPrecise
+    constexpr FastPrecision kPrecise = FastPrecision::kPrecise;
+    TestMath<T, D>("FastExpPrecise", std::exp, CallFastExp<kPrecise>, d,
+                   kMinExp, kMaxExp, 1);
+    HWY_ASSERT_VEC_EQ(d, Zero(d), CallFastExp<kPrecise>(d, Set(d, -kMax)));
+    TestMath<T, D>("FastLogPrecise", std::log, CallFastLog<kPrecise>, d,
+                   kMinNormal, kMax, 1);
+    TestMath<T, D>("FastSigmoidPrecise", SigmoidRef<T>,
+                   CallFastSigmoid<kPrecise>, d, kMinExp, kMax, 2);
+    TestMath<T, D>("FastTanhPrecise", std::tanh, CallFastTanh<kPrecise>, d,
+                   -kMax, kMax, 2);
+  }
+};
+
+HWY_NOINLINE void TestAllFastMath() {
+  ForFloatTypes(ForPartialVectors<TestFastMathFunctions>());
+}
+
+struct TestSinCos {
+  template <class T, class D>
+  HWY_NOINLINE void operator()(T, D d) {
+    using V = Vec<D>;
+    const T kMax = static_cast<T>(39000);
+    TestMath<T, D>(
+        "SinCos.sin", std::sin,
+        [](D d, VecArg<V> x) -> V {
+          V s, c;
+          CallSinCos(d, x, s, c);
+          return s;
+        },
+        d, -kMax, kMax, 2);
+    TestMath<T, D>(
+        "SinCos.cos", std::cos,
+        [](D d, VecArg<V> x) -> V {
+          V s, c;
+          CallSinCos(d, x, s, c);
+          return c;
+        },
+        d, -kMax, kMax, 2);
+  }
+};
+DEFINE_MATH_TEST_FUNC(SinCos)
+
+// The fused functions share the reduction, hence must exactly match the
+// separate functions.
+struct TestExpAndExpm1 {
+  template <class T, class D>
+  HWY_NOINLINE void operator()(T, D d) {
+    using V = Vec<D>;
+    const size_t N = Lanes(d);
+    auto in = AllocateAligned<T>(N);
+    HWY_ASSERT(in);
+    const T kMax = static_cast<T>(sizeof(T) == 4 ? 104.0 : 706.0);
+
+    RandomState rng;
+    for (size_t rep = 0; rep < AdjustedReps(2000); ++rep) {
+      for (size_t i = 0; i < N; ++i) {
+        in[i] = RandomInRange(rng, -kMax, kMax);
+      }
+      const V x = Load(d, in.get());
+      V exp, expm1;
+      CallExpAndExpm1(d, x, exp, expm1);
+      HWY_ASSERT_VEC_EQ(d, CallExp(d, x), exp);
+      HWY_ASSERT_VEC_EQ(d, CallExpm1(d, x), expm1);
+    }
+  }
+};
+DEFINE_MATH_TEST_FUNC(ExpAndExpm1)
+
+struct TestLogAndLogb {
+  template <class T, class D>
+  HWY_NOINLINE void operator()(T, D d) {
+    using V = Vec<D>;
+    const size_t N = Lanes(d);
+    auto in = AllocateAligned<T>(N);
+    auto expected = AllocateAligned<T>(N);
+    HWY_ASSERT(in && expected);
+
+    RandomState rng;
+    for (size_t rep = 0; rep < AdjustedReps(2000); ++rep) {
+      for (size_t i = 0; i < N; ++i) {
+        in[i] = RandomInRange(rng, std::numeric_limits<T>::min(),
+                              HighestValue<T>());
+        expected[i] = std::logb(in[i]);
+      }
+      const V x = Load(d, in.get());
+      V log, logb;
+      CallLogAndLogb(d, x, log, logb);
+      HWY_ASSERT_VEC_EQ(d, CallLog(d, x), log);
+      HWY_ASSERT_VEC_EQ(d, expected.get(), logb);
+    }
+  }
+};
+DEFINE_MATH_TEST_FUNC(LogAndLogb)
+
+// Returns whether the results of an array and per-vector function match. The
+// array functions are compiled in another translation unit, hence if the
+// compiler contracts separate multiplications and additions despite the lack
+// of native FMA (e.g. -march=haswell for SSE4), it may fuse them differently.
+template <typename T>
+bool ArrayMatchesVector(T expected, T actual) {
+  if (memcmp(&expected, &actual, sizeof(T)) == 0) return true;
+#if !HWY_NATIVE_FMA && (defined(__FP_FAST_FMA) || defined(__FP_FAST_FMAF))
+  return hwy::detail::ComputeUlpDelta(expected, actual) <= 4;
+#else
+  return false;
+#endif
+}
+
+// The array functions from math.h dispatch to the current target, hence must
+// match its per-vector functions, including for the partial last vector.
+template <typename T, class D>
+void VerifyMathArray(D d, const char* name,
+                     void (*array_func)(const T*, T*, size_t),
+                     Vec<D> (*fxN)(D, VecArg<Vec<D>>), T min, T max) {
+  RandomState rng;
+  const size_t N = Lanes(d);
+  for (size_t n = 0; n < 3 * N + 2; ++n) {
+    const size_t padded = (n + N - 1) / N * N;
+    auto in = AllocateAligned<T>(padded + 1);
+    auto expected = AllocateAligned<T>(padded + 1);
+    auto actual = AllocateAligned<T>(padded + 1);
+    for (size_t i = 0; i < padded; ++i) {
+      const double frac = static_cast<double>(Random32(&rng)) / 4294967296.0;
+      in[i] = static_cast<T>(min + (max - min) * frac);
+    }
+    for (size_t i = 0; i < padded; i += N) {
+      Store(fxN(d, Load(d, in.get() + i)), d, expected.get() + i);
+    }
+
+    array_func(in.get(), actual.get(), n);
+    // In-place
+    array_func(in.get(), in.get(), n);
+    for (size_t i = 0; i < n; ++i) {
+      if (!ArrayMatchesVector(expected[i], actual[i]) ||
+          !ArrayMatchesVector(expected[i], in[i])) {
+        HWY_ABORT("%s %s: n %zu mismatch at %zu: %E vs %E, in-place %E\n",
+                  hwy::TypeName(T(), N).c_str(), name, n, i,
+                  static_cast<double>(expected[i]),
+                  static_cast<double>(actual[i]), static_cast<double>(in[i]));
+      }
+    }
+  }
+}
+
+struct TestMathArray {
+  template <class T, class D>
+  HWY_NOINLINE void operator()(T, D d) {
+    using V = Vec<D>;
+    VerifyMathArray(d, "Acos", AcosArray, CallAcos<D, V>, T(-1), T(1));
+    VerifyMathArray(d, "Acosh", AcoshArray, CallAcosh<D, V>, T(1), T(1E6));
+    VerifyMathArray(d, "Asin", AsinArray, CallAsin<D, V>, T(-1), T(1));
+    VerifyMathArray(d, "Asinh", AsinhArray, CallAsinh<D, V>, T(-1E6), T(1E6));
+    VerifyMathArray(d, "Atan", AtanArray, CallAtan<D, V>, T(-1E6), T(1E6));
+    VerifyMathArray(d, "Atanh", AtanhArray, CallAtanh<D, V>, T(-0.99),
+                    T(0.99));
+    VerifyMathArray(d, "Cbrt", CbrtArray, CallCbrt<D, V>, T(-1E6), T(1E6));
+    VerifyMathArray(d, "Cos", CosArray, CallCos<D, V>, T(-1E4), T(1E4));
+    VerifyMathArray(d, "Erf", ErfArray, CallErf<D, V>, T(-5), T(5));
+    VerifyMathArray(d, "Erfc", ErfcArray, CallErfc<D, V>, T(-5), T(20));
+    VerifyMathArray(d, "Exp", ExpArray, CallExp<D, V>, T(-80), T(80));
+    VerifyMathArray(d, "Exp2", Exp2Array, CallExp2<D, V>, T(-100), T(100));
+    VerifyMathArray(d, "Expm1", Expm1Array, CallExpm1<D, V>, T(-80), T(80));
+    constexpr FastPrecision kApprox = FastPrecision::kApprox;
+    constexpr FastPrecision kPrecise = FastPrecision::kPrecise;
+    VerifyMathArray(d, "FastExp", FastExpArray, CallFastExp<kApprox, D, V>,
+                    T(-80), T(80));
+    VerifyMathArray(d, "FastExpPrecise", FastExpPreciseArray,
+                    CallFastExp<kPrecise, D, V>, T(-80), T(80));
+    VerifyMathArray(d, "FastLog", FastLogArray, CallFastLog<kApprox, D, V>,
+                    T(1E-6), T(1E6));
+    VerifyMathArray(d, "FastLogPrecise", FastLogPreciseArray,
+                    CallFastLog<kPrecise, D, V>, T(1E-6), T(1E6));
+    VerifyMathArray(d, "FastSigmoid", FastSigmoidArray,
+                    CallFastSigmoid<kApprox, D, V>, T(-20), T(20));
+    VerifyMathArray(d, "FastSigmoidPrecise", FastSigmoidPreciseArray,
+                    CallFastSigmoid<kPrecise, D, V>, T(-20), T(20));
+    VerifyMathArray(d, "FastTanh", FastTanhArray, CallFastTanh<kApprox, D, V>,
+                    T(-20), T(20));
+    VerifyMathArray(d, "FastTanhPrecise", FastTanhPreciseArray,
+                    CallFastTanh<kPrecise, D, V>, T(-20), T(20));
+    VerifyMathArray(d, "Log", LogArray, CallLog<D, V>, T(1E-6), T(1E6));
+    VerifyMathArray(d, "Log10", Log10Array, CallLog10<D, V>, T(1E-6), T(1E6));
+    VerifyMathArray(d, "Log1p", Log1pArray, CallLog1p<D, V>, T(0), T(1E6));
+    VerifyMathArray(d, "Log2", Log2Array, CallLog2<D, V>, T(1E-6), T(1E6));
+    VerifyMathArray(d, "Sigmoid", SigmoidArray, CallSigmoid<D, V>, T(-20),
+                    T(20));
+    VerifyMathArray(d, "Sin", SinArray, CallSin<D, V>, T(-1E4), T(1E4));
+    VerifyMathArray(d, "Sinh", SinhArray, CallSinh<D, V>, T(-80), T(80));
+    VerifyMathArray(d, "Tan", TanArray, CallTan<D, V>, T(-1E4), T(1E4));
+    VerifyMathArray(d, "Tanh", TanhArray, CallTanh<D, V>, T(-20), T(20));
+
+    // SinCosArray must match SinCos, also when writing to `in`.
+    RandomState rng;
+    const size_t N = Lanes(d);
+    for (size_t n = 0; n < 3 * N + 2; ++n) {
+      const size_t padded = (n + N - 1) / N * N;
+      auto in = AllocateAligned<T>(padded + 1);
+      auto expected_sin = AllocateAligned<T>(padded + 1);
+      auto expected_cos = AllocateAligned<T>(padded + 1);
+      auto actual_cos = AllocateAligned<T>(padded + 1);
+      HWY_ASSERT(in && expected_sin && expected_cos && actual_cos);
+      for (size_t i = 0; i < padded; ++i) {
+        in[i] = RandomInRange(rng, T(-1E4), T(1E4));
+      }
+      for (size_t i = 0; i < padded; i += N) {
+        V s, c;
+        CallSinCos(d, Load(d, in.get() + i), s, c);
+        Store(s, d, expected_sin.get() + i);
+        Store(c, d, expected_cos.get() + i);
+      }
+
+      SinCosArray(in.get(), in.get(), actual_cos.get(), n);
+      for (size_t i = 0; i < n; ++i) {
+        if (!ArrayMatchesVector(expected_sin[i], in[i]) ||
+            !ArrayMatchesVector(expected_cos[i], actual_cos[i])) {
+          HWY_ABORT("%s SinCos: n %zu mismatch at %zu\n",
+                    hwy::TypeName(T(), N).c_str(), n, i);
+        }
+      }
+    }
+  }
+};
+
+HWY_NOINLINE void TestAllMathArray() {
+  TestMathArray()(float(), ScalableTag<float>());
+#if HWY_HAVE_FLOAT64
+  TestMathArray()(double(), ScalableTag<double>());
+#endif
+}
+
+// References for rounding f32 (not NaN) to the nearest even 16-bit float.
+void NearestFromF32(float f, bfloat16_t* HWY_RESTRICT out) {
+  uint32_t bits;
+  CopySameSize(&f, &bits);
+  bits += 0x7FFF + ((bits >> 16) & 1);
+  out->bits = static_cast<uint16_t>(bits >> 16);
+}
+
+// Returns the magnitude of the non-negative f16 with the given bits. For the
+// infinity bits, returns 2^16 as if the exponent were finite, so that values
+// at least halfway between it and the largest finite f16 round to infinity.
+double F16MagnitudeFromBits(uint32_t bits) {
+  const uint32_t biased_exp = bits >> 10;
+  const double mantissa = static_cast<double>(bits & 0x3FF);
+  if (biased_exp == 0) return std::ldexp(mantissa, -24);
+  return std::ldexp(mantissa + 1024.0, static_cast<int>(biased_exp) - 25);
+}
+
+// Unlike the conversion in math.cc, this does not manipulate f32 bits: it
+// searches for the nearest representable magnitude. f32 and f16 are exact in
+// double, and so are their differences if they are close enough to be ties.
+void NearestFromF32(float f, float16_t* HWY_RESTRICT out) {
+  const double mag = std::abs(static_cast<double>(f));
+  // Largest bits whose magnitude is at most `mag`.
+  uint32_t lower = 0;
+  uint32_t upper = 0x7C00;
+  while (lower != upper) {
+    const uint32_t mid = (lower + upper + 1) / 2;
+    if (F16MagnitudeFromBits(mid) <= mag) {
+      lower = mid;
+    } else {
+      upper = mid - 1;
+    }
+  }
+  uint32_t bits16 = lower;
+  if (lower != 0x7C00) {
+    const double below = mag - F16MagnitudeFromBits(lower);
+    const double above = F16MagnitudeFromBits(lower + 1) - mag;
+    if (above < below || (above == below && (lower & 1))) ++bits16;
+  }
+  if (std::signbit(f)) bits16 |= 0x8000;
+  const uint16_t bits = static_cast<uint16_t>(bits16);
+  CopySameSize(&bits, out);
+}
+
+// The half-precision array functions must match the f32 vector functions
+// applied to the promoted input, rounded to the nearest output.
+template <typename T16, class DF>
+void VerifyMathArrayHalf(DF df, const char* name,
+                         void (*array_func)(const T16*, T16*, size_t),
+                         Vec<DF> (*fxN)(DF, VecArg<Vec<DF>>), float min,
+                         float max) {
+  const Rebind<T16, DF> d16;
+  RandomState rng;
+  const size_t N = Lanes(df);
+  for (size_t n = 0; n < 3 * N + 2; ++n) {
+    const size_t padded = (n + N - 1) / N * N;
+    auto in = AllocateAligned<T16>(padded + 1);
+    auto expected = AllocateAligned<T16>(padded + 1);
+    auto actual = AllocateAligned<T16>(padded + 1);
+    auto in_f32 = AllocateAligned<float>(padded + 1);
+    auto expected_f32 = AllocateAligned<float>(padded + 1);
+    HWY_ASSERT(in && expected && actual && in_f32 && expected_f32);
+    for (size_t i = 0; i < padded; ++i) {
+      in_f32[i] = RandomInRange(rng, min, max);
+    }
+    for (size_t i = 0; i < padded; i += N) {
+      Store(DemoteTo(d16, Load(df, in_f32.get() + i)), d16, in.get() + i);
+      const Vec<DF> v = PromoteTo(df, Load(d16, in.get() + i));
+      Store(fxN(df, v), df, expected_f32.get() + i);
+    }
+    for (size_t i = 0; i < padded; ++i) {
+      NearestFromF32(expected_f32[i], &expected[i]);
+    }
+
+    array_func(in.get(), actual.get(), n);
+    // In-place
+    array_func(in.get(), in.get(), n);
+    for (size_t i = 0; i < n; ++i) {
+      if (memcmp(&expected[i], &actual[i], sizeof(T16)) != 0 ||
+          memcmp(&expected[i], &in[i], sizeof(T16)) != 0) {
+        HWY_ABORT("%s %s: n %zu mismatch at %zu\n",
+                  hwy::TypeName(T16(), N).c_str(), name, n, i);
+      }
+    }
+  }
+}
+
+template <typename T16>
+T16 HalfFromBits(uint16_t bits) {
+  T16 ret;
+  CopySameSize(&bits, &ret);
+  return ret;
+}
+
+template <typename T16>
+bool IsNaNHalf(T16 v) {
+  uint16_t bits;
+  CopySameSize(&v, &bits);
+  const uint16_t inf_bits = IsSame<T16, bfloat16_t>() ? 0x7F80 : 0x7C00;
+  return (bits & 0x7FFF) > inf_bits;
+}
+
+// Inputs outside the valid range of FastExp and FastLog, which the
+// half-precision arrays handle like std::exp and std::log.
+template <typename T16>
+void VerifyFastHalfSpecial() {
+  const bool is_bf16 = IsSame<T16, bfloat16_t>();
+  const float inf = std::numeric_limits<float>::infinity();
+  // Smallest positive subnormal.
+  const T16 min_subnormal = HalfFromBits<T16>(1);
+  const float min_subnormal_f32 = std::ldexp(1.0f, is_bf16 ? -133 : -24);
+  const T16 nan = HalfFromBits<T16>(is_bf16 ? 0x7FC0 : 0x7E00);
+
+  T16 in[8];
+  T16 expected[8];
+  T16 out[8];
+  NearestFromF32(0.0f, &in[0]);
+  NearestFromF32(-0.0f, &in[1]);
+  in[2] = min_subnormal;
+  NearestFromF32(-1.0f, &in[3]);
+  NearestFromF32(inf, &in[4]);
+  NearestFromF32(-inf, &in[5]);
+  in[6] = nan;
+  NearestFromF32(100.0f, &in[7]);
+
+  FastLogArray(in, out, 8);
+  NearestFromF32(-inf, &expected[0]);
+  NearestFromF32(-inf, &expected[1]);
+  NearestFromF32(std::log(min_subnormal_f32), &expected[2]);
+  NearestFromF32(inf, &expected[4]);
+  NearestFromF32(std::log(100.0f), &expected[7]);
+  for (size_t i : {size_t{0}, size_t{1}, size_t{2}, size_t{4}, size_t{7}}) {
+    if (memcmp(&expected[i], &out[i], sizeof(T16)) != 0) {
+      HWY_ABORT("%s FastLog: mismatch at %zu\n",
+                hwy::TypeName(T16(), 1).c_str(), i);
+    }
+  }
+  for (size_t i : {size_t{3}, size_t{5}, size_t{6}}) {
+    if (!IsNaNHalf(out[i])) {
+      HWY_ABORT("%s FastLog: expected NaN at %zu\n",
+                hwy::TypeName(T16(), 1).c_str(), i);
+    }
+  }
+
+  FastExpArray(in, out, 8);
+  NearestFromF32(1.0f, &expected[0]);
+  NearestFromF32(1.0f, &expected[1]);
+  NearestFromF32(1.0f, &expected[2]);
+  NearestFromF32(std::exp(-1.0f), &expected[3]);
+  NearestFromF32(inf, &expected[4]);
+  NearestFromF32(0.0f, &expected[5]);
+  NearestFromF32(inf, &expected[7]);
+  for (size_t i = 0; i < 8; ++i) {
+    if (i == 6 ? !IsNaNHalf(out[i])
+               : memcmp(&expected[i], &out[i], sizeof(T16)) != 0) {
+      HWY_ABORT("%s FastExp: mismatch at %zu\n",
+                hwy::TypeName(T16(), 1).c_str(), i);
+    }
+  }
+}
+
+struct TestMathArrayHalf {
+  template <typename T16, class DF>
+  HWY_NOINLINE void operator()(T16, DF df) {
+    using V = Vec<DF>;
+    VerifyMathArrayHalf<T16>(df, "Acos", AcosArray, CallAcos<DF, V>, -1.0f,
+                             1.0f);
+    VerifyMathArrayHalf<T16>(df, "Acosh", AcoshArray, CallAcosh<DF, V>, 1.0f,
+                             6E4f);
+    VerifyMathArrayHalf<T16>(df, "Asin", AsinArray, CallAsin<DF, V>, -1.0f,
+                             1.0f);
+    VerifyMathArrayHalf<T16>(df, "Asinh", AsinhArray, CallAsinh<DF, V>, -6E4f,
+                             6E4f);
+    VerifyMathArrayHalf<T16>(df, "Atan", AtanArray, CallAtan<DF, V>, -6E4f,
+                             6E4f);
+    VerifyMathArrayHalf<T16>(df, "Atanh", AtanhArray, CallAtanh<DF, V>, -0.99f,
+                             0.99f);
+    VerifyMathArrayHalf<T16>(df, "Cbrt", CbrtArray, CallCbrt<DF, V>, -6E4f,
+                             6E4f);
+    VerifyMathArrayHalf<T16>(df, "Cos", CosArray, CallCos<DF, V>, -1E4f, 1E4f);
+    VerifyMathArrayHalf<T16>(df, "Erf", ErfArray, CallErf<DF, V>, -5.0f, 5.0f);
+    VerifyMathArrayHalf<T16>(df, "Erfc", ErfcArray, CallErfc<DF, V>, -5.0f,
+                             20.0f);
+    VerifyMathArrayHalf<T16>(df, "Exp", ExpArray, CallExp<DF, V>, -10.0f,
+                             10.0f);
+    VerifyMathArrayHalf<T16>(df, "Exp2", Exp2Array, CallExp2<DF, V>, -15.0f,
+                             15.0f);
+    VerifyMathArrayHalf<T16>(df, "Expm1", Expm1Array, CallExpm1<DF, V>, -10.0f,
+                             10.0f);
+    VerifyMathArrayHalf<T16>(df, "Log", LogArray, CallLog<DF, V>, 1E-4f, 6E4f);
+    VerifyMathArrayHalf<T16>(df, "Log10", Log10Array, CallLog10<DF, V>, 1E-4f,
+                             6E4f);
+    VerifyMathArrayHalf<T16>(df, "Log1p", Log1pArray, CallLog1p<DF, V>, 0.0f,
+                             6E4f);
+    VerifyMathArrayHalf<T16>(df, "Log2", Log2Array, CallLog2<DF, V>, 1E-4f,
+                             6E4f);
+    VerifyMathArrayHalf<T16>(df, "Sigmoid", SigmoidArray, CallSigmoid<DF, V>,
+                             -20.0f, 20.0f);
+    VerifyMathArrayHalf<T16>(df, "Sin", SinArray, CallSin<DF, V>, -1E4f, 1E4f);
+    VerifyMathArrayHalf<T16>(df, "Sinh", SinhArray, CallSinh<DF, V>, -10.0f,
+                             10.0f);
+    VerifyMathArrayHalf<T16>(df, "Tan", TanArray, CallTan<DF, V>, -1E4f, 1E4f);
+    VerifyMathArrayHalf<T16>(df, "Tanh", TanhArray, CallTanh<DF, V>, -20.0f,
+                             20.0f);
+
+    constexpr FastPrecision kApprox = FastPrecision::kApprox;
+    VerifyMathArrayHalf<T16>(df, "FastExp", FastExpArray,
+                             CallFastExp<kApprox, DF, V>, -20.0f, 20.0f);
+    VerifyMathArrayHalf<T16>(df, "FastLog", FastLogArray,
+                             CallFastLog<kApprox, DF, V>, 1E-4f, 6E4f);
+    VerifyMathArrayHalf<T16>(df, "FastSigmoid", FastSigmoidArray,
+                             CallFastSigmoid<kApprox, DF, V>, -20.0f, 20.0f);
+    VerifyMathArrayHalf<T16>(df, "FastTanh", FastTanhArray,
+                             CallFastTanh<kApprox, DF, V>, -20.0f, 20.0f);
+    VerifyFastHalfSpecial<T16>();
+  }
+};
+
+HWY_NOINLINE void TestAllMathArrayHalf() {
+#if HWY_HAVE_FLOAT16
+  TestMathArrayHalf()(float16_t(), ScalableTag<float>());
+#endif
+  TestMathArrayHalf()(bfloat16_t(), ScalableTag<float>());
+}
+
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
 }  // namespace hwy
@@ -212,17 +883,32 @@ HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllAcosh);
 HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllAsin);
 HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllAsinh);
 HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllAtan);
+HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllAtan2);
 HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllAtanh);
+HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllCbrt);
 HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllCos);
+HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllErf);
+HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllErfc);
 HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllExp);
+HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllExp2);
+HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllExpAndExpm1);
 HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllExpm1);
+HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllFastMath);
+HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllHypot);
 HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllLog);
 HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllLog10);
 HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllLog1p);
 HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllLog2);
+HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllLogAndLogb);
+HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllPow);
+HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllSigmoid);
 HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllSin);
+HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllSinCos);
 HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllSinh);
+HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllTan);
 HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllTanh);
+HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllMathArray);
+HWY_EXPORT_AND_TEST_P(HwyMathTest, TestAllMathArrayHalf);
 }  // namespace hwy
 
 #endif
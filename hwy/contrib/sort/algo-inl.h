@@ -17,16 +17,19 @@
 #ifndef HIGHWAY_HWY_CONTRIB_SORT_ALGO_INL_H_
 #define HIGHWAY_HWY_CONTRIB_SORT_ALGO_INL_H_
 
+#include <math.h>  // exp, log
 #include <stdint.h>
 #include <string.h>  // memcpy
 
 #include <algorithm>   // std::sort, std::min, std::max
 #include <functional>  // std::less, std::greater
+#include <memory>      // std::unique_ptr
 #include <thread>      // NOLINT
 #include <vector>
 
 #include "hwy/base.h"
 #include "hwy/contrib/sort/vqsort.h"
+#include "hwy/contrib/thread_pool/thread_pool.h"
 
 // Third-party algorithms
 #define HAVE_AVX2SORT 0
@@ -96,12 +99,43 @@ HWY_POP_ATTRIBUTES
 
 namespace hwy {
 
-enum class Dist { kUniform8, kUniform16, kUniform32 };
+// kSorted/kReverse are kUniform32 sorted ascending/descending by lane, which
+// also sorts 128-bit keys and KV pairs. kSortedTail is sorted except for the
+// last 1% (e.g. an appended time series with late arrivals). kSortedRuns
+// consists of 16 sorted runs, kOrganPipe of an ascending then a descending
+// half. kZipf draws ranks 1..16383 with probability proportional to 1/rank
+// (e.g. word frequencies), kFewUnique has 16 distinct lane values and in
+// kAllEqualButOne, a single random lane differs from all others.
+enum class Dist {
+  kUniform8,
+  kUniform16,
+  kUniform32,
+  kSorted,
+  kReverse,
+  kSortedTail,
+  kSortedRuns,
+  kOrganPipe,
+  kZipf,
+  kFewUnique,
+  kAllEqualButOne
+};
 
 static inline std::vector<Dist> AllDist() {
   return {/*Dist::kUniform8, Dist::kUniform16,*/ Dist::kUniform32};
 }
 
+// For demonstrating the special case for (almost) presorted input.
+static inline std::vector<Dist> PresortedDist() {
+  return {Dist::kUniform32, Dist::kSorted, Dist::kReverse, Dist::kSortedTail};
+}
+
+// For tracking throughput on inputs with structure or skew.
+static inline std::vector<Dist> SkewedDist() {
+  return {Dist::kUniform32,  Dist::kSortedRuns, Dist::kReverse,
+          Dist::kOrganPipe,  Dist::kZipf,       Dist::kFewUnique,
+          Dist::kAllEqualButOne};
+}
+
 static inline const char* DistName(Dist dist) {
   switch (dist) {
     case Dist::kUniform8:
@@ -110,6 +144,22 @@ static inline const char* DistName(Dist dist) {
       return "uniform16";
     case Dist::kUniform32:
       return "uniform32";
+    case Dist::kSorted:
+      return "sorted";
+    case Dist::kReverse:
+      return "reverse";
+    case Dist::kSortedTail:
+      return "sorted_tail";
+    case Dist::kSortedRuns:
+      return "sorted_runs";
+    case Dist::kOrganPipe:
+      return "organ_pipe";
+    case Dist::kZipf:
+      return "zipf";
+    case Dist::kFewUnique:
+      return "few_unique";
+    case Dist::kAllEqualButOne:
+      return "equal_but_one";
   }
   return "unreachable";
 }
@@ -180,7 +230,17 @@ enum class Algo {
 #endif
   kStd,
   kVQSort,
+  kParallelVQSort,
   kHeap,
+  // Sort without / with radix sort, regardless of the Sorter heuristic.
+  kVQQuick,
+  kVQRadix,
+  // Not sorts: only find the median, see BenchSelect.
+  kStdSelect,
+  kVQSelect,
+  // Only for key-value types, see BenchStableSort.
+  kStdStable,
+  kVQStable,
 };
 
 static inline const char* AlgoName(Algo algo) {
@@ -213,8 +273,22 @@ static inline const char* AlgoName(Algo algo) {
       return "std";
     case Algo::kVQSort:
       return "vq";
+    case Algo::kParallelVQSort:
+      return "par_vq";
     case Algo::kHeap:
       return "heap";
+    case Algo::kVQQuick:
+      return "vq_quick";
+    case Algo::kVQRadix:
+      return "vq_radix";
+    case Algo::kStdSelect:
+      return "std_select";
+    case Algo::kVQSelect:
+      return "vq_select";
+    case Algo::kStdStable:
+      return "std_stable";
+    case Algo::kVQStable:
+      return "vq_stable";
   }
   return "unreachable";
 }
@@ -234,6 +308,7 @@ static inline const char* AlgoName(Algo algo) {
 #include "hwy/contrib/sort/traits-inl.h"
 #include "hwy/contrib/sort/traits128-inl.h"
 #include "hwy/contrib/sort/vqsort-inl.h"  // HeapSort
+#include "hwy/contrib/sort/radix-inl.h"
 #include "hwy/tests/test_util-inl.h"
 
 HWY_BEFORE_NAMESPACE();
@@ -352,6 +427,48 @@ InputStats<T> GenerateInput(const Dist dist, T* v, size_t num) {
     memcpy(v + i, buf.get(), (num - i) * sizeof(T));
   }
 
+  // Split points are even so that they do not separate the lanes of 128-bit
+  // keys or KV pairs.
+  RandomState rng(num);
+  if (dist == Dist::kSorted || dist == Dist::kSortedTail) {
+    const size_t tail = (dist == Dist::kSortedTail) ? num / 100 : 0;
+    std::sort(v, v + num - tail);
+  } else if (dist == Dist::kReverse) {
+    std::sort(v, v + num, std::greater<T>());
+  } else if (dist == Dist::kSortedRuns) {
+    const size_t run = HWY_MAX(size_t{2}, (num / 16) & ~size_t{1});
+    for (size_t begin = 0; begin < num; begin += run) {
+      std::sort(v + begin, v + HWY_MIN(begin + run, num));
+    }
+  } else if (dist == Dist::kOrganPipe) {
+    const size_t half = (num / 2) & ~size_t{1};
+    std::sort(v, v + half);
+    std::sort(v + half, v + num, std::greater<T>());
+  } else if (dist == Dist::kZipf) {
+    // Inverse CDF of the continuous approximation: rank = kMaxRank^u. Ranks
+    // are small enough for all key types, including int16_t.
+    const double log_max_rank = log(16384.0);
+    for (size_t i = 0; i < num; ++i) {
+      // Uniform in [0, 1): 53 random bits divided by 2^53.
+      const double u =
+          static_cast<double>(Random64(&rng) >> 11) / 9007199254740992.0;
+      v[i] = static_cast<T>(floor(exp(u * log_max_rank)));
+    }
+  } else if (dist == Dist::kFewUnique) {
+    constexpr size_t kUnique = 16;
+    for (size_t i = kUnique; i < num; ++i) {
+      v[i] = v[Random32(&rng) % kUnique];
+    }
+  } else if (dist == Dist::kAllEqualButOne && num != 0) {
+    size_t differs = 1;
+    while (differs < num && v[differs] == v[0]) ++differs;
+    const T other = differs < num ? v[differs] : v[0];
+    for (size_t i = 1; i < num; ++i) {
+      v[i] = v[0];
+    }
+    v[Random64(&rng) % num] = other;
+  }
+
   InputStats<T> input_stats;
   for (size_t i = 0; i < num; ++i) {
     input_stats.Notify(v[i]);
@@ -370,6 +487,22 @@ struct SharedState {
       HWY_MIN(max_threads, std::thread::hardware_concurrency() / 2))};
 #endif
   std::vector<ThreadLocal> tls{1};
+
+  // Threads used by kParallelVQSort. Same as the ips4o pool size for
+  // comparability.
+  static size_t NumParallelThreads() {
+    return HWY_MAX(size_t{1}, std::thread::hardware_concurrency() / 2);
+  }
+
+  // For kParallelVQSort. Created on first use so that other algorithms do not
+  // start its threads.
+  ThreadPool& VQPool() {
+    if (!vq_pool_) vq_pool_.reset(new ThreadPool(NumParallelThreads()));
+    return *vq_pool_;
+  }
+
+ private:
+  std::unique_ptr<ThreadPool> vq_pool_;
 };
 
 // Bridge from keys (passed to Run) to lanes as expected by HeapSort. For
@@ -387,7 +520,6 @@ void CallHeapSort(KeyType* HWY_RESTRICT keys, const size_t num_keys) {
   }
 }
 
-#if VQSORT_ENABLED
 template <class Order>
 void CallHeapSort(hwy::uint128_t* HWY_RESTRICT keys, const size_t num_keys) {
   using detail::SharedTraits;
@@ -417,7 +549,71 @@ void CallHeapSort(K64V64* HWY_RESTRICT keys, const size_t num_keys) {
     return detail::HeapSort(st, lanes, num_lanes);
   }
 }
-#endif  // VQSORT_ENABLED
+
+// Bypass the Sorter heuristic for choosing between quicksort and radix sort.
+template <class Order, typename KeyType, HWY_IF_NOT_LANE_SIZE(KeyType, 16)>
+void CallQuickSort(KeyType* HWY_RESTRICT keys, const size_t num_keys) {
+  using detail::SharedTraits;
+  using detail::TraitsLane;
+  const SortTag<KeyType> d;
+  auto buf = hwy::AllocateAligned<KeyType>(
+      SortConstants::BufNum<KeyType>(HWY_LANES(KeyType)));
+  if (Order().IsAscending()) {
+    const SharedTraits<TraitsLane<detail::OrderAscending<KeyType>>> st;
+    return Sort(d, st, keys, num_keys, buf.get());
+  } else {
+    const SharedTraits<TraitsLane<detail::OrderDescending<KeyType>>> st;
+    return Sort(d, st, keys, num_keys, buf.get());
+  }
+}
+
+template <class Order, typename KeyType, HWY_IF_LANE_SIZE(KeyType, 16)>
+void CallQuickSort(KeyType* HWY_RESTRICT /* keys */, size_t /* num_keys */) {
+  HWY_ABORT("CallQuickSort only supports lane keys");
+}
+
+template <class Order, typename KeyType,
+          hwy::EnableIf<sizeof(KeyType) == 2 || sizeof(KeyType) == 4>* =
+              nullptr>
+void CallRadixSort(KeyType* HWY_RESTRICT keys, const size_t num_keys) {
+  using detail::SharedTraits;
+  using detail::TraitsLane;
+  const SortTag<KeyType> d;
+  if (Order().IsAscending()) {
+    const SharedTraits<TraitsLane<detail::OrderAscending<KeyType>>> st;
+    HWY_ASSERT(RadixSort(d, st, keys, num_keys));
+  } else {
+    const SharedTraits<TraitsLane<detail::OrderDescending<KeyType>>> st;
+    HWY_ASSERT(RadixSort(d, st, keys, num_keys));
+  }
+}
+
+template <class Order, typename KeyType,
+          hwy::EnableIf<sizeof(KeyType) != 2 && sizeof(KeyType) != 4>* =
+              nullptr>
+void CallRadixSort(KeyType* HWY_RESTRICT /* keys */, size_t /* num_keys */) {
+  HWY_ABORT("RadixSort requires 16 or 32-bit keys");
+}
+
+// Sorter::StableSort is only defined for key-value types; for others, equal
+// keys are indistinguishable.
+template <class Order, typename KeyType>
+void CallStableSort(const Sorter& /* sorter */, KeyType* HWY_RESTRICT /*keys*/,
+                    size_t /* num_keys */) {
+  HWY_ABORT("StableSort requires K32V32 or K64V64");
+}
+
+template <class Order>
+void CallStableSort(const Sorter& sorter, K32V32* HWY_RESTRICT keys,
+                    size_t num_keys) {
+  sorter.StableSort(keys, num_keys, Order());
+}
+
+template <class Order>
+void CallStableSort(const Sorter& sorter, K64V64* HWY_RESTRICT keys,
+                    size_t num_keys) {
+  sorter.StableSort(keys, num_keys, Order());
+}
 
 template <class Order, typename KeyType>
 void Run(Algo algo, KeyType* HWY_RESTRICT inout, size_t num,
@@ -497,9 +693,38 @@ void Run(Algo algo, KeyType* HWY_RESTRICT inout, size_t num,
     case Algo::kVQSort:
       return shared.tls[thread].sorter(inout, num, Order());
 
+    case Algo::kParallelVQSort:
+      return shared.tls[thread].sorter(inout, num, Order(), shared.VQPool());
+
     case Algo::kHeap:
       return CallHeapSort<Order>(inout, num);
 
+    case Algo::kVQQuick:
+      return CallQuickSort<Order>(inout, num);
+
+    case Algo::kVQRadix:
+      return CallRadixSort<Order>(inout, num);
+
+    case Algo::kStdSelect:
+      if (Order().IsAscending()) {
+        return std::nth_element(inout, inout + num / 2, inout + num, less);
+      } else {
+        return std::nth_element(inout, inout + num / 2, inout + num, greater);
+      }
+
+    case Algo::kVQSelect:
+      return shared.tls[thread].sorter.Select(inout, num, num / 2, Order());
+
+    case Algo::kStdStable:
+      if (Order().IsAscending()) {
+        return std::stable_sort(inout, inout + num, less);
+      } else {
+        return std::stable_sort(inout, inout + num, greater);
+      }
+
+    case Algo::kVQStable:
+      return CallStableSort<Order>(shared.tls[thread].sorter, inout, num);
+
     default:
       HWY_ABORT("Not implemented");
   }
@@ -0,0 +1,100 @@
+// Copyright 2022 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures the throughput of ExternalSort for inputs several times larger
+// than its memory budget, including the I/O of temporary files.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <vector>
+
+#include "hwy/base.h"
+#include "hwy/contrib/sort/external_sort.h"
+#include "hwy/nanobenchmark.h"
+#include "gtest/gtest.h"
+
+namespace hwy {
+namespace {
+
+// Writes `input_bytes` of random keys in blocks.
+template <typename T>
+FILE* GenerateFile(size_t input_bytes) {
+  FILE* file = tmpfile();
+  HWY_ASSERT(file != nullptr);
+  uint64_t state = 0x9E3779B97F4A7C15ull;
+  std::vector<uint64_t> block(size_t{1} << 20);
+  for (size_t written = 0; written < input_bytes;) {
+    for (uint64_t& bits : block) {
+      // SplitMix64
+      uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+      bits = z ^ (z >> 31);
+    }
+    const size_t bytes = HWY_MIN(block.size() * sizeof(uint64_t),
+                                 input_bytes - written);
+    HWY_ASSERT(fwrite(block.data(), 1, bytes, file) == bytes);
+    written += bytes;
+  }
+  return file;
+}
+
+template <typename T>
+void BenchExternalSort(const char* caption, size_t input_bytes,
+                       size_t memory_bytes, size_t num_threads) {
+  input_bytes -= input_bytes % sizeof(T);
+  FILE* in = GenerateFile<T>(input_bytes);
+  FILE* out = tmpfile();
+  HWY_ASSERT(out != nullptr);
+  HWY_ASSERT(fflush(in) == 0);
+  rewind(in);
+
+  ExternalSortOptions options;
+  options.memory_bytes = memory_bytes;
+  options.num_threads = num_threads;
+  const double t0 = platform::Now();
+  HWY_ASSERT(ExternalSort<T>(in, out, SortAscending(), options));
+  HWY_ASSERT(fflush(out) == 0);
+  const double elapsed = platform::Now() - t0;
+
+  HWY_ASSERT(static_cast<size_t>(ftell(out)) == input_bytes);
+  fclose(in);
+  fclose(out);
+
+  const double bytes = static_cast<double>(input_bytes);
+  const double MiB = 1024.0 * 1024.0;
+  fprintf(stderr,
+          "%6s: %7.1f MiB, memory %6.1f MiB, %zu threads: %6.3f s = %.3f "
+          "GB/s\n",
+          caption, bytes / MiB, static_cast<double>(memory_bytes) / MiB,
+          num_threads, elapsed, bytes / elapsed * 1E-9);
+}
+
+TEST(ExternalSortBench, BenchAll) {
+  const size_t M = size_t{1} << 20;
+  for (size_t num_threads : {size_t{1}, size_t{4}}) {
+    // In memory, for comparison.
+    BenchExternalSort<uint64_t>("u64", 256 * M, 256 * M, num_threads);
+    // 4 and 16 runs.
+    BenchExternalSort<uint64_t>("u64", 256 * M, 64 * M, num_threads);
+    BenchExternalSort<uint64_t>("u64", 1024 * M, 64 * M, num_threads);
+    BenchExternalSort<K64V64>("KV128", 1024 * M, 64 * M, num_threads);
+  }
+}
+
+}  // namespace
+}  // namespace hwy
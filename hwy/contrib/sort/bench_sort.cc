@@ -15,7 +15,9 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>  // memset
 
+#include <algorithm>  // std::stable_sort
 #include <vector>
 
 // clang-format off
@@ -212,7 +214,9 @@ std::vector<Algo> AlgoForBench() {
 }
 
 template <class Traits>
-HWY_NOINLINE void BenchSort(size_t num_keys) {
+HWY_NOINLINE void BenchSort(size_t num_keys,
+                            const std::vector<Dist>& dists = AllDist(),
+                            const std::vector<Algo>& algos = AlgoForBench()) {
   if (first_sort_target == 0) first_sort_target = HWY_TARGET;
 
   SharedState shared;
@@ -225,16 +229,17 @@ HWY_NOINLINE void BenchSort(size_t num_keys) {
 
   const size_t reps = num_keys > 1000 * 1000 ? 10 : 30;
 
-  for (Algo algo : AlgoForBench()) {
+  for (Algo algo : algos) {
     // Other algorithms don't depend on the vector instructions, so only run
     // them for the first target.
 #if !HAVE_VXSORT
-    if (algo != Algo::kVQSort && HWY_TARGET != first_sort_target) {
+    if (algo != Algo::kVQSort && algo != Algo::kVQQuick &&
+        algo != Algo::kVQRadix && HWY_TARGET != first_sort_target) {
       continue;
     }
 #endif
 
-    for (Dist dist : AllDist()) {
+    for (Dist dist : dists) {
       std::vector<double> seconds;
       for (size_t rep = 0; rep < reps; ++rep) {
         InputStats<LaneType> input_stats =
@@ -289,6 +294,307 @@ HWY_NOINLINE void BenchAllSort() {
   }
 }
 
+// Sorted, reversed and almost sorted inputs, compared with uniform random.
+HWY_NOINLINE void BenchAllPresorted() {
+  // Not interested in benchmark results for these targets
+  if (HWY_TARGET == HWY_SSSE3 || HWY_TARGET == HWY_SSE4) {
+    return;
+  }
+
+  const size_t num_keys = 1000 * 1000;
+  BenchSort<TraitsLane<OrderAscending<float>>>(num_keys, PresortedDist());
+  BenchSort<TraitsLane<OrderDescending<int32_t>>>(num_keys, PresortedDist());
+  BenchSort<TraitsLane<OrderAscending<int64_t>>>(num_keys, PresortedDist());
+#if !HAVE_VXSORT && VQSORT_ENABLED
+  BenchSort<Traits128<OrderAscending128>>(num_keys, PresortedDist());
+#endif
+}
+
+// Inputs with structure (runs, organ pipe) or skew (Zipf, few unique keys),
+// compared with uniform random. For regression tracking, see ResultFormat.
+HWY_NOINLINE void BenchAllSkewed() {
+  // Not interested in benchmark results for these targets
+  if (HWY_TARGET == HWY_SSSE3 || HWY_TARGET == HWY_SSE4) {
+    return;
+  }
+
+  const size_t num_keys = 1000 * 1000;
+  BenchSort<TraitsLane<OrderAscending<float>>>(num_keys, SkewedDist());
+  BenchSort<TraitsLane<OrderDescending<int32_t>>>(num_keys, SkewedDist());
+  BenchSort<TraitsLane<OrderAscending<uint64_t>>>(num_keys, SkewedDist());
+#if !HAVE_VXSORT && VQSORT_ENABLED
+  BenchSort<Traits128<OrderAscending128>>(num_keys, SkewedDist());
+#endif
+}
+
+// Quicksort vs. radix sort for increasing sizes, to find the crossover for
+// RadixConstants::kMinKeys16/32 on each target. kVQSort uses the heuristic.
+HWY_NOINLINE void BenchAllRadix() {
+  // Not interested in benchmark results for these targets
+  if (HWY_TARGET == HWY_SSSE3 || HWY_TARGET == HWY_SSE4) {
+    return;
+  }
+
+  const std::vector<Algo> algos = {Algo::kVQQuick, Algo::kVQRadix,
+                                   Algo::kVQSort};
+  for (size_t num_keys = 1024; num_keys <= (size_t{16} << 20);
+       num_keys *= 4) {
+    BenchSort<TraitsLane<OrderAscending<uint16_t>>>(num_keys, AllDist(),
+                                                     algos);
+    BenchSort<TraitsLane<OrderDescending<int16_t>>>(num_keys, AllDist(),
+                                                     algos);
+    BenchSort<TraitsLane<OrderAscending<uint32_t>>>(num_keys, AllDist(),
+                                                     algos);
+    BenchSort<TraitsLane<OrderDescending<int32_t>>>(num_keys, AllDist(),
+                                                     algos);
+    BenchSort<TraitsLane<OrderAscending<float>>>(num_keys, AllDist(), algos);
+  }
+}
+
+// Many small segments, sorted by one Sorter call per segment (per_call) or a
+// single SortSegments (segments).
+template <class Traits>
+HWY_NOINLINE void BenchSegments(size_t segment_keys) {
+  detail::SharedTraits<Traits> st;
+  using Order = typename Traits::Order;
+  using LaneType = typename Traits::LaneType;
+  using KeyType = typename Traits::KeyType;
+  const size_t num_segments = 1000 * 1000 / segment_keys;
+  const size_t num_keys = num_segments * segment_keys;
+  const size_t num_lanes = num_keys * st.LanesPerKey();
+  auto aligned = hwy::AllocateAligned<LaneType>(num_lanes);
+  KeyType* keys = reinterpret_cast<KeyType*>(aligned.get());
+
+  std::vector<size_t> offsets(num_segments + 1);
+  for (size_t i = 0; i <= num_segments; ++i) {
+    offsets[i] = i * segment_keys;
+  }
+
+  Sorter sorter;
+  for (bool batched : {false, true}) {
+    std::vector<double> seconds;
+    for (size_t rep = 0; rep < 10; ++rep) {
+      (void)GenerateInput(Dist::kUniform32, aligned.get(), num_lanes);
+
+      const Timestamp t0;
+      if (batched) {
+        sorter.SortSegments(keys, offsets.data(), num_segments, Order());
+      } else {
+        for (size_t i = 0; i < num_segments; ++i) {
+          sorter(keys + offsets[i], segment_keys, Order());
+        }
+      }
+      seconds.push_back(SecondsSince(t0));
+    }
+    const double bytes = static_cast<double>(num_keys * sizeof(KeyType));
+    printf("%10s: %12s: %7s: %4zu keys per segment: %4.0f MB/s\n",
+           hwy::TargetName(HWY_TARGET), batched ? "segments" : "per_call",
+           st.KeyString().c_str(), segment_keys,
+           bytes * 1E-6 / SummarizeMeasurements(seconds));
+  }
+}
+
+HWY_NOINLINE void BenchAllSegments() {
+  // Not interested in benchmark results for these targets
+  if (HWY_TARGET == HWY_SSSE3 || HWY_TARGET == HWY_SSE4) {
+    return;
+  }
+
+  for (size_t segment_keys :
+       {size_t{8}, size_t{32}, size_t{64}, size_t{256}}) {
+    BenchSegments<TraitsLane<OrderAscending<uint32_t>>>(segment_keys);
+    BenchSegments<TraitsLane<OrderAscending<float>>>(segment_keys);
+    BenchSegments<TraitsLane<OrderAscending<uint64_t>>>(segment_keys);
+  }
+}
+
+// Selecting the median (e.g. for percentiles), as opposed to sorting.
+template <class Traits>
+HWY_NOINLINE void BenchSelect(size_t num_keys) {
+  if (first_sort_target == 0) first_sort_target = HWY_TARGET;
+
+  SharedState shared;
+  detail::SharedTraits<Traits> st;
+  using Order = typename Traits::Order;
+  using LaneType = typename Traits::LaneType;
+  using KeyType = typename Traits::KeyType;
+  const size_t num_lanes = num_keys * st.LanesPerKey();
+  auto aligned = hwy::AllocateAligned<LaneType>(num_lanes);
+
+  const size_t reps = num_keys > 1000 * 1000 ? 10 : 30;
+
+  for (Algo algo : {Algo::kStdSelect, Algo::kVQSelect}) {
+    // std::nth_element does not depend on the vector instructions.
+    if (algo != Algo::kVQSelect && HWY_TARGET != first_sort_target) {
+      continue;
+    }
+
+    for (Dist dist : AllDist()) {
+      std::vector<double> seconds;
+      for (size_t rep = 0; rep < reps; ++rep) {
+        InputStats<LaneType> input_stats =
+            GenerateInput(dist, aligned.get(), num_lanes);
+
+        const Timestamp t0;
+        Run<Order>(algo, reinterpret_cast<KeyType*>(aligned.get()), num_keys,
+                   shared, /*thread=*/0);
+        seconds.push_back(SecondsSince(t0));
+
+        HWY_ASSERT(VerifySelect(st, input_stats, aligned.get(), num_lanes,
+                                num_keys / 2 * st.LanesPerKey(),
+                                "BenchSelect"));
+      }
+      Result(algo, dist, num_keys, 1, SummarizeMeasurements(seconds),
+             sizeof(KeyType), st.KeyString())
+          .Print();
+    }  // dist
+  }    // algo
+}
+
+HWY_NOINLINE void BenchAllSelect() {
+  // Not interested in benchmark results for these targets
+  if (HWY_TARGET == HWY_SSSE3 || HWY_TARGET == HWY_SSE4) {
+    return;
+  }
+
+  constexpr size_t M = 1000 * 1000;
+  BenchSelect<TraitsLane<OrderAscending<float>>>(1 * M);
+#if HWY_HAVE_FLOAT64
+  BenchSelect<TraitsLane<OrderAscending<double>>>(1 * M);
+#endif
+  BenchSelect<TraitsLane<OrderDescending<int32_t>>>(1 * M);
+  BenchSelect<TraitsLane<OrderAscending<uint64_t>>>(1 * M);
+}
+
+#if VQSORT_ENABLED
+
+// Stable sorting of key-value pairs, as opposed to the default unstable sort.
+template <class Traits>
+HWY_NOINLINE void BenchStableSort(size_t num_keys) {
+  if (first_sort_target == 0) first_sort_target = HWY_TARGET;
+
+  SharedState shared;
+  detail::SharedTraits<Traits> st;
+  using Order = typename Traits::Order;
+  using LaneType = typename Traits::LaneType;
+  using KeyType = typename Traits::KeyType;
+  const size_t num_lanes = num_keys * st.LanesPerKey();
+  auto aligned = hwy::AllocateAligned<LaneType>(num_lanes);
+
+  const size_t reps = num_keys > 1000 * 1000 ? 10 : 30;
+
+  for (Algo algo : {Algo::kStdStable, Algo::kVQStable, Algo::kVQSort}) {
+    // std::stable_sort does not depend on the vector instructions.
+    if (algo == Algo::kStdStable && HWY_TARGET != first_sort_target) {
+      continue;
+    }
+
+    for (Dist dist : {Dist::kUniform8, Dist::kUniform32}) {
+      std::vector<double> seconds;
+      for (size_t rep = 0; rep < reps; ++rep) {
+        InputStats<LaneType> input_stats =
+            GenerateInput(dist, aligned.get(), num_lanes);
+
+        const Timestamp t0;
+        Run<Order>(algo, reinterpret_cast<KeyType*>(aligned.get()), num_keys,
+                   shared, /*thread=*/0);
+        seconds.push_back(SecondsSince(t0));
+
+        HWY_ASSERT(VerifySort(st, input_stats, aligned.get(), num_lanes,
+                              "BenchStableSort"));
+      }
+      Result(algo, dist, num_keys, 1, SummarizeMeasurements(seconds),
+             sizeof(KeyType), st.KeyString())
+          .Print();
+    }  // dist
+  }    // algo
+}
+
+HWY_NOINLINE void BenchAllStableSort() {
+  // Not interested in benchmark results for these targets
+  if (HWY_TARGET == HWY_SSSE3 || HWY_TARGET == HWY_SSE4) {
+    return;
+  }
+
+  constexpr size_t M = 1000 * 1000;
+  // Not KV64: its KeyType is uint64_t, for which StableSort is not defined.
+  BenchStableSort<Traits128<OrderAscendingKV128>>(1 * M);
+}
+
+template <size_t kRecordBytes, typename TK>
+struct Record {
+  TK key;
+  uint8_t payload[kRecordBytes - sizeof(TK)];
+};
+
+// Records with a key and payload, sorted by std::stable_sort, which moves the
+// entire records, or SortRecords, which only sorts key and index and then
+// moves each record once.
+template <size_t kRecordBytes, typename TK>
+HWY_NOINLINE void BenchRecords(size_t num_records) {
+  if (first_sort_target == 0) first_sort_target = HWY_TARGET;
+
+  using R = Record<kRecordBytes, TK>;
+  static_assert(sizeof(R) == kRecordBytes, "Unexpected padding");
+  auto keys = hwy::AllocateAligned<TK>(num_records);
+  std::vector<R> records(num_records);
+  Sorter sorter;
+
+  for (bool vq : {false, true}) {
+    // std::stable_sort does not depend on the vector instructions.
+    if (!vq && HWY_TARGET != first_sort_target) continue;
+
+    std::vector<double> seconds;
+    for (size_t rep = 0; rep < 10; ++rep) {
+      (void)GenerateInput(Dist::kUniform32, keys.get(), num_records);
+      for (size_t i = 0; i < num_records; ++i) {
+        records[i].key = keys[i];
+        memset(records[i].payload, static_cast<int>(i & 0xFF),
+               sizeof(records[i].payload));
+      }
+
+      const Timestamp t0;
+      if (vq) {
+        sorter.SortRecords(records.data(), num_records, kRecordBytes,
+                           &records[0].key, SortAscending());
+      } else {
+        std::stable_sort(records.begin(), records.end(),
+                         [](const R& a, const R& b) { return a.key < b.key; });
+      }
+      seconds.push_back(SecondsSince(t0));
+
+      for (size_t i = 1; i < num_records; ++i) {
+        HWY_ASSERT(records[i - 1].key <= records[i].key);
+      }
+    }
+    const double bytes = static_cast<double>(num_records * kRecordBytes);
+    printf("%10s: %12s: %3zu-byte records with %zu-byte key: %5.0f MB/s\n",
+           hwy::TargetName(HWY_TARGET), vq ? "records" : "std_stable",
+           kRecordBytes, sizeof(TK),
+           bytes * 1E-6 / SummarizeMeasurements(seconds));
+  }
+}
+
+HWY_NOINLINE void BenchAllRecords() {
+  // Not interested in benchmark results for these targets
+  if (HWY_TARGET == HWY_SSSE3 || HWY_TARGET == HWY_SSE4) {
+    return;
+  }
+
+  constexpr size_t M = 1000 * 1000;
+  BenchRecords<32, uint32_t>(1 * M);
+  BenchRecords<64, uint32_t>(1 * M);
+  BenchRecords<128, uint32_t>(1 * M);
+  BenchRecords<32, uint64_t>(1 * M);
+  BenchRecords<64, uint64_t>(1 * M);
+  BenchRecords<128, uint64_t>(1 * M);
+}
+
+#else
+void BenchAllStableSort() {}
+void BenchAllRecords() {}
+#endif  // VQSORT_ENABLED
+
 }  // namespace
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
@@ -304,6 +610,13 @@ HWY_BEFORE_TEST(BenchSort);
 HWY_EXPORT_AND_TEST_P(BenchSort, BenchAllPartition);
 HWY_EXPORT_AND_TEST_P(BenchSort, BenchAllBase);
 HWY_EXPORT_AND_TEST_P(BenchSort, BenchAllSort);
+HWY_EXPORT_AND_TEST_P(BenchSort, BenchAllPresorted);
+HWY_EXPORT_AND_TEST_P(BenchSort, BenchAllSkewed);
+HWY_EXPORT_AND_TEST_P(BenchSort, BenchAllRadix);
+HWY_EXPORT_AND_TEST_P(BenchSort, BenchAllSegments);
+HWY_EXPORT_AND_TEST_P(BenchSort, BenchAllSelect);
+HWY_EXPORT_AND_TEST_P(BenchSort, BenchAllStableSort);
+HWY_EXPORT_AND_TEST_P(BenchSort, BenchAllRecords);
 }  // namespace
 }  // namespace hwy
 
@@ -0,0 +1,232 @@
+// Copyright 2022 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hwy/contrib/sort/external_sort.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <algorithm>  // std::upper_bound
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "hwy/aligned_allocator.h"
+#include "hwy/contrib/thread_pool/thread_pool.h"
+
+namespace hwy {
+namespace {
+
+// Sorted chunk of the input in a temporary file, which is read back in blocks
+// during merging.
+template <typename T>
+class Run {
+ public:
+  Run(FILE* file, size_t num_keys) : file_(file), remaining_(num_keys) {}
+  Run(Run&& other) noexcept
+      : file_(other.file_),
+        remaining_(other.remaining_),
+        keys_(std::move(other.keys_)),
+        block_keys_(other.block_keys_),
+        begin_(other.begin_),
+        end_(other.end_) {
+    other.file_ = nullptr;
+  }
+  Run(const Run&) = delete;
+  Run& operator=(const Run&) = delete;
+  ~Run() {
+    if (file_ != nullptr) fclose(file_);  // also deletes the tmpfile
+  }
+
+  // Must be called before the first Refill.
+  bool Rewind(size_t block_keys) {
+    keys_ = hwy::AllocateAligned<T>(block_keys);
+    block_keys_ = block_keys;
+    return keys_ && fseek(file_, 0, SEEK_SET) == 0;
+  }
+
+  // Reads the next block if all buffered keys were consumed.
+  bool Refill() {
+    if (begin_ != end_ || remaining_ == 0) return true;
+    const size_t num = HWY_MIN(remaining_, block_keys_);
+    if (fread(keys_.get(), sizeof(T), num, file_) != num) return false;
+    remaining_ -= num;
+    begin_ = 0;
+    end_ = num;
+    return true;
+  }
+
+  // Whether keys after the buffered ones remain in the file.
+  bool HasMore() const { return remaining_ != 0; }
+
+  const T* Begin() const { return keys_.get() + begin_; }
+  const T* End() const { return keys_.get() + end_; }
+  void Consume(size_t num) { begin_ += num; }
+
+ private:
+  FILE* file_;
+  size_t remaining_;  // not yet read from `file_`
+  AlignedFreeUniquePtr<T[]> keys_;
+  size_t block_keys_ = 0;
+  // Buffered keys not yet consumed.
+  size_t begin_ = 0;
+  size_t end_ = 0;
+};
+
+template <typename T>
+bool WriteKeys(FILE* file, const T* keys, size_t num) {
+  return fwrite(keys, sizeof(T), num, file) == num;
+}
+
+// Returns whether `file` has no more bytes, without consuming any.
+bool AtEnd(FILE* file) {
+  const int c = fgetc(file);
+  if (c == EOF) return true;
+  ungetc(c, file);  // one character of pushback is guaranteed
+  return false;
+}
+
+// Repeatedly merges the longest prefixes of the buffered keys that are known
+// to precede all keys not yet read: those not ordered after the first (in sort
+// order) of the last buffered keys of all runs that have more keys. The run
+// with that last key is entirely consumed, hence every iteration refills at
+// least one block.
+template <typename T, class Order, class Compare>
+bool MergeRunFiles(const Sorter& sorter, std::vector<Run<T>>& runs,
+                   size_t memory_keys, Compare compare, FILE* out) {
+  // Equal shares of the memory for the blocks of each run, the output and, if
+  // Sorter::Merge requires it (more than two runs), its scratch memory. All
+  // are allocated here so that the merge loop does not allocate.
+  const size_t num_buffers = (runs.size() > 2) ? 3 : 2;
+  const size_t block_keys =
+      HWY_MAX(memory_keys / num_buffers / runs.size(), size_t{1});
+  for (Run<T>& run : runs) {
+    if (!run.Rewind(block_keys)) return false;
+  }
+  auto merged = hwy::AllocateAligned<T>(block_keys * runs.size());
+  if (!merged) return false;
+  AlignedFreeUniquePtr<T[]> scratch;
+  if (num_buffers == 3) {
+    scratch = hwy::AllocateAligned<T>(block_keys * runs.size());
+    if (!scratch) return false;
+  }
+
+  std::vector<const T*> prefixes(runs.size());
+  std::vector<size_t> prefix_sizes(runs.size());
+  for (;;) {
+    const T* bound = nullptr;
+    for (Run<T>& run : runs) {
+      if (!run.Refill()) return false;
+      if (run.HasMore() && (!bound || compare(run.End()[-1], *bound))) {
+        bound = run.End() - 1;
+      }
+    }
+
+    size_t total = 0;
+    for (size_t i = 0; i < runs.size(); ++i) {
+      const T* end = runs[i].End();
+      if (bound) {
+        end = std::upper_bound(runs[i].Begin(), end, *bound, compare);
+      }
+      prefixes[i] = runs[i].Begin();
+      prefix_sizes[i] = static_cast<size_t>(end - prefixes[i]);
+      total += prefix_sizes[i];
+    }
+    if (total == 0) return true;  // `bound` is null, hence all were consumed
+
+    sorter.Merge(prefixes.data(), prefix_sizes.data(), runs.size(),
+                 merged.get(), scratch.get(), Order());
+    if (!WriteKeys(out, merged.get(), total)) return false;
+    for (size_t i = 0; i < runs.size(); ++i) {
+      runs[i].Consume(prefix_sizes[i]);
+    }
+  }
+}
+
+template <typename T, class Order, class Compare>
+bool ExternalSortImpl(FILE* in, FILE* out, const ExternalSortOptions& options,
+                      Compare compare) {
+  const size_t memory_keys =
+      HWY_MAX(options.memory_bytes / sizeof(T), size_t{2});
+  Sorter sorter;
+  // Created once so that its workers are reused for every chunk.
+  ThreadPool pool(HWY_MAX(options.num_threads, size_t{1}));
+
+  // Sort chunks into runs.
+  std::vector<Run<T>> runs;
+  {
+    auto chunk = hwy::AllocateAligned<T>(memory_keys);
+    if (!chunk) return false;
+    for (;;) {
+      const size_t bytes = fread(chunk.get(), 1, memory_keys * sizeof(T), in);
+      // Also fails if trailing bytes do not form a key.
+      if (ferror(in) || bytes % sizeof(T) != 0) return false;
+      const size_t num = bytes / sizeof(T);
+      if (num == 0) break;
+      if (pool.NumThreads() > 1) {
+        sorter(chunk.get(), num, Order(), pool);
+      } else {
+        sorter(chunk.get(), num, Order());
+      }
+
+      // The entire input fits in memory: no need for a temporary file.
+      if (runs.empty() && (num != memory_keys || AtEnd(in))) {
+        if (ferror(in)) return false;
+        return WriteKeys(out, chunk.get(), num);
+      }
+
+      FILE* file = tmpfile();
+      if (file == nullptr) return false;
+      runs.emplace_back(file, num);
+      if (!WriteKeys(file, chunk.get(), num)) return false;
+    }
+  }  // Frees `chunk` before merging.
+
+  if (runs.empty()) return true;
+  return MergeRunFiles<T, Order>(sorter, runs, memory_keys, compare, out);
+}
+
+}  // namespace
+
+template <typename T, class Order>
+bool ExternalSort(FILE* in, FILE* out, Order,
+                  const ExternalSortOptions& options) {
+  if (Order().IsAscending()) {
+    return ExternalSortImpl<T, Order>(in, out, options, std::less<T>());
+  } else {
+    return ExternalSortImpl<T, Order>(in, out, options, std::greater<T>());
+  }
+}
+
+#define HWY_EXTERNAL_SORT_INSTANTIATE(T)                                   \
+  template HWY_CONTRIB_DLLEXPORT bool ExternalSort<T, SortAscending>(      \
+      FILE*, FILE*, SortAscending, const ExternalSortOptions&);            \
+  template HWY_CONTRIB_DLLEXPORT bool ExternalSort<T, SortDescending>(     \
+      FILE*, FILE*, SortDescending, const ExternalSortOptions&);
+
+HWY_EXTERNAL_SORT_INSTANTIATE(uint32_t)
+HWY_EXTERNAL_SORT_INSTANTIATE(uint64_t)
+HWY_EXTERNAL_SORT_INSTANTIATE(int32_t)
+HWY_EXTERNAL_SORT_INSTANTIATE(int64_t)
+HWY_EXTERNAL_SORT_INSTANTIATE(float)
+HWY_EXTERNAL_SORT_INSTANTIATE(double)
+HWY_EXTERNAL_SORT_INSTANTIATE(uint128_t)
+HWY_EXTERNAL_SORT_INSTANTIATE(K32V32)
+HWY_EXTERNAL_SORT_INSTANTIATE(K64V64)
+
+#undef HWY_EXTERNAL_SORT_INSTANTIATE
+
+}  // namespace hwy
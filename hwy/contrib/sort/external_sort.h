@@ -0,0 +1,55 @@
+// Copyright 2022 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HIGHWAY_HWY_CONTRIB_SORT_EXTERNAL_SORT_H_
+#define HIGHWAY_HWY_CONTRIB_SORT_EXTERNAL_SORT_H_
+
+// Sorts files that may be larger than memory.
+
+#include <stddef.h>
+#include <stdio.h>
+
+#include "hwy/base.h"
+#include "hwy/contrib/sort/vqsort.h"
+
+namespace hwy {
+
+struct ExternalSortOptions {
+  // Upper bound on the memory used for keys. Each run (sorted chunk of the
+  // input) is this large; the merge divides it among the runs.
+  size_t memory_bytes = size_t{256} << 20;
+  // Number of threads for sorting each chunk, see Sorter::operator().
+  size_t num_threads = 1;
+};
+
+// Reads keys of type T (in native layout, e.g. as written by fwrite) from the
+// current position of `in` until its end, and writes them to `out` in the
+// given order. If the input does not fit in `options.memory_bytes`, sorts
+// chunks of that size with Sorter and writes them to temporary files
+// (tmpfile), then merges them with Sorter::Merge, reading and writing large
+// blocks sequentially. The order of equal keys is unspecified. Returns false
+// if reading, writing, allocating memory or creating a temporary file failed,
+// or the size of `in` is not a multiple of sizeof(T).
+//
+// Defined for T = uint32_t, uint64_t, int32_t, int64_t, float, double,
+// uint128_t, K32V32 and K64V64.
+template <typename T, class Order>
+HWY_CONTRIB_DLLEXPORT bool ExternalSort(
+    FILE* in, FILE* out, Order,
+    const ExternalSortOptions& options = ExternalSortOptions());
+
+}  // namespace hwy
+
+#endif  // HIGHWAY_HWY_CONTRIB_SORT_EXTERNAL_SORT_H_
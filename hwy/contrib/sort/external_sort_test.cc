@@ -0,0 +1,121 @@
+// Copyright 2022 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hwy/contrib/sort/external_sort.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "hwy/base.h"
+#include "hwy/tests/test_util.h"
+#include "gtest/gtest.h"
+
+namespace hwy {
+namespace {
+
+// Writes `num_keys` random keys to a temporary file, sorts it into another and
+// checks the result is a sorted permutation of the input.
+template <typename T, class Order>
+void TestExternalSort(size_t num_keys, size_t memory_bytes) {
+  RandomState rng(num_keys);
+  std::vector<T> keys(num_keys);
+  for (T& key : keys) {
+    uint64_t bits[2] = {Random64(&rng), Random64(&rng)};
+    // For 16-byte keys, many equal upper halves; for K64V64, these are the
+    // keys, hence the values of equal keys are also checked.
+    bits[1] &= 0xFF00FF;
+    CopyBytes<sizeof(T)>(bits, &key);
+  }
+
+  FILE* in = tmpfile();
+  FILE* out = tmpfile();
+  HWY_ASSERT(in != nullptr && out != nullptr);
+  HWY_ASSERT(fwrite(keys.data(), sizeof(T), num_keys, in) == num_keys);
+  rewind(in);
+
+  ExternalSortOptions options;
+  options.memory_bytes = memory_bytes;
+  HWY_ASSERT(ExternalSort<T>(in, out, Order(), options));
+
+  std::vector<T> sorted(num_keys + 1);
+  rewind(out);
+  HWY_ASSERT(fread(sorted.data(), sizeof(T), num_keys + 1, out) == num_keys);
+  sorted.pop_back();
+  fclose(in);
+  fclose(out);
+
+  for (size_t i = 1; i < num_keys; ++i) {
+    const bool wrong_order = Order().IsAscending() ? sorted[i] < sorted[i - 1]
+                                                   : sorted[i - 1] < sorted[i];
+    if (wrong_order) {
+      HWY_ABORT("ExternalSort: wrong order at %d of %d\n",
+                static_cast<int>(i), static_cast<int>(num_keys));
+    }
+  }
+
+  // Same multiset of keys, including the values of KV.
+  const auto by_bytes = [](const T& a, const T& b) {
+    return memcmp(&a, &b, sizeof(T)) < 0;
+  };
+  std::sort(keys.begin(), keys.end(), by_bytes);
+  std::sort(sorted.begin(), sorted.end(), by_bytes);
+  HWY_ASSERT(memcmp(keys.data(), sorted.data(), num_keys * sizeof(T)) == 0);
+}
+
+template <typename T, class Order>
+void TestSizes() {
+  // Empty, fits in memory, exactly one run, several runs, many small runs.
+  TestExternalSort<T, Order>(0, 1024 * sizeof(T));
+  TestExternalSort<T, Order>(1000, 1024 * sizeof(T));
+  TestExternalSort<T, Order>(1024, 1024 * sizeof(T));
+  TestExternalSort<T, Order>(10000, 1024 * sizeof(T));
+  TestExternalSort<T, Order>(30000, 64 * sizeof(T));
+}
+
+TEST(ExternalSortTest, TestU64) {
+  TestSizes<uint64_t, SortAscending>();
+  TestSizes<uint64_t, SortDescending>();
+}
+
+TEST(ExternalSortTest, TestKV) {
+  TestSizes<K64V64, SortAscending>();
+  TestSizes<K64V64, SortDescending>();
+  TestSizes<K32V32, SortAscending>();
+}
+
+TEST(ExternalSortTest, TestOther) {
+  TestSizes<int32_t, SortDescending>();
+  TestSizes<uint128_t, SortAscending>();
+}
+
+TEST(ExternalSortTest, TestTrailingBytes) {
+  FILE* in = tmpfile();
+  FILE* out = tmpfile();
+  HWY_ASSERT(in != nullptr && out != nullptr);
+  const uint8_t bytes[9] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+  HWY_ASSERT(fwrite(bytes, 1, sizeof(bytes), in) == sizeof(bytes));
+  rewind(in);
+  HWY_ASSERT(!ExternalSort<uint64_t>(in, out, SortAscending()));
+  fclose(in);
+  fclose(out);
+}
+
+}  // namespace
+}  // namespace hwy
@@ -0,0 +1,348 @@
+// Copyright 2022 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Multi-threaded vqsort on a ThreadPool. Separate from vqsort-inl.h so that
+// only the translation units implementing the parallel Sorter overloads depend
+// on thread_pool.h.
+
+// Normal include guard for target-independent parts
+#ifndef HIGHWAY_HWY_CONTRIB_SORT_PARALLEL_INL_H_
+#define HIGHWAY_HWY_CONTRIB_SORT_PARALLEL_INL_H_
+
+#include <stddef.h>
+#include <stdio.h>
+
+#include <vector>
+
+#include "hwy/aligned_allocator.h"
+#include "hwy/base.h"
+#include "hwy/contrib/thread_pool/thread_pool.h"
+
+#endif  // HIGHWAY_HWY_CONTRIB_SORT_PARALLEL_INL_H_
+
+// Per-target
+#if defined(HIGHWAY_HWY_CONTRIB_SORT_PARALLEL_TOGGLE) == \
+    defined(HWY_TARGET_TOGGLE)
+#ifdef HIGHWAY_HWY_CONTRIB_SORT_PARALLEL_TOGGLE
+#undef HIGHWAY_HWY_CONTRIB_SORT_PARALLEL_TOGGLE
+#else
+#define HIGHWAY_HWY_CONTRIB_SORT_PARALLEL_TOGGLE
+#endif
+
+#include "hwy/contrib/sort/vqsort-inl.h"
+#include "hwy/highway.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+namespace detail {
+
+#if VQSORT_ENABLED || HWY_IDE
+
+// Subarrays are only split among threads if each thread receives at least this
+// many lanes; otherwise dispatching and the extra pass to exchange misplaced
+// keys would outweigh the gains.
+constexpr size_t kMinLanesPerThread = 8192;
+
+// Subarray of ParallelSort and the threads assigned to it. Once it has a single
+// thread, it is sorted by Recurse.
+template <typename T>
+struct ParallelSubarray {
+  size_t begin;  // lanes
+  size_t num;
+  size_t num_threads;
+  size_t per_thread;  // lanes per partitioned chunk, except for the last
+  T pivot[2];         // lanes of the key, only valid if num_threads > 1
+};
+
+// One chunk of a subarray, partitioned by a single thread.
+struct ParallelChunk {
+  size_t subarray;
+  size_t begin;
+  size_t num;
+  size_t bound;  // output of Partition
+};
+
+// Two equally long, non-overlapping ranges whose keys are to be exchanged.
+template <typename T>
+struct SwapSegment {
+  T* left;
+  T* right;
+  size_t num;  // lanes
+};
+
+// Exchanges the lanes in `[begin, end)` of the concatenation of all segments.
+template <class D, typename T>
+HWY_NOINLINE void SwapSegments(D d, const SwapSegment<T>* segments,
+                               size_t num_segments, size_t begin, size_t end) {
+  const size_t N = Lanes(d);
+  size_t pos = 0;  // of the current segment within the concatenation
+  for (size_t s = 0; s < num_segments && pos < end; ++s) {
+    const SwapSegment<T>& seg = segments[s];
+    const size_t from = HWY_MAX(begin, pos);
+    const size_t to = HWY_MIN(end, pos + seg.num);
+    if (from < to) {
+      T* HWY_RESTRICT left = seg.left + (from - pos);
+      T* HWY_RESTRICT right = seg.right + (from - pos);
+      const size_t num = to - from;
+      size_t i = 0;
+      for (; i + N <= num; i += N) {
+        const Vec<D> vl = LoadU(d, left + i);
+        const Vec<D> vr = LoadU(d, right + i);
+        StoreU(vr, d, left + i);
+        StoreU(vl, d, right + i);
+      }
+      for (; i < num; ++i) {
+        const T tmp = left[i];
+        left[i] = right[i];
+        right[i] = tmp;
+      }
+    }
+    pos += seg.num;
+  }
+}
+
+// Appends the segments that exchange the keys of `chunks` (the partitioned
+// chunks of one subarray, in order) that are on the wrong side of `bound`, the
+// partition point of the whole subarray. Returns the number of lanes to swap.
+template <typename T>
+HWY_INLINE size_t AppendSwapSegments(T* HWY_RESTRICT keys,
+                                     const ParallelChunk* chunks,
+                                     size_t num_chunks, size_t bound,
+                                     std::vector<SwapSegment<T>>& segments) {
+  // Each chunk is [begin, begin + bound) <= pivot, followed by > pivot. Pair
+  // up the right-side keys before `bound` with the left-side keys after it;
+  // there are equally many of each.
+  size_t total = 0;
+  size_t tl = 0, tr = 0;          // chunk indices
+  size_t skip_l = 0, skip_r = 0;  // lanes already paired in those chunks
+  for (;;) {
+    // Advance to the next chunk with right-side keys before `bound`.
+    size_t begin_l = 0, num_l = 0;
+    for (; tl < num_chunks; ++tl, skip_l = 0) {
+      begin_l = chunks[tl].begin + chunks[tl].bound + skip_l;
+      const size_t end = HWY_MIN(chunks[tl].begin + chunks[tl].num, bound);
+      num_l = end > begin_l ? end - begin_l : 0;
+      if (num_l != 0) break;
+    }
+    // Advance to the next chunk with left-side keys after `bound`.
+    size_t begin_r = 0, num_r = 0;
+    for (; tr < num_chunks; ++tr, skip_r = 0) {
+      begin_r = HWY_MAX(chunks[tr].begin, bound) + skip_r;
+      const size_t end = chunks[tr].begin + chunks[tr].bound;
+      num_r = end > begin_r ? end - begin_r : 0;
+      if (num_r != 0) break;
+    }
+    if (num_l == 0 || num_r == 0) break;
+    const size_t num_swap = HWY_MIN(num_l, num_r);
+    segments.push_back({keys + begin_l, keys + begin_r, num_swap});
+    total += num_swap;
+    skip_l += num_swap;
+    skip_r += num_swap;
+  }
+  return total;
+}
+
+// Single-threaded leaf of ParallelRecurse: a separate input from the point of
+// view of Recurse, which must not sort across `keys + num` because other
+// threads are concurrently sorting the neighboring subarrays.
+template <class D, class Traits, typename T>
+HWY_NOINLINE void SortSubarray(D d, Traits st, T* HWY_RESTRICT keys,
+                               size_t num, T* HWY_RESTRICT buf) {
+  Generator rng(keys, num);
+  const size_t max_levels = 2 * hwy::CeilLog2(num) + 4;
+  Recurse(d, st, keys, keys + num, num, buf, rng, max_levels);
+}
+
+// Sorts `keys[0, num)` using the threads of `pool`. Each level partitions
+// chunks of all subarrays in parallel around a pivot per subarray, exchanges
+// keys that ended up on the wrong side of the partition point of their
+// subarray, and divides the threads of each subarray among both sides in
+// proportion to their size. Subarrays with a single thread are sorted by
+// Recurse after the last level. Each level requires two ParallelFor; there are
+// no other thread creations. Thread `t` of `pool` uses the `buf_num` lanes
+// starting at `bufs + t * buf_num`, which are the only per-thread memory.
+template <class D, class Traits, typename T>
+HWY_NOINLINE void ParallelRecurse(D d, Traits st, T* HWY_RESTRICT keys,
+                                  const size_t num, ThreadPool& pool,
+                                  T* HWY_RESTRICT bufs, size_t buf_num) {
+  constexpr size_t N1 = st.LanesPerKey();
+
+  std::vector<ParallelSubarray<T>> subarrays(1);
+  subarrays[0].begin = 0;
+  subarrays[0].num = num;
+  subarrays[0].num_threads = pool.NumThreads();
+  std::vector<ParallelSubarray<T>> leaves;
+  std::vector<ParallelSubarray<T>> next;
+  std::vector<ParallelChunk> chunks;
+  std::vector<SwapSegment<T>> segments;
+
+  while (!subarrays.empty()) {
+    // Choose a pivot per subarray and split them into chunks; subarrays that
+    // are too small or (almost) all-equal become leaves.
+    chunks.clear();
+    next.clear();
+    for (ParallelSubarray<T>& sub : subarrays) {
+      sub.num_threads =
+          HWY_MIN(sub.num_threads, sub.num / kMinLanesPerThread);
+      if (sub.num_threads > 1) {
+        T* HWY_RESTRICT sub_keys = keys + sub.begin;
+        Generator rng(sub_keys, sub.num);
+        DrawSamples(d, st, sub_keys, sub.num, bufs, rng);
+        // Recurse has special handling for (almost) all-equal keys.
+        if (HWY_UNLIKELY(UnsortedSampleEqual(d, st, bufs))) {
+          sub.num_threads = 1;
+        } else {
+          SortSamples(d, st, bufs);
+          // Never the largest key, hence neither side is empty.
+          Store(ChoosePivotByRank(d, st, bufs), d, bufs);
+          CopyBytes<N1 * sizeof(T)>(bufs, sub.pivot);
+        }
+      }
+      if (sub.num_threads <= 1) {
+        leaves.push_back(sub);
+        continue;
+      }
+
+      // Chunks are whole cache lines to avoid false sharing.
+      sub.per_thread = (sub.num / sub.num_threads) &
+                       ~(Constants::LanesPerChunk(sizeof(T)) - 1);
+      for (size_t t = 0; t < sub.num_threads; ++t) {
+        const size_t begin = sub.begin + t * sub.per_thread;
+        const size_t end = (t == sub.num_threads - 1)
+                               ? sub.begin + sub.num
+                               : begin + sub.per_thread;
+        chunks.push_back({next.size(), begin, end - begin, 0});
+      }
+      next.push_back(sub);
+    }
+    if (next.empty()) break;
+
+    pool.ParallelFor(chunks.size(), 1,
+                     [&](uint64_t begin, uint64_t end, size_t thread) {
+                       for (uint64_t c = begin; c < end; ++c) {
+                         ParallelChunk& chunk = chunks[c];
+                         const Vec<D> pivot =
+                             st.SetKey(d, next[chunk.subarray].pivot);
+                         chunk.bound =
+                             Partition(d, st, keys + chunk.begin, chunk.num,
+                                       pivot, bufs + thread * buf_num);
+                       }
+                     });
+
+    // Exchange misplaced keys of all subarrays in a single ParallelFor.
+    segments.clear();
+    size_t total = 0;
+    subarrays.clear();
+    for (size_t c = 0; c < chunks.size();) {
+      const ParallelSubarray<T>& sub = next[chunks[c].subarray];
+      size_t bound = sub.begin;
+      for (size_t t = 0; t < sub.num_threads; ++t) {
+        bound += chunks[c + t].bound;
+      }
+      if (VQSORT_PRINT >= 1) {
+        fprintf(stderr, "ParallelRecurse num %zu threads %zu bound %zu\n",
+                sub.num, sub.num_threads, bound - sub.begin);
+      }
+      total += AppendSwapSegments(keys, &chunks[c], sub.num_threads, bound,
+                                  segments);
+      c += sub.num_threads;
+
+      // Divide threads in proportion to the size of each side.
+      const size_t num_left = bound - sub.begin;
+      size_t left_threads =
+          (sub.num_threads * num_left + sub.num / 2) / sub.num;
+      left_threads =
+          HWY_MIN(HWY_MAX(left_threads, size_t{1}), sub.num_threads - 1);
+      ParallelSubarray<T> left = sub;
+      left.num = num_left;
+      left.num_threads = left_threads;
+      ParallelSubarray<T> right = sub;
+      right.begin = bound;
+      right.num = sub.num - num_left;
+      right.num_threads = sub.num_threads - left_threads;
+      subarrays.push_back(left);
+      subarrays.push_back(right);
+    }
+
+    // Lanes are exchanged independently, so it is fine to split 128-bit keys.
+    const size_t swap_tasks = HWY_MIN(pool.NumThreads(),
+                                      DivCeil(total, kMinLanesPerThread));
+    if (swap_tasks != 0) {
+      pool.ParallelFor(swap_tasks, 1,
+                       [&](uint64_t begin, uint64_t end, size_t /*thread*/) {
+                         SwapSegments(d, segments.data(), segments.size(),
+                                      total * begin / swap_tasks,
+                                      total * end / swap_tasks);
+                       });
+    }
+  }
+
+  // Work stealing balances leaves of different sizes.
+  pool.ParallelFor(leaves.size(), 1,
+                   [&](uint64_t begin, uint64_t end, size_t thread) {
+                     for (uint64_t l = begin; l < end; ++l) {
+                       SortSubarray(d, st, keys + leaves[l].begin,
+                                    leaves[l].num, bufs + thread * buf_num);
+                     }
+                   });
+}
+
+#endif  // VQSORT_ENABLED
+}  // namespace detail
+
+// Same as Sort, but uses the threads of `pool` (including the caller's) if
+// `num` is large enough. Unlike Sort, allocates one buffer of
+// SortConstants::BufNum lanes per thread of `pool`.
+template <class D, class Traits, typename T>
+void ParallelSort(D d, Traits st, T* HWY_RESTRICT keys, size_t num,
+                  ThreadPool& pool) {
+  if (VQSORT_PRINT >= 1) {
+    fprintf(stderr, "=============== ParallelSort num %zu threads %zu\n", num,
+            pool.NumThreads());
+  }
+
+#if VQSORT_ENABLED || HWY_IDE
+  if (detail::HandleSpecialCases(d, st, keys, num)) return;
+
+#if HWY_MAX_BYTES > 64
+  // sorting_networks-inl and traits assume no more than 512 bit vectors.
+  if (HWY_UNLIKELY(Lanes(d) > 64 / sizeof(T))) {
+    return ParallelSort(CappedTag<T, 64 / sizeof(T)>(), st, keys, num, pool);
+  }
+#endif  // HWY_MAX_BYTES > 64
+
+  // Aligned to avoid false sharing between threads.
+  const size_t buf_num = RoundUpTo(SortConstants::BufNum<T>(Lanes(d)),
+                                   HWY_ALIGNMENT / sizeof(T));
+  auto bufs = hwy::AllocateAligned<T>(pool.NumThreads() * buf_num);
+  HWY_ASSERT(bufs);
+  detail::ParallelRecurse(d, st, keys, num, pool, bufs.get(), buf_num);
+#else
+  (void)d;
+  (void)pool;
+  if (VQSORT_PRINT >= 1) {
+    fprintf(stderr, "WARNING: using slow HeapSort because vqsort disabled\n");
+  }
+  return detail::HeapSort(st, keys, num);
+#endif  // VQSORT_ENABLED
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#endif  // HIGHWAY_HWY_CONTRIB_SORT_PARALLEL_TOGGLE
@@ -0,0 +1,332 @@
+// Copyright 2022 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Normal include guard for target-independent parts
+#ifndef HIGHWAY_HWY_CONTRIB_SORT_RADIX_INL_H_
+#define HIGHWAY_HWY_CONTRIB_SORT_RADIX_INL_H_
+
+#include <stddef.h>
+#include <string.h>  // memcpy, memset
+
+#include "hwy/aligned_allocator.h"
+#include "hwy/base.h"
+#include "hwy/contrib/sort/shared-inl.h"  // RadixConstants
+
+#endif  // HIGHWAY_HWY_CONTRIB_SORT_RADIX_INL_H_
+
+// Per-target
+#if defined(HIGHWAY_HWY_CONTRIB_SORT_RADIX_TOGGLE) == \
+    defined(HWY_TARGET_TOGGLE)
+#ifdef HIGHWAY_HWY_CONTRIB_SORT_RADIX_TOGGLE
+#undef HIGHWAY_HWY_CONTRIB_SORT_RADIX_TOGGLE
+#else
+#define HIGHWAY_HWY_CONTRIB_SORT_RADIX_TOGGLE
+#endif
+
+#include "hwy/contrib/sort/traits-inl.h"
+#include "hwy/contrib/sort/vqsort-inl.h"
+#include "hwy/highway.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+namespace detail {
+
+// Also true for float16_t and bfloat16_t, which IsFloat excludes.
+template <typename T>
+constexpr bool IsFloatKey() {
+  return IsFloat<T>() || IsSame<T, float16_t>() || IsSame<T, bfloat16_t>();
+}
+
+// Returns unsigned integers whose ascending order is the sort order of the
+// keys `bits` (reinterpreted as T). This is a bijection, see FromRadixKeys.
+template <typename T, class Order, class DU>
+HWY_INLINE Vec<DU> ToRadixKeys(DU du, Vec<DU> bits) {
+  using TU = TFromD<DU>;
+  const Vec<DU> sign = Set(du, static_cast<TU>(TU{1} << (sizeof(TU) * 8 - 1)));
+  if (IsFloatKey<T>()) {
+    // Negative: flip all bits so larger magnitudes come first. Otherwise,
+    // only set the sign bit so they come after all negative numbers.
+    const RebindToSigned<DU> di;
+    const Vec<DU> negative = BitCast(du, BroadcastSignBit(BitCast(di, bits)));
+    bits = Xor(bits, Or(negative, sign));
+  } else if (IsSigned<T>()) {
+    bits = Xor(bits, sign);
+  }
+  return Order().IsAscending() ? bits : Not(bits);
+}
+
+template <typename T, class Order, class DU>
+HWY_INLINE Vec<DU> FromRadixKeys(DU du, Vec<DU> bits) {
+  using TU = TFromD<DU>;
+  const Vec<DU> sign = Set(du, static_cast<TU>(TU{1} << (sizeof(TU) * 8 - 1)));
+  if (!Order().IsAscending()) bits = Not(bits);
+  if (IsFloatKey<T>()) {
+    // The sign bit is clear if and only if the float was negative.
+    const RebindToSigned<DU> di;
+    const Vec<DU> negative =
+        BitCast(du, BroadcastSignBit(BitCast(di, Not(bits))));
+    bits = Xor(bits, Or(negative, sign));
+  } else if (IsSigned<T>()) {
+    bits = Xor(bits, sign);
+  }
+  return bits;
+}
+
+// Applies ToRadixKeys (if kTo) or FromRadixKeys to all lanes in place.
+template <bool kTo, typename T, class Order, class DU>
+HWY_INLINE void TransformRadixKeys(DU du, TFromD<DU>* HWY_RESTRICT keys,
+                                   size_t num) {
+  const size_t N = Lanes(du);
+  size_t i = 0;
+  if (num >= N) {
+    for (; i <= num - N; i += N) {
+      const Vec<DU> v = LoadU(du, keys + i);
+      const Vec<DU> out =
+          kTo ? ToRadixKeys<T, Order>(du, v) : FromRadixKeys<T, Order>(du, v);
+      StoreU(out, du, keys + i);
+    }
+  }
+  // Remainder: single lanes, because overlapping would transform twice.
+  const CappedTag<TFromD<DU>, 1> d1;
+  for (; i < num; ++i) {
+    const Vec<decltype(d1)> v = LoadU(d1, keys + i);
+    const Vec<decltype(d1)> out =
+        kTo ? ToRadixKeys<T, Order>(d1, v) : FromRadixKeys<T, Order>(d1, v);
+    StoreU(out, d1, keys + i);
+  }
+}
+
+template <typename TU>
+HWY_INLINE size_t RadixDigit(TU key, size_t pass) {
+  using RC = RadixConstants;
+  return static_cast<size_t>(key >> (pass * RC::kDigitBits)) &
+         (RC::kBuckets - 1);
+}
+
+// Sorts unsigned integers by repeatedly scattering them between `keys` and
+// `buf` according to successive digits, starting with the least-significant.
+template <typename TU>
+HWY_NOINLINE void RadixSortUnsigned(TU* HWY_RESTRICT keys,
+                                    TU* HWY_RESTRICT buf, size_t num) {
+  using RC = RadixConstants;
+  constexpr size_t kPasses = sizeof(TU) * 8 / RC::kDigitBits;
+
+  // Histograms of all digits in a single pass over the input.
+  size_t counts[kPasses][RC::kBuckets] = {};
+  for (size_t i = 0; i < num; ++i) {
+    const TU key = keys[i];
+    for (size_t pass = 0; pass < kPasses; ++pass) {
+      ++counts[pass][RadixDigit(key, pass)];
+    }
+  }
+
+  TU* HWY_RESTRICT from = keys;
+  TU* HWY_RESTRICT to = buf;
+  for (size_t pass = 0; pass < kPasses; ++pass) {
+    size_t* HWY_RESTRICT offsets = counts[pass];
+    // All keys have the same digit: this pass would not change anything.
+    if (offsets[RadixDigit(from[0], pass)] == num) continue;
+
+    size_t sum = 0;
+    for (size_t bucket = 0; bucket < RC::kBuckets; ++bucket) {
+      const size_t count = offsets[bucket];
+      offsets[bucket] = sum;
+      sum += count;
+    }
+
+    for (size_t i = 0; i < num; ++i) {
+      const TU key = from[i];
+      to[offsets[RadixDigit(key, pass)]++] = key;
+    }
+
+    TU* HWY_RESTRICT temp = from;
+    from = to;
+    to = temp;
+  }
+
+  if (from != keys) memcpy(keys, from, num * sizeof(TU));
+}
+
+// Counting sort for 16-bit keys: each digit value is also a key, so there is
+// no need to scatter. Instead, writes runs of each key in order, which is
+// cheaper than the two passes of LSD and does not require a second array.
+// `counts` has RadixConstants::kNumCounts16 entries, which need not be zero.
+// Requires num <= LimitsMax<uint32_t>().
+template <typename T, class Order, class DU>
+HWY_NOINLINE void CountingSort16(DU du, uint16_t* HWY_RESTRICT keys,
+                                 size_t num, uint32_t* HWY_RESTRICT counts) {
+  memset(counts, 0, RadixConstants::kNumCounts16 * sizeof(uint32_t));
+  const size_t N = Lanes(du);
+  HWY_ALIGN uint16_t lanes[HWY_MAX_BYTES / sizeof(uint16_t)];
+  size_t i = 0;
+  if (num >= N) {
+    for (; i <= num - N; i += N) {
+      Store(ToRadixKeys<T, Order>(du, LoadU(du, keys + i)), du, lanes);
+      for (size_t j = 0; j < N; ++j) {
+        ++counts[lanes[j]];
+      }
+    }
+  }
+  const CappedTag<uint16_t, 1> d1;
+  for (; i < num; ++i) {
+    ++counts[GetLane(ToRadixKeys<T, Order>(d1, LoadU(d1, keys + i)))];
+  }
+
+  size_t pos = 0;
+  for (size_t bucket = 0; bucket < RadixConstants::kNumCounts16; ++bucket) {
+    const size_t count = counts[bucket];
+    if (count == 0) continue;
+    const Vec<DU> key = FromRadixKeys<T, Order>(
+        du, Set(du, static_cast<uint16_t>(bucket)));
+    size_t j = 0;
+    if (count >= N) {
+      for (; j <= count - N; j += N) {
+        StoreU(key, du, keys + pos + j);
+      }
+    }
+    const uint16_t key1 = GetLane(key);
+    for (; j < count; ++j) {
+      keys[pos + j] = key1;
+    }
+    pos += count;
+  }
+}
+
+// Sorts the bits of 32-bit keys (or 16-bit keys if the counts could
+// overflow) by transforming them to and from unsigned radix keys.
+template <typename T, class Order, size_t kSize, class DU>
+HWY_INLINE bool RadixSortBits(hwy::SizeTag<kSize> /* tag */, DU du,
+                              TFromD<DU>* HWY_RESTRICT bits, size_t num) {
+  using TU = TFromD<DU>;
+  auto buf = hwy::AllocateAligned<TU>(num);
+  if (!buf) return false;
+
+  TransformRadixKeys</*kTo=*/true, T, Order>(du, bits, num);
+  RadixSortUnsigned(bits, buf.get(), num);
+  TransformRadixKeys</*kTo=*/false, T, Order>(du, bits, num);
+  return true;
+}
+
+template <typename T, class Order, class DU>
+HWY_INLINE bool RadixSortBits(hwy::SizeTag<2> /* tag */, DU du,
+                              uint16_t* HWY_RESTRICT bits, size_t num) {
+  if (num > LimitsMax<uint32_t>()) {
+    return RadixSortBits<T, Order>(hwy::SizeTag<0>(), du, bits, num);
+  }
+  auto counts = hwy::AllocateAligned<uint32_t>(RadixConstants::kNumCounts16);
+  if (!counts) return false;
+  CountingSort16<T, Order>(du, bits, num, counts.get());
+  return true;
+}
+
+// Whether Sorter should use RadixSort (or CountingSort for 16-bit keys) rather
+// than Sort for `num` keys.
+template <class Traits>
+HWY_INLINE bool UseRadixSort(Traits st, size_t num) {
+  using T = typename Traits::LaneType;
+  if (st.Is128() || st.IsKV()) return false;
+  if (sizeof(T) == 2) {
+    return num >= RadixConstants::kMinKeys16 && num <= LimitsMax<uint32_t>();
+  }
+#if VQSORT_ENABLED
+  // Vectorized quicksort is several times faster than the scalar scatter.
+  return false;
+#else
+  // Much faster than the HeapSort fallback.
+  return sizeof(T) == 4 && num >= RadixConstants::kMinKeys32;
+#endif
+}
+
+}  // namespace detail
+
+// Sorts 16-bit keys with a counting sort and 32-bit keys with an LSD radix sort
+// of 8-bit digits. Keys are first mapped to unsigned integers in the desired
+// order with a vectorized pass, so that signed, float and descending keys need
+// no special handling. Requires a temporary array of 64K counts or `num` keys;
+// returns false without changing `keys` if its allocation fails. CountingSort
+// instead uses caller-owned counts. As with Sort, sorted or reversed input is
+// detected and handled in a single pass. Also available on HWY_SCALAR, where
+// Sort falls back to HeapSort.
+template <class D, class Traits, typename T>
+bool RadixSort(D d, Traits st, T* HWY_RESTRICT keys, size_t num) {
+  static_assert(sizeof(T) == 2 || sizeof(T) == 4, "Requires 16/32-bit keys");
+  using Order = typename Traits::Order;
+  using TU = MakeUnsigned<T>;
+
+  if (num < 2) return true;
+#if VQSORT_ENABLED || HWY_IDE
+  if (detail::HandleSpecialCases(d, st, keys, num)) return true;
+#else
+  (void)d;
+  (void)st;
+#endif
+
+  const RebindToUnsigned<D> du;
+  return detail::RadixSortBits<T, Order>(
+      hwy::SizeTag<sizeof(T)>(), du, reinterpret_cast<TU*>(keys), num);
+}
+
+// Same as RadixSort for 16-bit keys, but does not allocate: uses the
+// caller-owned `counts`, which must have RadixConstants::kNumCounts16 entries
+// and need not be initialized. Requires num <= LimitsMax<uint32_t>().
+template <class D, class Traits, typename T>
+void CountingSort(D d, Traits st, T* HWY_RESTRICT keys, size_t num,
+                  uint32_t* HWY_RESTRICT counts) {
+  static_assert(sizeof(T) == 2, "Requires 16-bit keys");
+  using Order = typename Traits::Order;
+  HWY_DASSERT(num <= LimitsMax<uint32_t>());
+
+  if (num < 2) return;
+#if VQSORT_ENABLED || HWY_IDE
+  if (detail::HandleSpecialCases(d, st, keys, num)) return;
+#else
+  (void)d;
+  (void)st;
+#endif
+
+  const RebindToUnsigned<D> du;
+  detail::CountingSort16<T, Order>(du, reinterpret_cast<uint16_t*>(keys), num,
+                                   counts);
+}
+
+// Sorts float16_t or bfloat16_t keys, for which there are no comparisons, by
+// sorting their radix keys as uint16_t. `buf` is as for Sort, and must also
+// have room for RadixConstants::kNumCounts16 uint32_t, as does the scratch
+// memory of Sorter.
+template <class Order, typename T>
+void SortFloat16(T* HWY_RESTRICT keys, size_t num,
+                 uint16_t* HWY_RESTRICT buf) {
+  static_assert(IsSame<T, float16_t>() || IsSame<T, bfloat16_t>(),
+                "Requires float16_t or bfloat16_t");
+  const SortTag<uint16_t> du;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint16_t>>> st;
+  uint16_t* HWY_RESTRICT bits = reinterpret_cast<uint16_t*>(keys);
+  if (detail::UseRadixSort(st, num)) {
+    detail::CountingSort16<T, Order>(du, bits, num,
+                                     reinterpret_cast<uint32_t*>(buf));
+    return;
+  }
+  detail::TransformRadixKeys</*kTo=*/true, T, Order>(du, bits, num);
+  Sort(du, st, bits, num, buf);
+  detail::TransformRadixKeys</*kTo=*/false, T, Order>(du, bits, num);
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#endif  // HIGHWAY_HWY_CONTRIB_SORT_RADIX_TOGGLE
@@ -19,6 +19,9 @@
 #ifndef HIGHWAY_HWY_CONTRIB_SORT_RESULT_INL_H_
 #define HIGHWAY_HWY_CONTRIB_SORT_RESULT_INL_H_
 
+#include <stdio.h>
+#include <stdlib.h>  // getenv
+#include <string.h>  // strcmp
 #include <time.h>
 
 #include <algorithm>  // std::sort
@@ -53,6 +56,30 @@ static inline double SummarizeMeasurements(std::vector<double>& seconds) {
   return sum / count;
 }
 
+// Output format of Result::Print, selected by the HWY_SORT_BENCH_FORMAT
+// environment variable: "csv" or "json" (one object per line) are intended for
+// dashboards that track throughput across releases; the default is text.
+enum class ResultFormat { kText, kCSV, kJSON };
+
+static inline ResultFormat GetResultFormat() {
+  static const ResultFormat format = []() {
+    const char* env = getenv("HWY_SORT_BENCH_FORMAT");
+    if (env != nullptr && strcmp(env, "csv") == 0) return ResultFormat::kCSV;
+    if (env != nullptr && strcmp(env, "json") == 0) return ResultFormat::kJSON;
+    return ResultFormat::kText;
+  }();
+  return format;
+}
+
+// Prints the CSV header before the first row.
+static inline void MaybePrintCSVHeader() {
+  static bool printed = false;
+  if (printed) return;
+  printed = true;
+  printf("target,algo,key,dist,num_keys,num_sorts,num_threads,sec,"
+         "keys_per_sec,gb_per_sec\n");
+}
+
 }  // namespace hwy
 #endif  // HIGHWAY_HWY_CONTRIB_SORT_RESULT_INL_H_
 
@@ -69,33 +96,65 @@ HWY_BEFORE_NAMESPACE();
 namespace hwy {
 namespace HWY_NAMESPACE {
 
+// `num_sorts` independent sorts of `num_keys` each ran concurrently, each
+// using `threads_per_sort` threads (more than one for parallel algorithms).
 struct Result {
   Result() {}
-  Result(const Algo algo, Dist dist, size_t num_keys, size_t num_threads,
-         double sec, size_t sizeof_key, const std::string& key_name)
+  Result(const Algo algo, Dist dist, size_t num_keys, size_t num_sorts,
+         double sec, size_t sizeof_key, const std::string& key_name,
+         size_t threads_per_sort = 1)
       : target(HWY_TARGET),
         algo(algo),
         dist(dist),
         num_keys(num_keys),
-        num_threads(num_threads),
+        num_sorts(num_sorts),
+        num_threads(num_sorts * threads_per_sort),
         sec(sec),
         sizeof_key(sizeof_key),
         key_name(key_name) {}
 
+  // Summed over all sorts, but not scaled by the threads within one sort.
+  double KeysPerSec() const {
+    return static_cast<double>(num_keys) * static_cast<double>(num_sorts) /
+           sec;
+  }
+  double BytesPerSec() const {
+    return KeysPerSec() * static_cast<double>(sizeof_key);
+  }
+
   void Print() const {
-    const double bytes = static_cast<double>(num_keys) *
-                         static_cast<double>(num_threads) *
-                         static_cast<double>(sizeof_key);
-    printf("%10s: %12s: %7s: %9s: %.2E %4.0f MB/s (%2zu threads)\n",
-           hwy::TargetName(target), AlgoName(algo), key_name.c_str(),
-           DistName(dist), static_cast<double>(num_keys), bytes * 1E-6 / sec,
-           num_threads);
+    switch (GetResultFormat()) {
+      case ResultFormat::kText:
+        printf("%10s: %12s: %7s: %9s: %.2E %4.0f MB/s (%2zu threads)\n",
+               hwy::TargetName(target), AlgoName(algo), key_name.c_str(),
+               DistName(dist), static_cast<double>(num_keys),
+               BytesPerSec() * 1E-6, num_threads);
+        break;
+      case ResultFormat::kCSV:
+        MaybePrintCSVHeader();
+        printf("%s,%s,%s,%s,%zu,%zu,%zu,%.9g,%.6g,%.6g\n",
+               hwy::TargetName(target), AlgoName(algo), key_name.c_str(),
+               DistName(dist), num_keys, num_sorts, num_threads, sec,
+               KeysPerSec(), BytesPerSec() * 1E-9);
+        break;
+      case ResultFormat::kJSON:
+        printf(
+            "{\"target\": \"%s\", \"algo\": \"%s\", \"key\": \"%s\", "
+            "\"dist\": \"%s\", \"num_keys\": %zu, \"num_sorts\": %zu, "
+            "\"num_threads\": %zu, \"sec\": %.9g, \"keys_per_sec\": %.6g, "
+            "\"gb_per_sec\": %.6g}\n",
+            hwy::TargetName(target), AlgoName(algo), key_name.c_str(),
+            DistName(dist), num_keys, num_sorts, num_threads, sec,
+            KeysPerSec(), BytesPerSec() * 1E-9);
+        break;
+    }
   }
 
   int64_t target;
   Algo algo;
   Dist dist;
   size_t num_keys = 0;
+  size_t num_sorts = 0;
   size_t num_threads = 0;
   double sec = 0.0;
   size_t sizeof_key = 0;
@@ -131,6 +190,32 @@ bool VerifySort(Traits st, const InputStats<LaneType>& input_stats,
   return input_stats == output_stats;
 }
 
+// Verifies the result of Select: no key before lane `k` is ordered after the
+// key at `k`, no key after it is ordered before it, and no keys were lost or
+// duplicated. Together, these imply the key at `k` is the correct one.
+template <class Traits, typename LaneType>
+bool VerifySelect(Traits st, const InputStats<LaneType>& input_stats,
+                  const LaneType* out, size_t num_lanes, size_t k,
+                  const char* caller) {
+  constexpr size_t N1 = st.LanesPerKey();
+  HWY_ASSERT(k < num_lanes && k % N1 == 0);
+
+  InputStats<LaneType> output_stats;
+  for (size_t i = 0; i < num_lanes; i += N1) {
+    output_stats.Notify(out[i]);
+    if (N1 == 2) output_stats.Notify(out[i + 1]);
+    const bool misplaced = (i < k) ? st.Compare1(out + k, out + i)
+                                   : st.Compare1(out + i, out + k);
+    if (misplaced) {
+      HWY_ABORT("%s: lane %d of %d is on the wrong side of k=%d\n", caller,
+                static_cast<int>(i), static_cast<int>(num_lanes),
+                static_cast<int>(k));
+    }
+  }
+
+  return input_stats == output_stats;
+}
+
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
 }  // namespace hwy
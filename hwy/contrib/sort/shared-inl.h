@@ -88,6 +88,26 @@ struct SortConstants {
   }
 };
 
+// LSD radix sort touches each key twice per 8-bit digit regardless of the
+// input, but requires a second array and scatters to 256 destinations. Its
+// scalar scatter is slower than vectorized quicksort, hence Sorter only uses it
+// if vqsort is disabled. A vectorized scatter via Compress would only split
+// each vector into two groups, i.e. one bit per pass, which is several times
+// slower than 8-bit digits. 16-bit keys instead use a counting sort, which is
+// faster than quicksort for large inputs; see BenchAllRadix.
+struct RadixConstants {
+  static constexpr size_t kDigitBits = 8;
+  static constexpr size_t kBuckets = size_t{1} << kDigitBits;
+
+  // Minimum number of keys for which Sorter uses radix/counting sort.
+  static constexpr size_t kMinKeys16 = size_t{1} << 18;
+  static constexpr size_t kMinKeys32 = 256;
+
+  // Entries in the table of counts of the 16-bit counting sort. Sorter takes
+  // the table from its scratch memory, see Sorter::ScratchBytes.
+  static constexpr size_t kNumCounts16 = size_t{1} << 16;
+};
+
 }  // namespace hwy
 
 #endif  // HIGHWAY_HWY_CONTRIB_SORT_SHARED_INL_H_
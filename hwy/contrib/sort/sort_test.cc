@@ -21,7 +21,10 @@
 #include <stdio.h>
 #include <string.h>  // memcpy
 
+#include <algorithm>
+#include <atomic>
 #include <unordered_map>
+#include <utility>  // std::move
 #include <vector>
 
 // clang-format off
@@ -38,23 +41,41 @@
 #include "hwy/tests/test_util-inl.h"
 // clang-format on
 
+// To verify that Sorter does not allocate, this test replaces malloc where
+// glibc allows that and no sanitizer already does so.
+#ifndef HWY_SORT_TEST_COUNT_MALLOC
+#if HWY_OS_LINUX && defined(__GLIBC__) && !HWY_IS_ASAN && !HWY_IS_MSAN && \
+    !HWY_IS_TSAN && !defined(__SANITIZE_ADDRESS__) &&                     \
+    !defined(__SANITIZE_THREAD__)
+#define HWY_SORT_TEST_COUNT_MALLOC 1
+#else
+#define HWY_SORT_TEST_COUNT_MALLOC 0
+#endif
+#endif  // HWY_SORT_TEST_COUNT_MALLOC
+
+namespace hwy {
+// Returns the number of malloc calls so far; defined below.
+size_t MallocCalls();
+}  // namespace hwy
+
 HWY_BEFORE_NAMESPACE();
 namespace hwy {
 namespace HWY_NAMESPACE {
 namespace {
 
 using detail::OrderAscending;
-using detail::OrderDescending;
-using detail::SharedTraits;
-using detail::TraitsLane;
-#if VQSORT_ENABLED || HWY_IDE
 using detail::OrderAscending128;
 using detail::OrderAscendingKV128;
 using detail::OrderAscendingKV64;
+using detail::OrderDescending;
 using detail::OrderDescending128;
 using detail::OrderDescendingKV128;
 using detail::OrderDescendingKV64;
+using detail::SharedTraits;
 using detail::Traits128;
+using detail::TraitsLane;
+
+#if VQSORT_ENABLED || HWY_IDE
 
 template <class Traits>
 static HWY_NOINLINE void TestMedian3() {
@@ -220,6 +241,79 @@ static HWY_NOINLINE void TestBaseCase() {
   TestBaseCase01<Traits>();
 }
 
+// Key-value pairs whose key equals that of the padding, but whose value
+// differs, must not be overwritten by padding.
+template <class Traits>
+static HWY_NOINLINE void TestBaseCaseKVPadding() {
+  using LaneType = typename Traits::LaneType;
+  SharedTraits<Traits> st;
+  const SortTag<LaneType> d;
+  const size_t N = Lanes(d);
+  const size_t base_case_num = SortConstants::BaseCaseNum(N);
+  const size_t N1 = st.LanesPerKey();
+  const LaneType padding = GetLane(st.LastValue(d));
+
+  auto lanes = hwy::AllocateAligned<LaneType>(base_case_num + N);
+  auto buf = hwy::AllocateAligned<LaneType>(base_case_num + 2 * N);
+  std::vector<LaneType> expected, actual;
+  for (size_t len = 2 * N1; len <= base_case_num; len += N1) {
+    for (size_t i = 0; i < len; i += N1) {
+      // The value is the lower half of KV64, and the lower lane of KV128.
+      const LaneType value = padding + static_cast<LaneType>(i + 1);
+      lanes[i] = (N1 == 1) ? ((padding & ~uint64_t{0xFFFFFFFFu}) |
+                              (value & uint64_t{0xFFFFFFFFu}))
+                           : value;
+      if (N1 == 2) lanes[i + 1] = padding;
+    }
+    expected.assign(lanes.get(), lanes.get() + len);
+
+    detail::BaseCase(d, st, lanes.get(), lanes.get() + len, len, buf.get());
+
+    actual.assign(lanes.get(), lanes.get() + len);
+    std::sort(expected.begin(), expected.end());
+    std::sort(actual.begin(), actual.end());
+    HWY_ASSERT(expected == actual);
+  }
+}
+
+// Sorting networks compare-exchange key-value pairs with equal keys; each pair
+// must survive, regardless of its position. Unlike TestBaseCaseKVPadding, the
+// key differs from the padding.
+template <class Traits>
+static HWY_NOINLINE void TestBaseCaseKVEqualKeys() {
+  using LaneType = typename Traits::LaneType;
+  SharedTraits<Traits> st;
+  const SortTag<LaneType> d;
+  const size_t N = Lanes(d);
+  const size_t base_case_num = SortConstants::BaseCaseNum(N);
+  const size_t N1 = st.LanesPerKey();
+  const LaneType key = 5;
+
+  auto lanes = hwy::AllocateAligned<LaneType>(base_case_num + N);
+  auto buf = hwy::AllocateAligned<LaneType>(base_case_num + 2 * N);
+  std::vector<LaneType> expected, actual;
+  for (size_t len = 2 * N1; len <= base_case_num; len += N1) {
+    for (size_t i = 0; i < len; i += N1) {
+      // The value is the lower half of KV64, and the lower lane of KV128.
+      const LaneType value = static_cast<LaneType>(len - i);
+      if (N1 == 1) {
+        lanes[i] = (key << 32) | value;
+      } else {
+        lanes[i] = value;
+        lanes[i + 1] = key;
+      }
+    }
+    expected.assign(lanes.get(), lanes.get() + len);
+
+    detail::BaseCase(d, st, lanes.get(), lanes.get() + len, len, buf.get());
+
+    actual.assign(lanes.get(), lanes.get() + len);
+    std::sort(expected.begin(), expected.end());
+    std::sort(actual.begin(), actual.end());
+    HWY_ASSERT(expected == actual);
+  }
+}
+
 HWY_NOINLINE void TestAllBaseCase() {
   // Workaround for stack overflow on MSVC debug.
 #if defined(_MSC_VER)
@@ -229,6 +323,16 @@ HWY_NOINLINE void TestAllBaseCase() {
   TestBaseCase<TraitsLane<OrderDescending<int64_t> > >();
   TestBaseCase<Traits128<OrderAscending128> >();
   TestBaseCase<Traits128<OrderDescending128> >();
+
+  TestBaseCaseKVPadding<TraitsLane<OrderAscendingKV64> >();
+  TestBaseCaseKVPadding<TraitsLane<OrderDescendingKV64> >();
+  TestBaseCaseKVPadding<Traits128<OrderAscendingKV128> >();
+  TestBaseCaseKVPadding<Traits128<OrderDescendingKV128> >();
+
+  TestBaseCaseKVEqualKeys<TraitsLane<OrderAscendingKV64> >();
+  TestBaseCaseKVEqualKeys<TraitsLane<OrderDescendingKV64> >();
+  TestBaseCaseKVEqualKeys<Traits128<OrderAscendingKV128> >();
+  TestBaseCaseKVEqualKeys<Traits128<OrderDescendingKV128> >();
 }
 
 template <class Traits>
@@ -590,8 +694,6 @@ void TestAllSort() {
     }
 #endif
 
-// Our HeapSort does not support 128-bit keys.
-#if VQSORT_ENABLED
     TestSort<Traits128<OrderAscending128> >(num_lanes);
     TestSort<Traits128<OrderDescending128> >(num_lanes);
 
@@ -600,8 +702,841 @@ void TestAllSort() {
 
     TestSort<Traits128<OrderAscendingKV128> >(num_lanes);
     TestSort<Traits128<OrderDescendingKV128> >(num_lanes);
+  }
+}
+
+// Exercises the special case for sorted and reversed input, the fallback if
+// only the last few keys are out of order, and other structured or skewed
+// inputs used by bench_sort.
+template <class Traits>
+void TestPresorted(size_t num_lanes) {
+  using Order = typename Traits::Order;
+  using LaneType = typename Traits::LaneType;
+  using KeyType = typename Traits::KeyType;
+  SharedTraits<Traits> st;
+  Sorter sorter;
+
+  // Round up to a whole number of keys.
+  num_lanes += (st.Is128() && (num_lanes & 1));
+  const size_t num_keys = num_lanes / st.LanesPerKey();
+
+  auto lanes = hwy::AllocateAligned<LaneType>(num_lanes);
+  for (Dist dist : {Dist::kSorted, Dist::kReverse, Dist::kSortedTail,
+                    Dist::kSortedRuns, Dist::kOrganPipe, Dist::kZipf,
+                    Dist::kFewUnique, Dist::kAllEqualButOne}) {
+    InputStats<LaneType> input_stats =
+        GenerateInput(dist, lanes.get(), num_lanes);
+
+    CompareResults<Traits> compare(lanes.get(), num_lanes);
+    sorter(reinterpret_cast<KeyType*>(lanes.get()), num_keys, Order());
+    HWY_ASSERT(st.IsKV() || compare.Verify(lanes.get()));
+    HWY_ASSERT(
+        VerifySort(st, input_stats, lanes.get(), num_lanes, "TestPresorted"));
+
+    // Sorting again takes the special case for either order.
+    sorter(reinterpret_cast<KeyType*>(lanes.get()), num_keys, Order());
+    HWY_ASSERT(
+        VerifySort(st, input_stats, lanes.get(), num_lanes, "TestPresorted"));
+  }
+}
+
+void TestAllPresorted() {
+  for (int num : {129, 1001, 34567}) {
+    const size_t num_lanes = AdjustedReps(static_cast<size_t>(num));
+    TestPresorted<TraitsLane<OrderAscending<uint16_t> > >(num_lanes);
+    TestPresorted<TraitsLane<OrderDescending<int32_t> > >(num_lanes);
+    TestPresorted<TraitsLane<OrderAscending<uint64_t> > >(num_lanes);
+    TestPresorted<TraitsLane<OrderDescending<float> > >(num_lanes);
+
+#if VQSORT_ENABLED
+    TestPresorted<Traits128<OrderAscending128> >(num_lanes);
+    TestPresorted<Traits128<OrderDescending128> >(num_lanes);
+    TestPresorted<TraitsLane<OrderAscendingKV64> >(num_lanes);
+    TestPresorted<Traits128<OrderDescendingKV128> >(num_lanes);
+#endif
+  }
+}
+
+// Sorts with a Sorter using caller-owned scratch memory and the thread-local
+// Sorter, which must give the same results as a default-constructed Sorter.
+template <class Traits>
+void TestScratch(size_t num_lanes) {
+  using Order = typename Traits::Order;
+  using LaneType = typename Traits::LaneType;
+  using KeyType = typename Traits::KeyType;
+  SharedTraits<Traits> st;
+
+  // Round up to a whole number of keys.
+  num_lanes += (st.Is128() && (num_lanes & 1));
+  const size_t num_keys = num_lanes / st.LanesPerKey();
+
+  const size_t scratch_bytes = Sorter::ScratchBytes();
+  auto scratch = hwy::AllocateAligned<uint8_t>(scratch_bytes);
+  Sorter caller_scratch(scratch.get(), scratch_bytes);
+  // Moving must not free the caller's memory.
+  const Sorter moved(std::move(caller_scratch));
+
+  // Only 32-bit keys on targets without vqsort use a radix sort that
+  // allocates.
+  const bool must_not_allocate =
+      HWY_SORT_TEST_COUNT_MALLOC && (VQSORT_ENABLED || sizeof(LaneType) != 4);
+
+  auto lanes = hwy::AllocateAligned<LaneType>(num_lanes);
+  for (const Sorter* sorter : {&moved, &Sorter::ThreadLocal()}) {
+    InputStats<LaneType> input_stats =
+        GenerateInput(Dist::kUniform32, lanes.get(), num_lanes);
+
+    CompareResults<Traits> compare(lanes.get(), num_lanes);
+    const size_t malloc_calls = MallocCalls();
+    (*sorter)(reinterpret_cast<KeyType*>(lanes.get()), num_keys, Order());
+    if (must_not_allocate) HWY_ASSERT_EQ(malloc_calls, MallocCalls());
+    HWY_ASSERT(st.IsKV() || compare.Verify(lanes.get()));
+    HWY_ASSERT(
+        VerifySort(st, input_stats, lanes.get(), num_lanes, "TestScratch"));
+  }
+  // The thread-local Sorter is reused.
+  HWY_ASSERT(&Sorter::ThreadLocal() == &Sorter::ThreadLocal());
+}
+
+void TestAllScratch() {
+  for (int num : {129, 34567}) {
+    const size_t num_lanes = AdjustedReps(static_cast<size_t>(num));
+    TestScratch<TraitsLane<OrderAscending<uint16_t> > >(num_lanes);
+    TestScratch<TraitsLane<OrderDescending<int32_t> > >(num_lanes);
+    TestScratch<TraitsLane<OrderAscending<uint64_t> > >(num_lanes);
+
+#if VQSORT_ENABLED
+    TestScratch<Traits128<OrderDescending128> >(num_lanes);
+    TestScratch<TraitsLane<OrderAscendingKV64> >(num_lanes);
 #endif
   }
+
+  // The counting sort of 16-bit keys also uses the scratch memory.
+  TestScratch<TraitsLane<OrderAscending<uint16_t> > >(
+      RadixConstants::kMinKeys16);
+  TestScratch<TraitsLane<OrderDescending<int16_t> > >(
+      RadixConstants::kMinKeys16);
+}
+
+#if VQSORT_ENABLED
+
+// Checks the SortStats filled by Sort for random, presorted and two-valued
+// input.
+template <class Traits>
+static HWY_NOINLINE void TestSortStats(size_t num_lanes) {
+  using LaneType = typename Traits::LaneType;
+  const SortTag<LaneType> d;
+  SharedTraits<Traits> st;
+
+  // Round up to a whole number of keys.
+  num_lanes += (st.Is128() && (num_lanes & 1));
+  auto lanes = hwy::AllocateAligned<LaneType>(num_lanes);
+  auto buf = hwy::AllocateAligned<LaneType>(
+      SortConstants::BufNum<LaneType>(Lanes(d)));
+
+  InputStats<LaneType> input_stats =
+      GenerateInput(Dist::kUniform32, lanes.get(), num_lanes);
+  SortStats stats;
+  Sort(d, st, lanes.get(), num_lanes, buf.get(), &stats);
+  HWY_ASSERT(VerifySort(st, input_stats, lanes.get(), num_lanes, "Stats"));
+  HWY_ASSERT(stats.partitions != 0 && stats.base_cases > stats.partitions);
+  HWY_ASSERT(stats.max_depth != 0);
+  HWY_ASSERT(stats.max_depth <= 2 * hwy::CeilLog2(num_lanes) + 4);
+  // Each key reaches a base case and is partitioned at least once.
+  HWY_ASSERT(stats.bytes_moved >= 2 * num_lanes * sizeof(LaneType));
+  HWY_ASSERT(stats.heap_sorts == 0 && stats.presorted == 0);
+
+  // Sorting again only takes the special case and leaves the rest unchanged.
+  const SortStats prev = stats;
+  Sort(d, st, lanes.get(), num_lanes, buf.get(), &stats);
+  HWY_ASSERT(stats.presorted == 1);
+  HWY_ASSERT(stats.partitions == prev.partitions &&
+             stats.bytes_moved == prev.bytes_moved);
+
+  // Two distinct keys are partitioned once, without recursion.
+  RandomState rng;
+  for (size_t i = 0; i < num_lanes; i += st.LanesPerKey()) {
+    lanes[i] = static_cast<LaneType>(Random64(&rng) & 1);
+    if (st.Is128()) lanes[i + 1] = 0;
+  }
+  stats = SortStats();
+  Sort(d, st, lanes.get(), num_lanes, buf.get(), &stats);
+  HWY_ASSERT(stats.two_value_partitions == 1 && stats.partitions == 0);
+}
+
+static void TestAllSortStats() {
+  for (int num : {3 * 1000, 34567}) {
+    const size_t num_lanes = AdjustedReps(static_cast<size_t>(num));
+    TestSortStats<TraitsLane<OrderAscending<uint32_t> > >(num_lanes);
+    TestSortStats<TraitsLane<OrderDescending<int64_t> > >(num_lanes);
+    TestSortStats<Traits128<OrderAscending128> >(num_lanes);
+  }
+}
+
+template <class Traits, size_t kKeys>
+static HWY_NOINLINE void TestSortBlock() {
+  using LaneType = typename Traits::LaneType;
+  SharedTraits<Traits> st;
+  if (kKeys > MaxSortBlockKeys(st)) return;
+  constexpr size_t kLanes = kKeys * st.LanesPerKey();
+  // Also check that keys after the block are unchanged.
+  auto lanes = hwy::AllocateAligned<LaneType>(kLanes + 1);
+  for (Dist dist : {Dist::kUniform8, Dist::kUniform32}) {
+    InputStats<LaneType> input_stats = GenerateInput(dist, lanes.get(), kLanes);
+    lanes[kLanes] = static_cast<LaneType>(123);
+    CompareResults<Traits> compare(lanes.get(), kLanes);
+    SortBlock<kKeys>(st, lanes.get());
+    HWY_ASSERT(compare.Verify(lanes.get()));
+    HWY_ASSERT(VerifySort(st, input_stats, lanes.get(), kLanes,
+                          "TestSortBlock"));
+    HWY_ASSERT_EQ(static_cast<LaneType>(123), lanes[kLanes]);
+  }
+}
+
+template <class Traits>
+static HWY_NOINLINE void TestSortBlocks() {
+  TestSortBlock<Traits, 16>();
+  TestSortBlock<Traits, 32>();
+  TestSortBlock<Traits, 64>();
+  TestSortBlock<Traits, 128>();
+  TestSortBlock<Traits, 256>();
+}
+
+HWY_NOINLINE void TestAllSortBlock() {
+  TestSortBlocks<TraitsLane<OrderAscending<uint16_t> > >();
+  TestSortBlocks<TraitsLane<OrderDescending<int32_t> > >();
+  TestSortBlocks<TraitsLane<OrderAscending<float> > >();
+  TestSortBlocks<TraitsLane<OrderDescending<uint64_t> > >();
+  TestSortBlocks<Traits128<OrderAscending128> >();
+  TestSortBlocks<Traits128<OrderDescending128> >();
+}
+
+#else
+static void TestAllSortStats() {}
+static void TestAllSortBlock() {}
+#endif  // VQSORT_ENABLED
+
+template <class Traits>
+void TestRadixSort(size_t num) {
+  using T = typename Traits::LaneType;
+  SharedTraits<Traits> st;
+  const SortTag<T> d;
+  auto keys = hwy::AllocateAligned<T>(num);
+
+  for (Dist dist : {Dist::kUniform8, Dist::kUniform16, Dist::kUniform32}) {
+    (void)GenerateInput(dist, keys.get(), num);
+    // GenerateInput only returns non-negative floats.
+    if (IsFloat<T>()) {
+      for (size_t i = 1; i < num; i += 2) {
+        keys[i] = static_cast<T>(-keys[i]);
+      }
+    }
+    InputStats<T> input_stats;
+    for (size_t i = 0; i < num; ++i) {
+      input_stats.Notify(keys[i]);
+    }
+
+    CompareResults<Traits> compare(keys.get(), num);
+    HWY_ASSERT(RadixSort(d, st, keys.get(), num));
+    HWY_ASSERT(compare.Verify(keys.get()));
+    HWY_ASSERT(VerifySort(st, input_stats, keys.get(), num, "TestRadixSort"));
+  }
+}
+
+void TestAllRadixSort() {
+  for (int num : {1, 2, 7, 129, 3000, 34567}) {
+    const size_t n = AdjustedReps(static_cast<size_t>(num));
+    TestRadixSort<TraitsLane<OrderAscending<uint16_t> > >(n);
+    TestRadixSort<TraitsLane<OrderDescending<int16_t> > >(n);
+    TestRadixSort<TraitsLane<OrderAscending<int32_t> > >(n);
+    TestRadixSort<TraitsLane<OrderDescending<uint32_t> > >(n);
+    TestRadixSort<TraitsLane<OrderAscending<float> > >(n);
+    TestRadixSort<TraitsLane<OrderDescending<float> > >(n);
+  }
+}
+
+// Scalar code has no conversion from float16_t, hence use PromoteTo.
+float KeyToFloat(float16_t key) {
+  const CappedTag<float, 1> df;
+  const Rebind<float16_t, decltype(df)> df16;
+  return GetLane(PromoteTo(df, LoadU(df16, &key)));
+}
+float KeyToFloat(bfloat16_t key) { return F32FromBF16(key); }
+
+// Exponent all ones and nonzero mantissa.
+bool IsNaN(uint16_t bits, float16_t /* tag */) {
+  return (bits & 0x7FFF) > 0x7C00;
+}
+bool IsNaN(uint16_t bits, bfloat16_t /* tag */) {
+  return (bits & 0x7FFF) > 0x7F80;
+}
+
+template <typename T, class Order>
+void TestFloat16(size_t num) {
+  RandomState rng(num);
+  std::vector<T> keys(num);
+  std::vector<uint16_t> input_bits(num);
+  for (size_t i = 0; i < num; ++i) {
+    // All bit patterns, including NaN, infinities and subnormals.
+    input_bits[i] = static_cast<uint16_t>(Random32(&rng) & 0xFFFF);
+    CopyBytes<2>(&input_bits[i], &keys[i]);
+  }
+
+  Sorter sorter;
+  sorter(keys.data(), num, Order());
+
+  // Same keys, and the non-NaN are in order.
+  std::vector<uint16_t> output_bits(num);
+  float prev = 0.0f;
+  bool has_prev = false;
+  for (size_t i = 0; i < num; ++i) {
+    CopyBytes<2>(&keys[i], &output_bits[i]);
+    if (IsNaN(output_bits[i], T())) continue;
+    const float f = KeyToFloat(keys[i]);
+    const bool wrong_order =
+        has_prev && (Order().IsAscending() ? f < prev : prev < f);
+    if (wrong_order) {
+      HWY_ABORT("Float16: wrong order at %d of %d: %f %f\n",
+                static_cast<int>(i), static_cast<int>(num), prev, f);
+    }
+    prev = f;
+    has_prev = true;
+  }
+  std::sort(input_bits.begin(), input_bits.end());
+  std::sort(output_bits.begin(), output_bits.end());
+  HWY_ASSERT(input_bits == output_bits);
+}
+
+void TestAllFloat16() {
+  // The largest size uses the counting sort (see UseRadixSort).
+  for (size_t num : {size_t{1}, size_t{7}, size_t{129}, size_t{3000},
+                     size_t{34567}, size_t{140000}}) {
+    TestFloat16<float16_t, SortAscending>(num);
+    TestFloat16<float16_t, SortDescending>(num);
+    TestFloat16<bfloat16_t, SortAscending>(num);
+    TestFloat16<bfloat16_t, SortDescending>(num);
+  }
+}
+
+template <class Traits>
+void TestParallelSort(size_t num_lanes) {
+  using Order = typename Traits::Order;
+  using LaneType = typename Traits::LaneType;
+  using KeyType = typename Traits::KeyType;
+  SharedTraits<Traits> st;
+  Sorter sorter;
+
+  // Round up to a whole number of keys.
+  num_lanes += (st.Is128() && (num_lanes & 1));
+  const size_t num_keys = num_lanes / st.LanesPerKey();
+
+  auto lanes = hwy::AllocateAligned<LaneType>(num_lanes);
+  for (size_t num_threads : {size_t{1}, size_t{2}, size_t{3}, size_t{8}}) {
+    ThreadPool pool(num_threads);
+    // Also few unique keys, which exercises the equal-samples fallback.
+    for (Dist dist : {Dist::kUniform8, Dist::kUniform32}) {
+      InputStats<LaneType> input_stats =
+          GenerateInput(dist, lanes.get(), num_lanes);
+
+      CompareResults<Traits> compare(lanes.get(), num_lanes);
+      sorter(reinterpret_cast<KeyType*>(lanes.get()), num_keys, Order(), pool);
+      // The order of values whose keys are equal is unspecified.
+      HWY_ASSERT(st.IsKV() || compare.Verify(lanes.get()));
+      HWY_ASSERT(VerifySort(st, input_stats, lanes.get(), num_lanes,
+                            "TestParallelSort"));
+    }
+  }
+}
+
+void TestAllParallelSort() {
+  // Enough for several threads, see kMinLanesPerThread.
+  for (int num : {70001, 250000}) {
+    const size_t num_lanes = AdjustedReps(static_cast<size_t>(num));
+    TestParallelSort<TraitsLane<OrderAscending<uint16_t> > >(num_lanes);
+    TestParallelSort<TraitsLane<OrderDescending<int32_t> > >(num_lanes);
+    TestParallelSort<TraitsLane<OrderAscending<uint64_t> > >(num_lanes);
+    TestParallelSort<TraitsLane<OrderAscending<float> > >(num_lanes);
+
+    TestParallelSort<Traits128<OrderAscending128> >(num_lanes);
+    TestParallelSort<Traits128<OrderDescendingKV128> >(num_lanes);
+    TestParallelSort<TraitsLane<OrderAscendingKV64> >(num_lanes);
+  }
+}
+
+// Checks that `out[0, k_lanes)` matches `expected`, the fully sorted input,
+// except for the order of values with equal keys; that no subsequent key is
+// ordered before them; and that no keys were lost or duplicated.
+template <class Traits, typename LaneType>
+void VerifyPartialSort(Traits st, const InputStats<LaneType>& input_stats,
+                       const LaneType* expected, const LaneType* out,
+                       size_t num_lanes, size_t k_lanes) {
+  constexpr size_t N1 = st.LanesPerKey();
+  InputStats<LaneType> output_stats;
+  for (size_t i = 0; i < num_lanes; i += N1) {
+    output_stats.Notify(out[i]);
+    if (N1 == 2) output_stats.Notify(out[i + 1]);
+    if (i < k_lanes) {
+      if (st.Compare1(out + i, expected + i) ||
+          st.Compare1(expected + i, out + i)) {
+        HWY_ABORT("PartialSort mismatch at lane %d of %d, k %d\n",
+                  static_cast<int>(i), static_cast<int>(num_lanes),
+                  static_cast<int>(k_lanes));
+      }
+    } else if (k_lanes != 0 && st.Compare1(out + i, out + k_lanes - N1)) {
+      HWY_ABORT("PartialSort: lane %d of %d is before k %d\n",
+                static_cast<int>(i), static_cast<int>(num_lanes),
+                static_cast<int>(k_lanes));
+    }
+  }
+  HWY_ASSERT(input_stats == output_stats);
+}
+
+template <class Traits>
+void TestSortSegments(size_t max_keys) {
+  using Order = typename Traits::Order;
+  using LaneType = typename Traits::LaneType;
+  using KeyType = typename Traits::KeyType;
+  SharedTraits<Traits> st;
+  constexpr size_t N1 = st.LanesPerKey();
+  Sorter sorter;
+
+  // Random sizes up to `max_keys`, also empty and single keys.
+  RandomState rng(max_keys);
+  std::vector<size_t> offsets(1, 0);
+  for (size_t i = 0; i < 300; ++i) {
+    const size_t num_keys = (i < 2) ? i : Random32(&rng) % (max_keys + 1);
+    offsets.push_back(offsets.back() + num_keys);
+  }
+  const size_t num_segments = offsets.size() - 1;
+  const size_t num_lanes = offsets.back() * N1;
+
+  auto lanes = hwy::AllocateAligned<LaneType>(num_lanes);
+  for (Dist dist : {Dist::kUniform8, Dist::kUniform32}) {
+    (void)GenerateInput(dist, lanes.get(), num_lanes);
+    std::vector<InputStats<LaneType>> input_stats(num_segments);
+    std::vector<CompareResults<Traits>> compare;
+    for (size_t i = 0; i < num_segments; ++i) {
+      for (size_t j = offsets[i] * N1; j < offsets[i + 1] * N1; ++j) {
+        input_stats[i].Notify(lanes[j]);
+      }
+      compare.emplace_back(lanes.get() + offsets[i] * N1,
+                           (offsets[i + 1] - offsets[i]) * N1);
+    }
+
+    sorter.SortSegments(reinterpret_cast<KeyType*>(lanes.get()),
+                        offsets.data(), num_segments, Order());
+
+    for (size_t i = 0; i < num_segments; ++i) {
+      LaneType* segment = lanes.get() + offsets[i] * N1;
+      const size_t num = (offsets[i + 1] - offsets[i]) * N1;
+      // The order of values whose keys are equal is unspecified.
+      HWY_ASSERT(st.IsKV() || compare[i].Verify(segment));
+      if (num == 0) continue;  // VerifySort requires at least one key.
+      HWY_ASSERT(VerifySort(st, input_stats[i], segment, num,
+                            "TestSortSegments"));
+    }
+  }
+}
+
+void TestAllSortSegments() {
+  // Only small segments, and some larger than BaseCaseNum.
+  for (size_t max_keys : {size_t{20}, size_t{300}, size_t{1500}}) {
+    TestSortSegments<TraitsLane<OrderAscending<uint16_t> > >(max_keys);
+    TestSortSegments<TraitsLane<OrderDescending<int32_t> > >(max_keys);
+    TestSortSegments<TraitsLane<OrderAscending<uint64_t> > >(max_keys);
+    TestSortSegments<TraitsLane<OrderDescending<float> > >(max_keys);
+
+    TestSortSegments<Traits128<OrderAscending128> >(max_keys);
+    TestSortSegments<Traits128<OrderDescendingKV128> >(max_keys);
+    TestSortSegments<TraitsLane<OrderAscendingKV64> >(max_keys);
+  }
+}
+
+template <class Traits>
+void TestPartialSort(size_t num_lanes) {
+  using Order = typename Traits::Order;
+  using LaneType = typename Traits::LaneType;
+  using KeyType = typename Traits::KeyType;
+  SharedTraits<Traits> st;
+  Sorter sorter;
+
+  // Round up to a whole number of keys.
+  num_lanes += (st.Is128() && (num_lanes & 1));
+  const size_t num_keys = num_lanes / st.LanesPerKey();
+
+  auto lanes = hwy::AllocateAligned<LaneType>(num_lanes);
+  auto expected = hwy::AllocateAligned<LaneType>(num_lanes);
+  // Includes k > num_keys, which is clamped.
+  for (size_t k : {size_t{0}, size_t{1}, size_t{3}, size_t{100}, num_keys / 2,
+                   num_keys - 1, num_keys, num_keys + 1}) {
+    for (Dist dist : {Dist::kUniform8, Dist::kUniform32}) {
+      InputStats<LaneType> input_stats =
+          GenerateInput(dist, lanes.get(), num_lanes);
+      memcpy(expected.get(), lanes.get(), num_lanes * sizeof(LaneType));
+      sorter(reinterpret_cast<KeyType*>(expected.get()), num_keys, Order());
+
+      sorter.PartialSort(reinterpret_cast<KeyType*>(lanes.get()), num_keys, k,
+                         Order());
+      VerifyPartialSort(st, input_stats, expected.get(), lanes.get(),
+                        num_lanes, HWY_MIN(k, num_keys) * st.LanesPerKey());
+    }
+  }
+}
+
+void TestAllPartialSort() {
+  for (int num : {129, 3 * 1000, 34567}) {
+    const size_t num_lanes = AdjustedReps(static_cast<size_t>(num));
+    TestPartialSort<TraitsLane<OrderAscending<int16_t> > >(num_lanes);
+    TestPartialSort<TraitsLane<OrderDescending<uint32_t> > >(num_lanes);
+    TestPartialSort<TraitsLane<OrderAscending<uint64_t> > >(num_lanes);
+    TestPartialSort<TraitsLane<OrderDescending<float> > >(num_lanes);
+#if HWY_HAVE_FLOAT64
+    if (Sorter::HaveFloat64()) {
+      TestPartialSort<TraitsLane<OrderAscending<double> > >(num_lanes);
+    }
+#endif
+
+    TestPartialSort<Traits128<OrderAscending128> >(num_lanes);
+    TestPartialSort<Traits128<OrderDescending128> >(num_lanes);
+    TestPartialSort<TraitsLane<OrderAscendingKV64> >(num_lanes);
+    TestPartialSort<Traits128<OrderDescendingKV128> >(num_lanes);
+  }
+}
+
+template <class Traits>
+void TestSelect(size_t num_lanes) {
+  using Order = typename Traits::Order;
+  using LaneType = typename Traits::LaneType;
+  using KeyType = typename Traits::KeyType;
+  SharedTraits<Traits> st;
+  Sorter sorter;
+
+  // Round up to a whole number of keys.
+  num_lanes += (st.Is128() && (num_lanes & 1));
+  const size_t num_keys = num_lanes / st.LanesPerKey();
+
+  auto lanes = hwy::AllocateAligned<LaneType>(num_lanes);
+  for (size_t k : {size_t{0}, size_t{1}, num_keys / 3, num_keys / 2,
+                   num_keys - 1}) {
+    for (Dist dist : {Dist::kUniform8, Dist::kUniform32}) {
+      InputStats<LaneType> input_stats =
+          GenerateInput(dist, lanes.get(), num_lanes);
+      sorter.Select(reinterpret_cast<KeyType*>(lanes.get()), num_keys, k,
+                    Order());
+      HWY_ASSERT(VerifySelect(st, input_stats, lanes.get(), num_lanes,
+                              k * st.LanesPerKey(), "TestSelect"));
+    }
+  }
+
+  // k >= n is a no-op.
+  (void)GenerateInput(Dist::kUniform32, lanes.get(), num_lanes);
+  const std::vector<LaneType> copy(lanes.get(), lanes.get() + num_lanes);
+  sorter.Select(reinterpret_cast<KeyType*>(lanes.get()), num_keys, num_keys,
+                Order());
+  HWY_ASSERT(memcmp(lanes.get(), copy.data(), num_lanes * sizeof(LaneType)) ==
+             0);
+}
+
+void TestAllSelect() {
+  for (int num : {129, 3 * 1000, 34567}) {
+    const size_t num_lanes = AdjustedReps(static_cast<size_t>(num));
+    TestSelect<TraitsLane<OrderDescending<int16_t> > >(num_lanes);
+    TestSelect<TraitsLane<OrderAscending<uint32_t> > >(num_lanes);
+    TestSelect<TraitsLane<OrderDescending<int64_t> > >(num_lanes);
+    TestSelect<TraitsLane<OrderAscending<float> > >(num_lanes);
+#if HWY_HAVE_FLOAT64
+    if (Sorter::HaveFloat64()) {
+      TestSelect<TraitsLane<OrderDescending<double> > >(num_lanes);
+    }
+#endif
+
+    TestSelect<Traits128<OrderDescending128> >(num_lanes);
+    TestSelect<TraitsLane<OrderDescendingKV64> >(num_lanes);
+    TestSelect<Traits128<OrderAscendingKV128> >(num_lanes);
+  }
+}
+
+template <typename TK, typename TI, class Order>
+void TestArgsort(size_t num) {
+  Sorter sorter;
+  auto keys = hwy::AllocateAligned<TK>(num);
+  auto indices = hwy::AllocateAligned<TI>(num);
+  std::vector<bool> seen(num);
+
+  for (Dist dist : {Dist::kUniform8, Dist::kUniform32}) {
+    (void)GenerateInput(dist, keys.get(), num);
+    // GenerateInput only returns non-negative floats.
+    if (IsFloat<TK>()) {
+      for (size_t i = 1; i < num; i += 2) {
+        keys[i] = static_cast<TK>(-keys[i]);
+      }
+    }
+    const std::vector<TK> copy(keys.get(), keys.get() + num);
+
+    sorter.Argsort(keys.get(), num, indices.get(), Order());
+
+    HWY_ASSERT(memcmp(keys.get(), copy.data(), num * sizeof(TK)) == 0);
+    std::fill(seen.begin(), seen.end(), false);
+    for (size_t i = 0; i < num; ++i) {
+      const size_t idx = static_cast<size_t>(indices[i]);
+      HWY_ASSERT(idx < num && !seen[idx]);
+      seen[idx] = true;
+      if (i == 0) continue;
+      const TK prev = keys[static_cast<size_t>(indices[i - 1])];
+      const TK key = keys[idx];
+      if (Order().IsAscending() ? (key < prev) : (prev < key)) {
+        HWY_ABORT("Argsort: wrong order at %d of %d\n", static_cast<int>(i),
+                  static_cast<int>(num));
+      }
+      // Stable: equal keys remain in their original order. Only check for
+      // integer keys because -0.0 and 0.0 are equal but not identical.
+      if (!IsFloat<TK>() && key == prev && indices[i] < indices[i - 1]) {
+        HWY_ABORT("Argsort: unstable at %d of %d\n", static_cast<int>(i),
+                  static_cast<int>(num));
+      }
+    }
+  }
+}
+
+void TestAllArgsort() {
+  for (int num : {1, 7, 129, 3 * 1000, 34567}) {
+    const size_t n = AdjustedReps(static_cast<size_t>(num));
+    TestArgsort<uint32_t, uint32_t, SortAscending>(n);
+    TestArgsort<int32_t, uint32_t, SortDescending>(n);
+    TestArgsort<float, uint32_t, SortAscending>(n);
+    TestArgsort<float, uint32_t, SortDescending>(n);
+    TestArgsort<uint64_t, uint64_t, SortDescending>(n);
+    TestArgsort<int64_t, uint64_t, SortAscending>(n);
+#if HWY_HAVE_FLOAT64
+    if (Sorter::HaveFloat64()) {
+      TestArgsort<double, uint64_t, SortDescending>(n);
+    }
+#endif
+  }
+}
+
+// Fills records with keys at `key_offset`, the original position (u32) at
+// `index_offset` and other bytes derived from both, then checks the order of
+// keys, stability and that the other bytes are unchanged.
+template <typename TK, class Order>
+void TestSortRecords(size_t num, size_t record_bytes, size_t key_offset) {
+  Sorter sorter;
+  RandomState rng;
+  const size_t index_offset = key_offset >= 4 ? 0 : key_offset + sizeof(TK);
+  HWY_ASSERT(index_offset + 4 <= record_bytes);
+  const auto payload = [](size_t index, size_t byte) {
+    return static_cast<uint8_t>(index * 131 + byte * 7);
+  };
+  const auto is_payload = [&](size_t byte) {
+    return (byte < key_offset || byte >= key_offset + sizeof(TK)) &&
+           (byte < index_offset || byte >= index_offset + 4);
+  };
+  auto records = hwy::AllocateAligned<uint8_t>(num * record_bytes);
+  std::vector<bool> seen(num);
+
+  // Many equal keys, or mostly unique keys.
+  for (uint64_t mask : {uint64_t{0xFF}, ~uint64_t{0}}) {
+    for (size_t i = 0; i < num; ++i) {
+      uint8_t* record = records.get() + i * record_bytes;
+      for (size_t byte = 0; byte < record_bytes; ++byte) {
+        record[byte] = payload(i, byte);
+      }
+      const uint64_t bits = Random64(&rng) & mask;
+      TK key = static_cast<TK>(bits);
+      if (IsFloat<TK>() && (bits & 0x100)) key = static_cast<TK>(-key);
+      CopyBytes<sizeof(TK)>(&key, record + key_offset);
+      const uint32_t index = static_cast<uint32_t>(i);
+      CopyBytes<4>(&index, record + index_offset);
+    }
+
+    const TK* first_key =
+        reinterpret_cast<const TK*>(records.get() + key_offset);
+    sorter.SortRecords(records.get(), num, record_bytes, first_key, Order());
+
+    std::fill(seen.begin(), seen.end(), false);
+    TK prev = TK();
+    uint32_t prev_index = 0;
+    for (size_t i = 0; i < num; ++i) {
+      const uint8_t* record = records.get() + i * record_bytes;
+      TK key;
+      uint32_t index;
+      CopyBytes<sizeof(TK)>(record + key_offset, &key);
+      CopyBytes<4>(record + index_offset, &index);
+      HWY_ASSERT(index < num && !seen[index]);
+      seen[index] = true;
+      for (size_t byte = 0; byte < record_bytes; ++byte) {
+        if (is_payload(byte) && record[byte] != payload(index, byte)) {
+          HWY_ABORT("SortRecords: payload mismatch at %d of %d\n",
+                    static_cast<int>(i), static_cast<int>(num));
+        }
+      }
+      if (i != 0) {
+        if (Order().IsAscending() ? (key < prev) : (prev < key)) {
+          HWY_ABORT("SortRecords: wrong order at %d of %d\n",
+                    static_cast<int>(i), static_cast<int>(num));
+        }
+        // -0.0 and 0.0 are equal but not identical, hence compare bits.
+        if (memcmp(&key, &prev, sizeof(TK)) == 0 && index < prev_index) {
+          HWY_ABORT("SortRecords: unstable at %d of %d\n",
+                    static_cast<int>(i), static_cast<int>(num));
+        }
+      }
+      prev = key;
+      prev_index = index;
+    }
+  }
+}
+
+void TestAllSortRecords() {
+  for (int num : {1, 7, 129, 3 * 1000, 34567}) {
+    const size_t n = AdjustedReps(static_cast<size_t>(num));
+    // Key at the start, an unaligned offset or the end; the latter tests
+    // that gathers do not read past the last record.
+    TestSortRecords<uint32_t, SortAscending>(n, 32, 0);
+    TestSortRecords<int32_t, SortDescending>(n, 36, 13);
+    TestSortRecords<float, SortAscending>(n, 64, 60);
+    TestSortRecords<float, SortDescending>(n, 12, 4);
+    TestSortRecords<uint64_t, SortDescending>(n, 64, 8);
+    TestSortRecords<int64_t, SortAscending>(n, 128, 120);
+    TestSortRecords<uint64_t, SortAscending>(n, 51, 3);
+#if HWY_HAVE_FLOAT64
+    if (Sorter::HaveFloat64()) {
+      TestSortRecords<double, SortDescending>(n, 128, 40);
+    }
+#endif
+  }
+}
+
+// Sets each value to its original position, then checks the order of keys and
+// that values of equal keys are still ascending.
+template <typename KV, class Order>
+void TestStableSort(size_t num_keys) {
+  using TK = decltype(KV::key);
+  Sorter sorter;
+  RandomState rng;
+  auto keys = hwy::AllocateAligned<KV>(num_keys);
+  std::vector<bool> seen(num_keys);
+
+  // Many equal keys, or mostly unique keys.
+  for (uint64_t mask : {uint64_t{0xFF}, ~uint64_t{0}}) {
+    for (size_t i = 0; i < num_keys; ++i) {
+      keys[i].key = static_cast<TK>(Random64(&rng) & mask);
+      keys[i].value = static_cast<TK>(i);
+    }
+
+    sorter.StableSort(keys.get(), num_keys, Order());
+
+    std::fill(seen.begin(), seen.end(), false);
+    for (size_t i = 0; i < num_keys; ++i) {
+      const size_t value = static_cast<size_t>(keys[i].value);
+      HWY_ASSERT(value < num_keys && !seen[value]);
+      seen[value] = true;
+      if (i == 0) continue;
+      const KV& prev = keys[i - 1];
+      if (Order().IsAscending() ? (keys[i] < prev) : (prev < keys[i])) {
+        HWY_ABORT("StableSort: wrong order at %d of %d\n",
+                  static_cast<int>(i), static_cast<int>(num_keys));
+      }
+      if (keys[i].key == prev.key && keys[i].value < prev.value) {
+        HWY_ABORT("StableSort: unstable at %d of %d\n", static_cast<int>(i),
+                  static_cast<int>(num_keys));
+      }
+    }
+  }
+}
+
+void TestAllStableSort() {
+  for (int num : {1, 7, 129, 3 * 1000, 34567}) {
+    const size_t n = AdjustedReps(static_cast<size_t>(num));
+    TestStableSort<K32V32, SortAscending>(n);
+    TestStableSort<K32V32, SortDescending>(n);
+    TestStableSort<K64V64, SortAscending>(n);
+    TestStableSort<K64V64, SortDescending>(n);
+  }
+}
+
+// Sorts runs of random lengths, merges them and checks the result.
+template <class Traits>
+void TestMerge(size_t num_lanes) {
+  using Order = typename Traits::Order;
+  using LaneType = typename Traits::LaneType;
+  using KeyType = typename Traits::KeyType;
+  SharedTraits<Traits> st;
+  Sorter sorter;
+  RandomState rng;
+
+  // Round up to a whole number of keys.
+  num_lanes += (st.Is128() && (num_lanes & 1));
+  const size_t num_keys = num_lanes / st.LanesPerKey();
+
+  auto in_lanes = hwy::AllocateAligned<LaneType>(num_lanes);
+  auto out_lanes = hwy::AllocateAligned<LaneType>(num_lanes);
+  auto out2_lanes = hwy::AllocateAligned<LaneType>(num_lanes);
+  auto scratch_lanes = hwy::AllocateAligned<LaneType>(num_lanes);
+  KeyType* in = reinterpret_cast<KeyType*>(in_lanes.get());
+  KeyType* out = reinterpret_cast<KeyType*>(out_lanes.get());
+  KeyType* out2 = reinterpret_cast<KeyType*>(out2_lanes.get());
+  KeyType* scratch = reinterpret_cast<KeyType*>(scratch_lanes.get());
+
+  for (Dist dist : {Dist::kUniform8, Dist::kUniform32}) {
+    // Two-way, including empty and very short inputs.
+    for (size_t num_a : {size_t{0}, size_t{1}, size_t{7}, num_keys / 3,
+                         num_keys / 2, num_keys}) {
+      InputStats<LaneType> input_stats =
+          GenerateInput(dist, in_lanes.get(), num_lanes);
+      const size_t num_b = num_keys - num_a;
+      sorter(in, num_a, Order());
+      sorter(in + num_a, num_b, Order());
+      sorter.Merge(in, num_a, in + num_a, num_b, out, Order());
+      HWY_ASSERT(VerifySort(st, input_stats, out_lanes.get(), num_lanes,
+                            "TestMerge"));
+    }
+
+    // K-way with random boundaries.
+    for (size_t num_runs : {size_t{1}, size_t{3}, size_t{8}, size_t{13}}) {
+      InputStats<LaneType> input_stats =
+          GenerateInput(dist, in_lanes.get(), num_lanes);
+      std::vector<size_t> bounds = {0, num_keys};
+      for (size_t i = 1; i < num_runs; ++i) {
+        bounds.push_back(Random32(&rng) % (num_keys + 1));
+      }
+      std::sort(bounds.begin(), bounds.end());
+      std::vector<const KeyType*> runs;
+      std::vector<size_t> run_sizes;
+      for (size_t i = 0; i < num_runs; ++i) {
+        runs.push_back(in + bounds[i]);
+        run_sizes.push_back(bounds[i + 1] - bounds[i]);
+        sorter(in + bounds[i], run_sizes.back(), Order());
+      }
+      sorter.Merge(runs.data(), run_sizes.data(), num_runs, out, Order());
+      HWY_ASSERT(VerifySort(st, input_stats, out_lanes.get(), num_lanes,
+                            "TestMergeRuns"));
+
+      // Caller-owned scratch memory does not change the result.
+      sorter.Merge(runs.data(), run_sizes.data(), num_runs, out2, scratch,
+                   Order());
+      HWY_ASSERT(memcmp(out, out2, num_lanes * sizeof(LaneType)) == 0);
+    }
+  }
+}
+
+void TestAllMerge() {
+  for (int num : {129, 3 * 1000, 34567}) {
+    const size_t num_lanes = AdjustedReps(static_cast<size_t>(num));
+    TestMerge<TraitsLane<OrderAscending<uint16_t> > >(num_lanes);
+    TestMerge<TraitsLane<OrderDescending<int32_t> > >(num_lanes);
+    TestMerge<TraitsLane<OrderAscending<uint64_t> > >(num_lanes);
+    TestMerge<TraitsLane<OrderDescending<float> > >(num_lanes);
+#if HWY_HAVE_FLOAT64
+    if (Sorter::HaveFloat64()) {
+      TestMerge<TraitsLane<OrderAscending<double> > >(num_lanes);
+    }
+#endif
+
+    TestMerge<Traits128<OrderAscending128> >(num_lanes);
+    TestMerge<TraitsLane<OrderDescendingKV64> >(num_lanes);
+    TestMerge<Traits128<OrderDescendingKV128> >(num_lanes);
+  }
 }
 
 }  // namespace
@@ -612,14 +1547,47 @@ HWY_AFTER_NAMESPACE();
 
 #if HWY_ONCE
 
+#if HWY_SORT_TEST_COUNT_MALLOC
+namespace {
+std::atomic<size_t> g_malloc_calls{0};
+}  // namespace
+
+extern "C" void* __libc_malloc(size_t size);
+
+extern "C" void* malloc(size_t size) noexcept {
+  g_malloc_calls.fetch_add(1, std::memory_order_relaxed);
+  return __libc_malloc(size);
+}
+
+size_t hwy::MallocCalls() {
+  return g_malloc_calls.load(std::memory_order_relaxed);
+}
+#else
+size_t hwy::MallocCalls() { return 0; }
+#endif  // HWY_SORT_TEST_COUNT_MALLOC
+
 namespace hwy {
 namespace {
 HWY_BEFORE_TEST(SortTest);
 HWY_EXPORT_AND_TEST_P(SortTest, TestAllMedian);
 HWY_EXPORT_AND_TEST_P(SortTest, TestAllBaseCase);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllSortBlock);
 HWY_EXPORT_AND_TEST_P(SortTest, TestAllPartition);
 HWY_EXPORT_AND_TEST_P(SortTest, TestAllGenerator);
 HWY_EXPORT_AND_TEST_P(SortTest, TestAllSort);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllPresorted);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllScratch);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllSortStats);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllRadixSort);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllFloat16);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllParallelSort);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllSortSegments);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllPartialSort);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllSelect);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllArgsort);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllSortRecords);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllStableSort);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllMerge);
 }  // namespace
 }  // namespace hwy
 
@@ -22,6 +22,8 @@
 #define HIGHWAY_HWY_CONTRIB_SORT_SORTING_NETWORKS_TOGGLE
 #endif
 
+#include <string.h>  // memcpy
+
 #include "hwy/contrib/sort/shared-inl.h"  // SortConstants
 #include "hwy/highway.h"
 
@@ -68,6 +70,19 @@ struct SharedTraits : public Base {
     base->Sort2(d, v, swapped);
     return ConcatUpperLower(d, swapped, v);  // 8 = half of the vector
   }
+
+  // Conditionally swaps each key in the lower half of the vector with the key
+  // at the same position in the upper half.
+  template <class D>
+  HWY_INLINE Vec<D> SortPairsHalves(D d, Vec<D> v) const {
+    const Base* base = static_cast<const Base*>(this);
+    const Vec<D> swapped = ConcatLowerUpper(d, v, v);
+    // Decide once per pair and apply to both halves. Sort2 would compare each
+    // half separately, which loses one of two KV with equal keys.
+    const Vec<D> swap_lower = VecFromMask(d, base->Compare(d, swapped, v));
+    const Vec<D> select = ConcatLowerLower(d, swap_lower, swap_lower);
+    return IfVecThenElse(select, swapped, v);
+  }
 };
 
 // ------------------------------ Sorting network
@@ -588,6 +603,41 @@ HWY_INLINE void Merge16(D d, Traits st, V& v0, V& v1, V& v2, V& v3, V& v4,
 
 #endif  // !HWY_COMPILER_MSVC
 
+// ------------------------------ Merging two vectors
+
+// Bitonic merge of two sorted vectors of up to 16 keys: afterwards, `v0` holds
+// the first and `v1` the last half of their union, both sorted. Reversing `v1`
+// makes their concatenation bitonic; Sort2 splits it into two bitonic halves,
+// which the half-cleaners with decreasing distances then sort.
+template <class D, class Traits, class V = Vec<D>>
+HWY_INLINE void MergeSortedVectors(D d, Traits st, V& v0, V& v1) {
+  constexpr size_t kLanesPerKey = st.LanesPerKey();
+  constexpr size_t kMaxKeys = MaxLanes(d) / kLanesPerKey;
+  const size_t keys = Lanes(d) / kLanesPerKey;
+  HWY_DASSERT(keys <= 16);
+
+  v1 = st.ReverseKeys(d, v1);
+  st.Sort2(d, v0, v1);
+  // As in SortingNetwork, checking kMaxKeys avoids generating code for
+  // unreachable paths, some of which are not supported by all traits.
+  if (kMaxKeys >= 4 && keys >= 4) {
+    v0 = st.SortPairsHalves(d, v0);
+    v1 = st.SortPairsHalves(d, v1);
+  }
+  if (kMaxKeys >= 16 && keys >= 16) {
+    v0 = st.SortPairsDistance4(d, v0);
+    v1 = st.SortPairsDistance4(d, v1);
+  }
+  if (kMaxKeys >= 8 && keys >= 8) {
+    v0 = st.SortPairsDistance2(d, v0);
+    v1 = st.SortPairsDistance2(d, v1);
+  }
+  if (kMaxKeys >= 2 && keys >= 2) {
+    v0 = st.SortPairsDistance1(d, v0);
+    v1 = st.SortPairsDistance1(d, v1);
+  }
+}
+
 // Reshapes `buf` into a matrix, sorts columns independently, and then merges
 // into a sorted 1D array without transposing.
 //
@@ -699,6 +749,88 @@ struct SharedTraits : public Base {};
 #endif  // VQSORT_ENABLED
 
 }  // namespace detail
+
+#if VQSORT_ENABLED || HWY_IDE
+
+// ------------------------------ SortBlock
+
+// Returns the largest number of keys that SortBlock can sort on this target.
+template <class Traits>
+HWY_API size_t MaxSortBlockKeys(Traits st) {
+  const CappedTag<typename Traits::LaneType, SortConstants::kMaxCols> d;
+  return SortConstants::BaseCaseNum(Lanes(d)) / st.LanesPerKey();
+}
+
+// Sorts `kKeys` keys with the same sorting network as BaseCase, without any
+// of the checks of Sort. Intended for per-target kernels that repeatedly sort
+// small blocks, e.g. median filters. `kKeys` must be a power of two, at least
+// 16 and at most MaxSortBlockKeys(st), e.g. 256 32-bit keys with AVX-512. If
+// the block is exactly 16 vectors, it is sorted entirely in registers,
+// otherwise via a copy on the stack.
+//
+// `st` is SharedTraits<Traits*<Order*>>, as for Sort.
+template <size_t kKeys, class Traits, typename T>
+HWY_API void SortBlock(Traits st, T* HWY_RESTRICT keys) {
+  constexpr size_t kRows = SortConstants::kMaxRows;
+  constexpr size_t kLanes = kKeys * st.LanesPerKey();
+  constexpr size_t kCols = kLanes / kRows;
+  static_assert(kCols * kRows == kLanes && (kCols & (kCols - 1)) == 0 &&
+                    kCols >= st.LanesPerKey(),
+                "kKeys must be a power of two and at least 16");
+  const CappedTag<T, SortConstants::kMaxCols> d;
+  HWY_ASSERT(kCols <= Lanes(d));
+
+  if (kCols != Lanes(d)) {
+    // Full vectors would cross the end of `keys`; pad the last one.
+    HWY_ALIGN T buf[kLanes + SortConstants::kMaxCols];
+    memcpy(buf, keys, sizeof(T) * kLanes);
+    StoreU(st.LastValue(d), d, buf + kLanes);
+    detail::SortingNetwork(st, buf, kCols);
+    memcpy(keys, buf, sizeof(T) * kLanes);
+    return;
+  }
+
+  using V = Vec<decltype(d)>;
+  V v0 = LoadU(d, keys + 0x0 * kCols);
+  V v1 = LoadU(d, keys + 0x1 * kCols);
+  V v2 = LoadU(d, keys + 0x2 * kCols);
+  V v3 = LoadU(d, keys + 0x3 * kCols);
+  V v4 = LoadU(d, keys + 0x4 * kCols);
+  V v5 = LoadU(d, keys + 0x5 * kCols);
+  V v6 = LoadU(d, keys + 0x6 * kCols);
+  V v7 = LoadU(d, keys + 0x7 * kCols);
+  V v8 = LoadU(d, keys + 0x8 * kCols);
+  V v9 = LoadU(d, keys + 0x9 * kCols);
+  V va = LoadU(d, keys + 0xa * kCols);
+  V vb = LoadU(d, keys + 0xb * kCols);
+  V vc = LoadU(d, keys + 0xc * kCols);
+  V vd = LoadU(d, keys + 0xd * kCols);
+  V ve = LoadU(d, keys + 0xe * kCols);
+  V vf = LoadU(d, keys + 0xf * kCols);
+
+  detail::SortingNetwork(st, kCols, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, va,
+                         vb, vc, vd, ve, vf);
+
+  StoreU(v0, d, keys + 0x0 * kCols);
+  StoreU(v1, d, keys + 0x1 * kCols);
+  StoreU(v2, d, keys + 0x2 * kCols);
+  StoreU(v3, d, keys + 0x3 * kCols);
+  StoreU(v4, d, keys + 0x4 * kCols);
+  StoreU(v5, d, keys + 0x5 * kCols);
+  StoreU(v6, d, keys + 0x6 * kCols);
+  StoreU(v7, d, keys + 0x7 * kCols);
+  StoreU(v8, d, keys + 0x8 * kCols);
+  StoreU(v9, d, keys + 0x9 * kCols);
+  StoreU(va, d, keys + 0xa * kCols);
+  StoreU(vb, d, keys + 0xb * kCols);
+  StoreU(vc, d, keys + 0xc * kCols);
+  StoreU(vd, d, keys + 0xd * kCols);
+  StoreU(ve, d, keys + 0xe * kCols);
+  StoreU(vf, d, keys + 0xf * kCols);
+}
+
+#endif  // VQSORT_ENABLED
+
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
 }  // namespace hwy
@@ -440,9 +440,12 @@ struct TraitsLane : public Base {
 
     const Vec<D> a_copy = a;
     // Prior to AVX3, there is no native 64-bit Min/Max, so they compile to 4
-    // instructions. We can reduce it to a compare + 2 IfThenElse.
+    // instructions. We can reduce it to a compare + 2 IfThenElse. Not for
+    // key-value types: if their keys are equal, this swaps a and b, which
+    // loses one of them when callers blend the two outputs of a Sort2 of v and
+    // its permutation, whereas Min/Max include the value and are symmetric.
 #if HWY_AVX3 < HWY_TARGET && HWY_TARGET <= HWY_SSSE3
-    if (sizeof(TFromD<D>) == 8) {
+    if (sizeof(TFromD<D>) == 8 && !base->IsKV()) {
       const Mask<D> cmp = base->Compare(d, a, b);
       a = IfThenElse(cmp, a, b);
       b = IfThenElse(cmp, b, a_copy);
@@ -505,6 +508,7 @@ struct TraitsLane : public Base {
 template <typename T>
 struct KeyLane {
   constexpr bool Is128() const { return false; }
+  constexpr bool IsKV() const { return false; }
   constexpr size_t LanesPerKey() const { return 1; }
 
   using LaneType = T;
@@ -541,6 +545,27 @@ struct OrderDescending : public KeyLane<T> {
   }
 };
 
+// Key in the upper 32 bits, value in the lower.
+struct KeyValue64 : public KeyLane<uint64_t> {
+  constexpr bool IsKV() const { return true; }
+};
+
+struct OrderAscendingKV64 : public KeyValue64 {
+  using Order = SortAscending;
+
+  HWY_INLINE bool Compare1(const LaneType* a, const LaneType* b) {
+    return (*a >> 32) < (*b >> 32);
+  }
+};
+
+struct OrderDescendingKV64 : public KeyValue64 {
+  using Order = SortDescending;
+
+  HWY_INLINE bool Compare1(const LaneType* a, const LaneType* b) {
+    return (*b >> 32) < (*a >> 32);
+  }
+};
+
 template <class Order>
 struct TraitsLane : public Order {
   // For HeapSort
@@ -506,6 +506,74 @@ class Traits128 : public Base {
   }
 };
 
+#else
+
+// Only what HeapSort, Merge and Argsort require. Scalar because the vectors of
+// HWY_SCALAR cannot hold a 128-bit key.
+struct KeyAny128 {
+  static constexpr bool Is128() { return true; }
+  constexpr size_t LanesPerKey() const { return 2; }
+
+  using LaneType = uint64_t;
+
+  HWY_INLINE void Swap(LaneType* a, LaneType* b) const {
+    const LaneType temp0 = a[0];
+    const LaneType temp1 = a[1];
+    a[0] = b[0];
+    a[1] = b[1];
+    b[0] = temp0;
+    b[1] = temp1;
+  }
+};
+
+struct Key128 : public KeyAny128 {
+  static constexpr bool IsKV() { return false; }
+  using KeyType = hwy::uint128_t;
+  std::string KeyString() const { return "U128"; }
+};
+
+struct OrderAscending128 : public Key128 {
+  using Order = SortAscending;
+
+  HWY_INLINE bool Compare1(const LaneType* a, const LaneType* b) {
+    return (a[1] == b[1]) ? a[0] < b[0] : a[1] < b[1];
+  }
+};
+
+struct OrderDescending128 : public Key128 {
+  using Order = SortDescending;
+
+  HWY_INLINE bool Compare1(const LaneType* a, const LaneType* b) {
+    return (a[1] == b[1]) ? b[0] < a[0] : b[1] < a[1];
+  }
+};
+
+// Key in the upper lane, value in the lower.
+struct KeyValue128 : public KeyAny128 {
+  static constexpr bool IsKV() { return true; }
+  using KeyType = K64V64;
+  std::string KeyString() const { return "KV128"; }
+};
+
+struct OrderAscendingKV128 : public KeyValue128 {
+  using Order = SortAscending;
+
+  HWY_INLINE bool Compare1(const LaneType* a, const LaneType* b) {
+    return a[1] < b[1];
+  }
+};
+
+struct OrderDescendingKV128 : public KeyValue128 {
+  using Order = SortDescending;
+
+  HWY_INLINE bool Compare1(const LaneType* a, const LaneType* b) {
+    return b[1] < a[1];
+  }
+};
+
+template <class Base>
+struct Traits128 : public Base {};
+
 #endif  // VQSORT_ENABLED
 
 }  // namespace detail
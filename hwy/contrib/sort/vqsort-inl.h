@@ -34,6 +34,7 @@
 #include <stdio.h>  // unconditional #include so we can use if(VQSORT_PRINT).
 #include <string.h>  // memcpy
 
+#include "hwy/aligned_allocator.h"
 #include "hwy/cache_control.h"        // Prefetch
 #include "hwy/contrib/sort/vqsort.h"  // Fill24Bytes
 
@@ -93,26 +94,54 @@ HWY_INLINE void MaybePrintVector(D d, const char* label, Vec<D> v,
 #endif
 }
 
+// Updates the caller's SortStats. Recursive functions receive a pointer to this
+// that is null unless statistics were requested, so the only cost otherwise is
+// a predictable branch per subarray.
+class StatsRecorder {
+ public:
+  // `max_levels` is the `remaining_levels` argument of the top-level Recurse.
+  StatsRecorder(SortStats* stats, size_t max_levels)
+      : stats_(*stats), max_levels_(max_levels) {}
+
+  void OnLevel(size_t remaining_levels) {
+    stats_.max_depth = HWY_MAX(stats_.max_depth, max_levels_ - remaining_levels);
+  }
+  void OnBaseCase(size_t bytes) {
+    stats_.base_cases += 1;
+    stats_.bytes_moved += bytes;
+  }
+  void OnPartition(size_t bytes) {
+    stats_.partitions += 1;
+    stats_.bytes_moved += bytes;
+  }
+  void OnHeapSort() { stats_.heap_sorts += 1; }
+  void OnTwoValue() { stats_.two_value_partitions += 1; }
+  void OnEqualSamples() { stats_.equal_samples += 1; }
+  void OnPresorted() { stats_.presorted += 1; }
+
+ private:
+  SortStats& stats_;
+  const size_t max_levels_;
+};
+
 // ------------------------------ HeapSort
 
 template <class Traits, typename T>
 void SiftDown(Traits st, T* HWY_RESTRICT lanes, const size_t num_lanes,
               size_t start) {
   constexpr size_t N1 = st.LanesPerKey();
-  const FixedTag<T, N1> d;
 
+  // Scalar comparisons, because 128-bit keys do not fit in the vectors of all
+  // targets for which vqsort is disabled.
   while (start < num_lanes) {
     const size_t left = 2 * start + N1;
     const size_t right = 2 * start + 2 * N1;
     if (left >= num_lanes) break;
     size_t idx_larger = start;
-    const auto key_j = st.SetKey(d, lanes + start);
-    if (AllTrue(d, st.Compare(d, key_j, st.SetKey(d, lanes + left)))) {
+    if (st.Compare1(lanes + start, lanes + left)) {
       idx_larger = left;
     }
-    if (right < num_lanes &&
-        AllTrue(d, st.Compare(d, st.SetKey(d, lanes + idx_larger),
-                              st.SetKey(d, lanes + right)))) {
+    if (right < num_lanes && st.Compare1(lanes + idx_larger, lanes + right)) {
       idx_larger = right;
     }
     if (idx_larger == start) break;
@@ -143,10 +172,83 @@ void HeapSort(Traits st, T* HWY_RESTRICT lanes, const size_t num_lanes) {
   }
 }
 
+// ------------------------------ Merge
+
+// Returns the number of keys at the start of the sorted `lanes` that are
+// ordered before the one at `key`. Exponential search, so the cost is
+// logarithmic in the result rather than in `num_lanes`.
+template <class Traits, typename T>
+size_t CountBefore(Traits st, const T* HWY_RESTRICT lanes, size_t num_lanes,
+                   const T* HWY_RESTRICT key) {
+  constexpr size_t N1 = st.LanesPerKey();
+  const size_t num_keys = num_lanes / N1;
+
+  // Keys [0, lo) are before `key`; key `hi - 1` is not, or is past the end.
+  size_t lo = 0;
+  size_t hi = 1;
+  while (hi <= num_keys && st.Compare1(lanes + (hi - 1) * N1, key)) {
+    lo = hi;
+    hi *= 2;
+  }
+  hi = HWY_MIN(hi - 1, num_keys);
+  while (lo < hi) {
+    const size_t mid = lo + (hi - lo) / 2;
+    if (st.Compare1(lanes + mid * N1, key)) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+// Merges the sorted `few` and `many` into `out`, which must not overlap them.
+// For each key in `few`, copies the keys of `many` ordered before it as a
+// block, hence this is efficient if `few` is short.
+template <class Traits, typename T>
+void MergeGallop(Traits st, const T* HWY_RESTRICT few, size_t num_few,
+                 const T* HWY_RESTRICT many, size_t num_many,
+                 T* HWY_RESTRICT out) {
+  constexpr size_t N1 = st.LanesPerKey();
+  for (size_t i = 0; i < num_few; i += N1) {
+    const size_t num_before = CountBefore(st, many, num_many, few + i) * N1;
+    memcpy(out, many, num_before * sizeof(T));
+    out += num_before;
+    many += num_before;
+    num_many -= num_before;
+    memcpy(out, few + i, N1 * sizeof(T));
+    out += N1;
+  }
+  memcpy(out, many, num_many * sizeof(T));
+}
+
 #if VQSORT_ENABLED || HWY_IDE
 
 // ------------------------------ BaseCase
 
+// For key-value types, the sorting network only compares keys, hence padding
+// may end up before keys whose key equals that of the padding but whose value
+// differs. Swaps such keys from [num, num_padded) into the slots of padding
+// within [0, num). This preserves the sort order because all of them have the
+// same key, and those left behind are identical to padding.
+template <class Traits, typename T>
+HWY_INLINE void MoveKeysBeforePadding(Traits st, T* HWY_RESTRICT buf,
+                                      size_t num, size_t num_padded,
+                                      T padding) {
+  constexpr size_t N1 = st.LanesPerKey();
+  const auto is_padding = [padding](const T* key) {
+    return key[0] == padding && key[N1 - 1] == padding;
+  };
+  size_t j = num;
+  for (size_t i = 0; i < num; i += N1) {
+    if (!is_padding(buf + i)) continue;
+    while (j < num_padded && is_padding(buf + j)) j += N1;
+    if (j == num_padded) return;
+    st.Swap(buf + i, buf + j);
+    j += N1;
+  }
+}
+
 // Sorts `keys` within the range [0, num) via sorting network.
 template <class D, class Traits, typename T>
 HWY_INLINE void BaseCase(D d, Traits st, T* HWY_RESTRICT keys,
@@ -197,6 +299,10 @@ HWY_INLINE void BaseCase(D d, Traits st, T* HWY_RESTRICT keys,
   }
 
   SortingNetwork(st, buf, cols);
+  if (st.IsKV()) {
+    MoveKeysBeforePadding(st, buf, num, cols * Constants::kMaxRows,
+                          GetLane(kPadding));
+  }
 
   for (i = 0; i + N <= num; i += N) {
     StoreU(Load(d, buf + i), d, keys + i);
@@ -1287,36 +1393,22 @@ HWY_NOINLINE void PrintMinMax(D d, Traits st, const T* HWY_RESTRICT keys,
   }
 }
 
-// keys_end is the end of the entire user input, not just the current subarray
-// [keys, keys + num).
+// Chooses a pivot for partitioning `keys[0, num)` and returns true, or returns
+// false if the keys turned out to be already sorted because they are all equal
+// or (except for key-value types) consist of two values that were partitioned.
 template <class D, class Traits, typename T>
-HWY_NOINLINE void Recurse(D d, Traits st, T* HWY_RESTRICT keys,
-                          T* HWY_RESTRICT keys_end, const size_t num,
-                          T* HWY_RESTRICT buf, Generator& rng,
-                          const size_t remaining_levels) {
-  HWY_DASSERT(num != 0);
-
-  if (HWY_UNLIKELY(num <= Constants::BaseCaseNum(Lanes(d)))) {
-    BaseCase(d, st, keys, keys_end, num, buf);
-    return;
-  }
-
-  // Move after BaseCase so we skip printing for small subarrays.
-  if (VQSORT_PRINT >= 1) {
-    fprintf(stderr, "\n\n=== Recurse depth=%zu len=%zu\n", remaining_levels,
-            num);
-    PrintMinMax(d, st, keys, num, buf);
-  }
-
+HWY_INLINE bool ChoosePivot(D d, Traits st, T* HWY_RESTRICT keys,
+                            const size_t num, T* HWY_RESTRICT buf,
+                            Generator& rng, Vec<D>& pivot, PivotResult& result,
+                            StatsRecorder* stats = nullptr) {
   DrawSamples(d, st, keys, num, buf, rng);
 
-  Vec<D> pivot;
-  PivotResult result = PivotResult::kNormal;
   if (HWY_UNLIKELY(UnsortedSampleEqual(d, st, buf))) {
+    if (stats) stats->OnEqualSamples();
     pivot = st.SetKey(d, buf);
     size_t idx_second = 0;
     if (HWY_UNLIKELY(AllEqual(d, st, pivot, keys, num, &idx_second))) {
-      return;
+      return false;
     }
     HWY_DASSERT(idx_second % st.LanesPerKey() == 0);
     // Must capture the value before PartitionIfTwoKeys may overwrite it.
@@ -1330,7 +1422,8 @@ HWY_NOINLINE void Recurse(D d, Traits st, T* HWY_RESTRICT keys,
     if (HWY_UNLIKELY(!st.IsKV() &&
                      PartitionIfTwoKeys(d, st, pivot, keys, num, idx_second,
                                         second, third, buf))) {
-      return;  // Done, skip recursion because each side has all-equal keys.
+      if (stats) stats->OnTwoValue();
+      return false;  // Each side has all-equal keys, hence already sorted.
     }
 
     // We can no longer start scanning from idx_second because
@@ -1340,29 +1433,63 @@ HWY_NOINLINE void Recurse(D d, Traits st, T* HWY_RESTRICT keys,
     // If kNormal, `pivot` is very common but not the first/last. It is
     // tempting to do a 3-way partition (to avoid moving the =pivot keys a
     // second time), but that is a net loss due to the extra comparisons.
-  } else {
-    SortSamples(d, st, buf);
+    return true;
+  }
 
-    // Not supported for key-value types because two 'keys' may be equivalent
-    // but not interchangeable (their values may differ).
-    if (HWY_UNLIKELY(!st.IsKV() &&
-                     PartitionIfTwoSamples(d, st, keys, num, buf))) {
-      return;
-    }
+  SortSamples(d, st, buf);
+
+  // Not supported for key-value types because two 'keys' may be equivalent
+  // but not interchangeable (their values may differ).
+  if (HWY_UNLIKELY(!st.IsKV() &&
+                   PartitionIfTwoSamples(d, st, keys, num, buf))) {
+    if (stats) stats->OnTwoValue();
+    return false;
+  }
+
+  pivot = ChoosePivotByRank(d, st, buf);
+  return true;
+}
+
+// keys_end is the end of the entire user input, not just the current subarray
+// [keys, keys + num). `stats` is non-null if the caller requested SortStats.
+template <class D, class Traits, typename T>
+HWY_NOINLINE void Recurse(D d, Traits st, T* HWY_RESTRICT keys,
+                          T* HWY_RESTRICT keys_end, const size_t num,
+                          T* HWY_RESTRICT buf, Generator& rng,
+                          const size_t remaining_levels,
+                          StatsRecorder* stats = nullptr) {
+  HWY_DASSERT(num != 0);
+  if (stats) stats->OnLevel(remaining_levels);
 
-    pivot = ChoosePivotByRank(d, st, buf);
+  if (HWY_UNLIKELY(num <= Constants::BaseCaseNum(Lanes(d)))) {
+    if (stats) stats->OnBaseCase(num * sizeof(T));
+    BaseCase(d, st, keys, keys_end, num, buf);
+    return;
   }
 
+  // Move after BaseCase so we skip printing for small subarrays.
+  if (VQSORT_PRINT >= 1) {
+    fprintf(stderr, "\n\n=== Recurse depth=%zu len=%zu\n", remaining_levels,
+            num);
+    PrintMinMax(d, st, keys, num, buf);
+  }
+
+  Vec<D> pivot;
+  PivotResult result = PivotResult::kNormal;
+  if (!ChoosePivot(d, st, keys, num, buf, rng, pivot, result, stats)) return;
+
   // Too many recursions. This is unlikely to happen because we select pivots
   // from large (though still O(1)) samples.
   if (HWY_UNLIKELY(remaining_levels == 0)) {
     if (VQSORT_PRINT >= 1) {
       fprintf(stderr, "HeapSort reached, size=%zu\n", num);
     }
+    if (stats) stats->OnHeapSort();
     HeapSort(st, keys, num);  // Slow but N*logN.
     return;
   }
 
+  if (stats) stats->OnPartition(num * sizeof(T));
   const size_t bound = Partition(d, st, keys, num, pivot, buf);
   if (VQSORT_PRINT >= 2) {
     fprintf(stderr, "bound %zu num %zu result %s\n", bound, num,
@@ -1377,18 +1504,161 @@ HWY_NOINLINE void Recurse(D d, Traits st, T* HWY_RESTRICT keys,
   HWY_DASSERT(bound != num);
 
   if (HWY_LIKELY(result != PivotResult::kIsFirst)) {
-    Recurse(d, st, keys, keys_end, bound, buf, rng, remaining_levels - 1);
+    Recurse(d, st, keys, keys_end, bound, buf, rng, remaining_levels - 1,
+            stats);
   }
   if (HWY_LIKELY(result != PivotResult::kWasLast)) {
     Recurse(d, st, keys + bound, keys_end, num - bound, buf, rng,
-            remaining_levels - 1);
+            remaining_levels - 1, stats);
+  }
+}
+
+// Same as Recurse, but only the first `k` (<= num) lanes must be sorted; the
+// others are only partitioned. Subarrays that begin at or after `k` are
+// skipped, which is the main saving when k is much less than num.
+template <class D, class Traits, typename T>
+HWY_NOINLINE void RecursePartial(D d, Traits st, T* HWY_RESTRICT keys,
+                                 T* HWY_RESTRICT keys_end, const size_t num,
+                                 const size_t k, T* HWY_RESTRICT buf,
+                                 Generator& rng,
+                                 const size_t remaining_levels) {
+  HWY_DASSERT(k != 0 && k <= num);
+
+  // BaseCase may also sort keys after the subarray, which is fine because all
+  // of them are ordered after those in the subarray.
+  if (HWY_UNLIKELY(num <= Constants::BaseCaseNum(Lanes(d)))) {
+    BaseCase(d, st, keys, keys_end, num, buf);
+    return;
+  }
+  if (k == num) {
+    Recurse(d, st, keys, keys_end, num, buf, rng, remaining_levels);
+    return;
+  }
+
+  Vec<D> pivot;
+  PivotResult result = PivotResult::kNormal;
+  if (!ChoosePivot(d, st, keys, num, buf, rng, pivot, result)) return;
+
+  if (HWY_UNLIKELY(remaining_levels == 0)) {
+    HeapSort(st, keys, num);  // Slow but N*logN.
+    return;
+  }
+
+  // As in Recurse, both sides are non-empty.
+  const size_t bound = Partition(d, st, keys, num, pivot, buf);
+  // If kIsFirst, the left side is all-equal and thus already sorted.
+  if (HWY_LIKELY(result != PivotResult::kIsFirst)) {
+    if (k <= bound) {
+      RecursePartial(d, st, keys, keys_end, bound, k, buf, rng,
+                     remaining_levels - 1);
+      return;
+    }
+    Recurse(d, st, keys, keys_end, bound, buf, rng, remaining_levels - 1);
+  }
+  if (k > bound && HWY_LIKELY(result != PivotResult::kWasLast)) {
+    RecursePartial(d, st, keys + bound, keys_end, num - bound, k - bound, buf,
+                   rng, remaining_levels - 1);
+  }
+}
+
+// Partitions such that the key at lane `k` (< num) is the one that would be
+// there after sorting, no key before it is ordered after it and no key after it
+// is ordered before it. Same as RecursePartial, except that only the side
+// containing `k` is visited.
+template <class D, class Traits, typename T>
+HWY_NOINLINE void RecurseSelect(D d, Traits st, T* HWY_RESTRICT keys,
+                                T* HWY_RESTRICT keys_end, const size_t num,
+                                const size_t k, T* HWY_RESTRICT buf,
+                                Generator& rng,
+                                const size_t remaining_levels) {
+  HWY_DASSERT(k < num);
+
+  // BaseCase may also sort keys after the subarray, which is fine because all
+  // of them are ordered after those in the subarray.
+  if (HWY_UNLIKELY(num <= Constants::BaseCaseNum(Lanes(d)))) {
+    BaseCase(d, st, keys, keys_end, num, buf);
+    return;
+  }
+
+  Vec<D> pivot;
+  PivotResult result = PivotResult::kNormal;
+  if (!ChoosePivot(d, st, keys, num, buf, rng, pivot, result)) return;
+
+  if (HWY_UNLIKELY(remaining_levels == 0)) {
+    HeapSort(st, keys, num);  // Slow but N*logN.
+    return;
+  }
+
+  // As in Recurse, both sides are non-empty.
+  const size_t bound = Partition(d, st, keys, num, pivot, buf);
+  if (k < bound) {
+    // If kIsFirst, the left side is all-equal and thus already sorted.
+    if (HWY_LIKELY(result != PivotResult::kIsFirst)) {
+      RecurseSelect(d, st, keys, keys_end, bound, k, buf, rng,
+                    remaining_levels - 1);
+    }
+  } else {
+    // If kWasLast, the right side is all-equal and thus already sorted.
+    if (HWY_LIKELY(result != PivotResult::kWasLast)) {
+      RecurseSelect(d, st, keys + bound, keys_end, num - bound, k - bound, buf,
+                    rng, remaining_levels - 1);
+    }
+  }
+}
+
+// Returns whether the keys are already sorted, or if `reverse` is non-null,
+// sets it to whether they are sorted in the opposite order. Early-exits at the
+// first vector with keys in both orders, hence this is cheap for unsorted input
+// and costs at most one pass over the input otherwise.
+template <class D, class Traits, typename T>
+HWY_INLINE bool IsSorted(D d, Traits st, const T* HWY_RESTRICT keys,
+                         size_t num, bool* HWY_RESTRICT reverse) {
+  const size_t N = Lanes(d);
+  constexpr size_t N1 = st.LanesPerKey();
+  HWY_DASSERT(num >= N + N1);
+  bool sorted = true;
+  bool reversed = (reverse != nullptr);
+
+  // Compares each key with its successor. The last iteration overlaps the
+  // previous one, which is harmless.
+  for (size_t i = 0;; i += N) {
+    i = HWY_MIN(i, num - N1 - N);
+    const Vec<D> cur = LoadU(d, keys + i);
+    const Vec<D> next = LoadU(d, keys + i + N1);
+    sorted = sorted && AllFalse(d, st.Compare(d, next, cur));
+    reversed = reversed && AllFalse(d, st.Compare(d, cur, next));
+    if (!sorted && !reversed) return false;
+    if (i == num - N1 - N) break;
+  }
+
+  if (reverse != nullptr) *reverse = !sorted;
+  return true;
+}
+
+// Reverses the order of keys in place.
+template <class D, class Traits, typename T>
+HWY_INLINE void ReverseKeysInPlace(D d, Traits st, T* HWY_RESTRICT keys,
+                                   size_t num) {
+  const size_t N = Lanes(d);
+  constexpr size_t N1 = st.LanesPerKey();
+  size_t left = 0;
+  size_t right = num;  // exclusive
+  for (; right - left >= 2 * N; left += N, right -= N) {
+    const Vec<D> vL = LoadU(d, keys + left);
+    const Vec<D> vR = LoadU(d, keys + right - N);
+    StoreU(st.ReverseKeys(d, vR), d, keys + left);
+    StoreU(st.ReverseKeys(d, vL), d, keys + right - N);
+  }
+  for (; right - left >= 2 * N1; left += N1) {
+    right -= N1;
+    st.Swap(keys + left, keys + right);
   }
 }
 
 // Returns true if sorting is finished.
 template <class D, class Traits, typename T>
 HWY_INLINE bool HandleSpecialCases(D d, Traits st, T* HWY_RESTRICT keys,
-                                   size_t num) {
+                                   size_t num, SortStats* stats = nullptr) {
   const size_t N = Lanes(d);
   const size_t base_case_num = Constants::BaseCaseNum(N);
 
@@ -1408,18 +1678,281 @@ HWY_INLINE bool HandleSpecialCases(D d, Traits st, T* HWY_RESTRICT keys,
       fprintf(stderr, "WARNING: using slow HeapSort: partial %d huge %d\n",
               partial_128, huge_vec);
     }
+    if (stats) stats->heap_sorts += 1;
     HeapSort(st, keys, num);
     return true;
   }
 
-  // Small arrays are already handled by Recurse.
+  // Small arrays are already handled by Recurse, for which this check would
+  // not pay off.
+  if (num <= base_case_num) return false;
 
-  // We could also check for already sorted/reverse/equal, but that's probably
-  // counterproductive if vqsort is used as a base case.
+  // Already sorted or reversed, e.g. appended time series. This also covers
+  // all-equal keys.
+  bool reverse;
+  if (IsSorted(d, st, keys, num, &reverse)) {
+    if (VQSORT_PRINT >= 1) {
+      fprintf(stderr, "Input already sorted, reverse %d\n", reverse);
+    }
+    if (stats) stats->presorted += 1;
+    if (reverse) ReverseKeysInPlace(d, st, keys, num);
+    return true;
+  }
 
   return false;  // not finished sorting
 }
 
+#endif  // VQSORT_ENABLED
+
+// ------------------------------ Argsort
+
+// These only use ops that are available on all targets, hence they are also
+// defined if vqsort is disabled.
+
+// Returns unsigned integers whose order matches that of the keys `v`, so that
+// keys of any type can be sorted as the key of a K32V32 or K64V64 pair.
+template <class D, HWY_IF_UNSIGNED_D(D)>
+HWY_INLINE Vec<D> OrderedBits(D /* tag */, Vec<D> v) {
+  return v;
+}
+
+// Flipping the sign bit maps the most negative value to zero.
+template <class D, HWY_IF_SIGNED_D(D)>
+HWY_INLINE Vec<RebindToUnsigned<D>> OrderedBits(D d, Vec<D> v) {
+  const RebindToUnsigned<D> du;
+  return BitCast(du, Xor(v, SignBit(d)));
+}
+
+// Negative floats are ordered in reverse, hence flip all their bits; only the
+// sign bit of the others. Orders -0.0 before 0.0.
+template <class D, HWY_IF_FLOAT_D(D)>
+HWY_INLINE Vec<RebindToUnsigned<D>> OrderedBits(D /* tag */, Vec<D> v) {
+  const RebindToUnsigned<D> du;
+  const RebindToSigned<D> di;
+  const Vec<decltype(du)> bits = BitCast(du, v);
+  const Vec<decltype(du)> negative =
+      BitCast(du, BroadcastSignBit(BitCast(di, v)));
+  return Xor(bits, Or(negative, SignBit(du)));
+}
+
+// Writes u64 whose upper half holds the ordered bits of `keys` (the ones
+// starting at index `i`), inverted if `flip` is all-ones (for descending
+// order), and whose lower half is the index. Because the indices are unique,
+// sorting these in ascending order is stable.
+template <class D64, class DK, HWY_IF_LANE_SIZE_D(DK, 4)>
+HWY_INLINE void StoreKeyIndex(D64 d64, uint64_t flip, DK dk, Vec<DK> keys,
+                              size_t i, uint64_t* HWY_RESTRICT pairs) {
+  const Vec<D64> key = PromoteTo(d64, OrderedBits(dk, keys));
+  const Vec<D64> hi = ShiftLeft<32>(Xor(key, Set(d64, flip)));
+  StoreU(Or(hi, Iota(d64, i)), d64, pairs + i);
+}
+
+// Writes 128-bit keys (pairs of u64 lanes): the index followed by the ordered
+// bits of `keys`, inverted if `flip` is all-ones. See above.
+template <class D64, class DK, HWY_IF_LANE_SIZE_D(DK, 8)>
+HWY_INLINE void StoreKeyIndex(D64 d64, uint64_t flip, DK dk, Vec<DK> keys,
+                              size_t i, uint64_t* HWY_RESTRICT pairs) {
+  const Vec<D64> key = BitCast(d64, OrderedBits(dk, keys));
+  StoreInterleaved2(Iota(d64, i), Xor(key, Set(d64, flip)), d64,
+                    pairs + 2 * i);
+}
+
+// Writes the pairs of `keys[i]` and `i` as in StoreKeyIndex.
+template <class D64, typename TK>
+HWY_INLINE void PackKeyIndex(D64 d64, uint64_t flip,
+                             const TK* HWY_RESTRICT keys, size_t i,
+                             uint64_t* HWY_RESTRICT pairs) {
+  const Rebind<TK, D64> dk;
+  StoreKeyIndex(d64, flip, dk, LoadU(dk, keys + i), i, pairs);
+}
+
+// Copies the indices from u64 `pairs` to `indices`.
+template <class D64>
+HWY_INLINE void UnpackIndex(D64 d64, const uint64_t* HWY_RESTRICT pairs,
+                            size_t i, uint32_t* HWY_RESTRICT indices) {
+  const Rebind<uint32_t, D64> du32;
+  StoreU(TruncateTo(du32, LoadU(d64, pairs + i)), du32, indices + i);
+}
+
+// Copies the indices from 128-bit `pairs` to `indices`.
+template <class D64>
+HWY_INLINE void UnpackIndex(D64 d64, const uint64_t* HWY_RESTRICT pairs,
+                            size_t i, uint64_t* HWY_RESTRICT indices) {
+  Vec<D64> index, key;
+  LoadInterleaved2(d64, pairs + 2 * i, index, key);
+  StoreU(index, d64, indices + i);
+}
+
+// Returns the byte offsets of the keys of consecutive records relative to the
+// first, for GatherOffset.
+template <class DI>
+HWY_INLINE Vec<DI> RecordOffsets(DI di, size_t record_bytes) {
+  using TI = TFromD<DI>;
+  HWY_ALIGN TI offsets[HWY_MAX_BYTES / sizeof(TI)];
+  HWY_ASSERT(record_bytes * Lanes(di) <= static_cast<size_t>(LimitsMax<TI>()));
+  for (size_t i = 0; i < Lanes(di); ++i) {
+    offsets[i] = static_cast<TI>(i * record_bytes);
+  }
+  return Load(di, offsets);
+}
+
+// As PackKeyIndex, but gathers the keys of records `i` onwards, which are
+// `record_bytes` apart, given the key of the first record. `offsets` are from
+// RecordOffsets.
+template <class D64, typename TK, class VI>
+HWY_INLINE void PackRecordKeyIndex(D64 d64, uint64_t flip,
+                                   const uint8_t* HWY_RESTRICT first_key,
+                                   size_t record_bytes, VI offsets,
+                                   size_t i, uint64_t* HWY_RESTRICT pairs) {
+  const Rebind<TK, D64> dk;
+  const TK* base = reinterpret_cast<const TK*>(first_key + i * record_bytes);
+  StoreKeyIndex(d64, flip, dk, GatherOffset(dk, base, offsets), i, pairs);
+}
+
+template <class D8>
+HWY_INLINE void CopyRecord(D8 d8, const uint8_t* HWY_RESTRICT from,
+                           uint8_t* HWY_RESTRICT to, size_t record_bytes) {
+  const size_t N = Lanes(d8);
+  size_t i = 0;
+  if (record_bytes >= N) {
+    for (; i <= record_bytes - N; i += N) {
+      StoreU(LoadU(d8, from + i), d8, to + i);
+    }
+  }
+  SafeCopyN(record_bytes - i, d8, from + i, to + i);
+}
+
+// Copies the records to `sorted` in the order of the indices in `pairs`, which
+// are the lower halves of u64 if kLanesPerPair is 1, otherwise the first of
+// two lanes. The source records are random accesses, hence prefetch them a
+// few records ahead of the copy.
+template <size_t kLanesPerPair>
+HWY_NOINLINE void PermuteRecords(const uint64_t* HWY_RESTRICT pairs,
+                                 const uint8_t* HWY_RESTRICT records,
+                                 size_t num, size_t record_bytes,
+                                 uint8_t* HWY_RESTRICT sorted) {
+  const ScalableTag<uint8_t> d8;
+  constexpr size_t kPrefetchDistance = 8;
+  const auto record = [&](size_t i) {
+    const uint64_t pair = pairs[i * kLanesPerPair];
+    const size_t index = static_cast<size_t>(
+        kLanesPerPair == 1 ? (pair & 0xFFFFFFFFu) : pair);
+    return records + index * record_bytes;
+  };
+  for (size_t i = 0; i < num; ++i) {
+    if (i + kPrefetchDistance < num) {
+      const uint8_t* next = record(i + kPrefetchDistance);
+      hwy::Prefetch(next);
+      hwy::Prefetch(next + record_bytes - 1);
+    }
+    CopyRecord(d8, record(i), sorted + i * record_bytes, record_bytes);
+  }
+}
+
+// Copies K32V32 `keys[i]` to `copy` and writes their key (inverted if `flip`
+// is all-ones) and `i` to `pairs` as in PackKeyIndex.
+template <class D64>
+HWY_INLINE void PackKV64(D64 d64, uint64_t flip,
+                         const uint64_t* HWY_RESTRICT keys, size_t i,
+                         uint64_t* HWY_RESTRICT pairs,
+                         uint64_t* HWY_RESTRICT copy) {
+  const Vec<D64> kv = LoadU(d64, keys + i);
+  StoreU(kv, d64, copy + i);
+  const Vec<D64> hi = ShiftLeft<32>(Xor(ShiftRight<32>(kv), Set(d64, flip)));
+  StoreU(Or(hi, Iota(d64, i)), d64, pairs + i);
+}
+
+// Writes to `keys[i]` the K32V32 from `copy` whose index is in `pairs[i]`.
+template <class D64>
+HWY_INLINE void UnpackKV64(D64 d64, const uint64_t* HWY_RESTRICT pairs,
+                           const uint64_t* HWY_RESTRICT copy, size_t i,
+                           uint64_t* HWY_RESTRICT keys) {
+  const RebindToSigned<D64> di;
+  const Vec<D64> index = And(LoadU(d64, pairs + i), Set(d64, 0xFFFFFFFFull));
+  StoreU(GatherIndex(d64, copy, BitCast(di, index)), d64, keys + i);
+}
+
+// Copies the values of K64V64 `keys[i]` to `values` and writes their key
+// (inverted if `flip` is all-ones) and `i` to `pairs` as in PackKeyIndex.
+template <class D64>
+HWY_INLINE void PackKV128(D64 d64, uint64_t flip,
+                          const uint64_t* HWY_RESTRICT keys, size_t i,
+                          uint64_t* HWY_RESTRICT pairs,
+                          uint64_t* HWY_RESTRICT values) {
+  Vec<D64> value, key;
+  LoadInterleaved2(d64, keys + 2 * i, value, key);
+  StoreU(value, d64, values + i);
+  StoreInterleaved2(Iota(d64, i), Xor(key, Set(d64, flip)), d64,
+                    pairs + 2 * i);
+}
+
+// Writes to `keys[i]` the key from `pairs[i]` and the value it was paired
+// with, which is gathered from `values`.
+template <class D64>
+HWY_INLINE void UnpackKV128(D64 d64, uint64_t flip,
+                            const uint64_t* HWY_RESTRICT pairs,
+                            const uint64_t* HWY_RESTRICT values, size_t i,
+                            uint64_t* HWY_RESTRICT keys) {
+  const RebindToSigned<D64> di;
+  Vec<D64> index, key;
+  LoadInterleaved2(d64, pairs + 2 * i, index, key);
+  const Vec<D64> value = GatherIndex(d64, values, BitCast(di, index));
+  StoreInterleaved2(value, Xor(key, Set(d64, flip)), d64, keys + 2 * i);
+}
+
+#if VQSORT_ENABLED || HWY_IDE
+
+// ------------------------------ MergeVectors
+
+// Requires `num_a` and `num_b` to be at least Lanes(d), which must not exceed
+// 16 keys. Repeatedly merges a vector of the input whose next key is ordered
+// first with the second half of the previous merge. All keys not yet loaded
+// are thus not ordered before any we store. Finally merges the remaining keys
+// (the second half, fewer than Lanes(d) of one input and the rest of the
+// other) with MergeGallop.
+template <class D, class Traits, typename T>
+void MergeVectors(D d, Traits st, const T* HWY_RESTRICT a, size_t num_a,
+                  const T* HWY_RESTRICT b, size_t num_b, T* HWY_RESTRICT out) {
+  using V = Vec<D>;
+  const size_t N = Lanes(d);
+  HWY_DASSERT(num_a >= N && num_b >= N);
+
+  V v0 = LoadU(d, a);
+  V v1 = LoadU(d, b);
+  a += N;
+  num_a -= N;
+  b += N;
+  num_b -= N;
+  for (;;) {
+    MergeSortedVectors(d, st, v0, v1);
+    StoreU(v0, d, out);
+    out += N;
+    if (num_a < N || num_b < N) break;
+
+    if (st.Compare1(b, a)) {
+      v0 = LoadU(d, b);
+      b += N;
+      num_b -= N;
+    } else {
+      v0 = LoadU(d, a);
+      a += N;
+      num_a -= N;
+    }
+  }
+
+  // Second half of the last merge, then its merge with the shorter input.
+  HWY_ALIGN T buf[3 * Constants::kMaxCols];
+  T* HWY_RESTRICT merged = buf + Constants::kMaxCols;
+  StoreU(v1, d, buf);
+  if (num_a < N) {
+    MergeGallop(st, a, num_a, buf, N, merged);
+    MergeGallop(st, merged, N + num_a, b, num_b, out);
+  } else {
+    MergeGallop(st, b, num_b, buf, N, merged);
+    MergeGallop(st, merged, N + num_b, a, num_a, out);
+  }
+}
+
 #endif  // VQSORT_ENABLED
 }  // namespace detail
 
@@ -1434,9 +1967,10 @@ HWY_INLINE bool HandleSpecialCases(D d, Traits st, T* HWY_RESTRICT keys,
 // `d` is typically SortTag<T> (chooses between full and partial vectors).
 // `st` is SharedTraits<Traits*<Order*>>. This abstraction layer bridges
 //   differences in sort order and single-lane vs 128-bit keys.
+// `stats`: if non-null, SortStats are added to it.
 template <class D, class Traits, typename T>
 void Sort(D d, Traits st, T* HWY_RESTRICT keys, size_t num,
-          T* HWY_RESTRICT buf) {
+          T* HWY_RESTRICT buf, SortStats* stats = nullptr) {
   if (VQSORT_PRINT >= 1) {
     fprintf(stderr, "=============== Sort num %zu\n", num);
   }
@@ -1452,12 +1986,12 @@ void Sort(D d, Traits st, T* HWY_RESTRICT keys, size_t num,
   buf = storage;
 #endif  // !HWY_HAVE_SCALABLE
 
-  if (detail::HandleSpecialCases(d, st, keys, num)) return;
+  if (detail::HandleSpecialCases(d, st, keys, num, stats)) return;
 
 #if HWY_MAX_BYTES > 64
   // sorting_networks-inl and traits assume no more than 512 bit vectors.
   if (HWY_UNLIKELY(Lanes(d) > 64 / sizeof(T))) {
-    return Sort(CappedTag<T, 64 / sizeof(T)>(), st, keys, num, buf);
+    return Sort(CappedTag<T, 64 / sizeof(T)>(), st, keys, num, buf, stats);
   }
 #endif  // HWY_MAX_BYTES > 64
 
@@ -1465,7 +1999,110 @@ void Sort(D d, Traits st, T* HWY_RESTRICT keys, size_t num,
 
   // Introspection: switch to worst-case N*logN heapsort after this many.
   const size_t max_levels = 2 * hwy::CeilLog2(num) + 4;
+  if (HWY_UNLIKELY(stats != nullptr)) {
+    detail::StatsRecorder recorder(stats, max_levels);
+    detail::Recurse(d, st, keys, keys + num, num, buf, rng, max_levels,
+                    &recorder);
+    return;
+  }
   detail::Recurse(d, st, keys, keys + num, num, buf, rng, max_levels);
+#else
+  (void)d;
+  (void)buf;
+  if (VQSORT_PRINT >= 1) {
+    fprintf(stderr, "WARNING: using slow HeapSort because vqsort disabled\n");
+  }
+  if (stats) stats->heap_sorts += 1;
+  return detail::HeapSort(st, keys, num);
+#endif  // VQSORT_ENABLED
+}
+
+// Sorts each of the `num_segments` segments `keys[offsets[i], offsets[i + 1])`
+// independently. `offsets` has `num_segments + 1` non-decreasing entries in
+// units of keys, not lanes. Intended for many small segments: those of up to
+// Constants::BaseCaseNum lanes are sorted directly by the sorting network of
+// BaseCase, which avoids the per-call overhead of Sort.
+template <class D, class Traits, typename T>
+void SortSegments(D d, Traits st, T* HWY_RESTRICT keys, const size_t* offsets,
+                  size_t num_segments, T* HWY_RESTRICT buf) {
+  constexpr size_t N1 = st.LanesPerKey();
+
+#if VQSORT_ENABLED || HWY_IDE
+#if !HWY_HAVE_SCALABLE
+  // As in Sort.
+  HWY_ALIGN T storage[SortConstants::BufNum<T>(HWY_LANES(T))] = {};
+  buf = storage;
+#endif  // !HWY_HAVE_SCALABLE
+
+#if HWY_MAX_BYTES > 64
+  // sorting_networks-inl and traits assume no more than 512 bit vectors.
+  if (HWY_UNLIKELY(Lanes(d) > 64 / sizeof(T))) {
+    return SortSegments(CappedTag<T, 64 / sizeof(T)>(), st, keys, offsets,
+                        num_segments, buf);
+  }
+#endif  // HWY_MAX_BYTES > 64
+
+  const size_t base_case_num = detail::Constants::BaseCaseNum(Lanes(d));
+  for (size_t i = 0; i < num_segments; ++i) {
+    HWY_DASSERT(offsets[i] <= offsets[i + 1]);
+    T* HWY_RESTRICT begin = keys + offsets[i] * N1;
+    const size_t num = (offsets[i + 1] - offsets[i]) * N1;
+    if (num <= base_case_num) {
+      // Passing the end of the segment prevents BaseCase from also sorting
+      // keys of the next segment.
+      detail::BaseCase(d, st, begin, begin + num, num, buf);
+    } else {
+      Sort(d, st, begin, num, buf);
+    }
+  }
+#else
+  (void)d;
+  (void)buf;
+  for (size_t i = 0; i < num_segments; ++i) {
+    detail::HeapSort(st, keys + offsets[i] * N1,
+                     (offsets[i + 1] - offsets[i]) * N1);
+  }
+#endif  // VQSORT_ENABLED
+}
+
+// Rearranges `keys[0..num-1]` such that `keys[0..k-1]` are the same as after
+// Sort, i.e. the first `k` keys in sort order, whereas the order of the others
+// is unspecified. `num` and `k` are in units of lanes, hence `k` must be a
+// multiple of `st.LanesPerKey()`; values of `k` above `num` are clamped. Only
+// partitions the subarrays after `k` once, hence much faster than Sort if `k`
+// is small relative to `num`.
+template <class D, class Traits, typename T>
+void PartialSort(D d, Traits st, T* HWY_RESTRICT keys, size_t num, size_t k,
+                 T* HWY_RESTRICT buf) {
+  if (VQSORT_PRINT >= 1) {
+    fprintf(stderr, "=============== PartialSort num %zu k %zu\n", num, k);
+  }
+  k = HWY_MIN(k, num);
+  if (k == 0) return;
+
+#if VQSORT_ENABLED || HWY_IDE
+#if !HWY_HAVE_SCALABLE
+  // See Sort.
+  HWY_ALIGN T storage[SortConstants::BufNum<T>(HWY_LANES(T))] = {};
+  static_assert(sizeof(storage) <= 8192, "Unexpectedly large, check size");
+  buf = storage;
+#endif  // !HWY_HAVE_SCALABLE
+
+  if (detail::HandleSpecialCases(d, st, keys, num)) return;
+
+#if HWY_MAX_BYTES > 64
+  // sorting_networks-inl and traits assume no more than 512 bit vectors.
+  if (HWY_UNLIKELY(Lanes(d) > 64 / sizeof(T))) {
+    return PartialSort(CappedTag<T, 64 / sizeof(T)>(), st, keys, num, k, buf);
+  }
+#endif  // HWY_MAX_BYTES > 64
+
+  detail::Generator rng(keys, num);
+
+  // Introspection: switch to worst-case N*logN heapsort after this many.
+  const size_t max_levels = 2 * hwy::CeilLog2(num) + 4;
+  detail::RecursePartial(d, st, keys, keys + num, num, k, buf, rng,
+                         max_levels);
 #else
   (void)d;
   (void)buf;
@@ -1476,6 +2113,329 @@ void Sort(D d, Traits st, T* HWY_RESTRICT keys, size_t num,
 #endif  // VQSORT_ENABLED
 }
 
+// Rearranges `keys[0..num-1]` like std::nth_element: the key starting at lane
+// `k` is the one that would be there after Sort, no key before it is ordered
+// after it, and no key after it is ordered before it. `num` and `k` are in
+// units of lanes, hence `k` must be a multiple of `st.LanesPerKey()`; does
+// nothing if `k >= num`. Expected O(num) time because only the side of each
+// partition that contains `k` is visited, with the same N*logN worst case as
+// Sort.
+template <class D, class Traits, typename T>
+void Select(D d, Traits st, T* HWY_RESTRICT keys, size_t num, size_t k,
+            T* HWY_RESTRICT buf) {
+  if (VQSORT_PRINT >= 1) {
+    fprintf(stderr, "=============== Select num %zu k %zu\n", num, k);
+  }
+  if (k >= num) return;
+
+#if VQSORT_ENABLED || HWY_IDE
+#if !HWY_HAVE_SCALABLE
+  // See Sort.
+  HWY_ALIGN T storage[SortConstants::BufNum<T>(HWY_LANES(T))] = {};
+  static_assert(sizeof(storage) <= 8192, "Unexpectedly large, check size");
+  buf = storage;
+#endif  // !HWY_HAVE_SCALABLE
+
+  if (detail::HandleSpecialCases(d, st, keys, num)) return;
+
+#if HWY_MAX_BYTES > 64
+  // sorting_networks-inl and traits assume no more than 512 bit vectors.
+  if (HWY_UNLIKELY(Lanes(d) > 64 / sizeof(T))) {
+    return Select(CappedTag<T, 64 / sizeof(T)>(), st, keys, num, k, buf);
+  }
+#endif  // HWY_MAX_BYTES > 64
+
+  detail::Generator rng(keys, num);
+
+  // Introspection: switch to worst-case N*logN heapsort after this many.
+  const size_t max_levels = 2 * hwy::CeilLog2(num) + 4;
+  detail::RecurseSelect(d, st, keys, keys + num, num, k, buf, rng, max_levels);
+#else
+  (void)d;
+  (void)buf;
+  if (VQSORT_PRINT >= 1) {
+    fprintf(stderr, "WARNING: using slow HeapSort because vqsort disabled\n");
+  }
+  return detail::HeapSort(st, keys, num);
+#endif  // VQSORT_ENABLED
+}
+
+// Merges `a[0..num_a-1]` and `b[0..num_b-1]`, both sorted in the order defined
+// by `st`, into `out[0..num_a+num_b-1]`, which must not overlap them. Counts
+// are in units of lanes. Uses bitonic merging networks on pairs of vectors.
+// The order of equal keys is unspecified. Does not allocate memory.
+template <class D, class Traits, typename T>
+void Merge(D d, Traits st, const T* HWY_RESTRICT a, size_t num_a,
+           const T* HWY_RESTRICT b, size_t num_b, T* HWY_RESTRICT out) {
+  (void)d;
+#if VQSORT_ENABLED || HWY_IDE
+  // MergeSortedVectors supports up to 16 keys.
+  const CappedTag<T, SortConstants::kMaxCols> dm;
+  if (num_a >= Lanes(dm) && num_b >= Lanes(dm)) {
+    return detail::MergeVectors(dm, st, a, num_a, b, num_b, out);
+  }
+#endif  // VQSORT_ENABLED
+
+  // At least one input is short, or vqsort is disabled.
+  if (num_a < num_b) {
+    detail::MergeGallop(st, a, num_a, b, num_b, out);
+  } else {
+    detail::MergeGallop(st, b, num_b, a, num_a, out);
+  }
+}
+
+// Merges the `num_runs` sorted `runs[i][0..run_keys[i]-1]` (note: in units of
+// keys, not lanes) into `out`, which must not overlap them, by merging pairs
+// of runs in CeilLog2(num_runs) passes. If there are more than two runs, the
+// passes alternate between `out` and `scratch`, which must then have room for
+// as many lanes as `out`. If `scratch` is null, allocates that much memory.
+template <class D, class Traits, typename T>
+void MergeRuns(D d, Traits st, const T* const* runs, const size_t* run_keys,
+               size_t num_runs, T* HWY_RESTRICT out,
+               T* HWY_RESTRICT scratch = nullptr) {
+  constexpr size_t N1 = st.LanesPerKey();
+  if (num_runs == 0) return;
+  if (num_runs == 1) {
+    memcpy(out, runs[0], run_keys[0] * N1 * sizeof(T));
+    return;
+  }
+
+  size_t total = 0;
+  for (size_t i = 0; i < num_runs; ++i) {
+    total += run_keys[i] * N1;
+  }
+  // Ping-pong between `out` and `scratch`, starting such that the last pass
+  // writes to `out`.
+  const size_t passes = hwy::CeilLog2(num_runs);
+  AlignedFreeUniquePtr<T[]> storage;
+  if (passes > 1 && scratch == nullptr) {
+    storage = hwy::AllocateAligned<T>(total);
+    HWY_ASSERT(storage);
+    scratch = storage.get();
+  }
+  T* HWY_RESTRICT dst = (passes & 1) ? out : scratch;
+
+  // Number of lanes in runs[begin, end), or fewer if end exceeds num_runs.
+  const auto run_lanes = [run_keys, num_runs](size_t begin, size_t end) {
+    size_t lanes = 0;
+    for (size_t i = begin; i < HWY_MIN(end, num_runs); ++i) {
+      lanes += run_keys[i] * N1;
+    }
+    return lanes;
+  };
+
+  // Each pass merges pairs of groups of `group` consecutive runs, which are
+  // contiguous in `src` after the first pass. Recomputing their sizes is cheap
+  // relative to merging, and avoids allocating.
+  const T* HWY_RESTRICT src = nullptr;
+  for (size_t group = 1; group < num_runs; group *= 2) {
+    size_t pos = 0;
+    for (size_t i = 0; i < num_runs; i += 2 * group) {
+      const size_t num0 = run_lanes(i, i + group);
+      const size_t num1 = run_lanes(i + group, i + 2 * group);
+      const T* HWY_RESTRICT in0 = (group == 1) ? runs[i] : src + pos;
+      if (i + group >= num_runs) {
+        memcpy(dst + pos, in0, num0 * sizeof(T));
+      } else {
+        const T* HWY_RESTRICT in1 = (group == 1) ? runs[i + 1] : in0 + num0;
+        Merge(d, st, in0, num0, in1, num1, dst + pos);
+      }
+      pos += num0 + num1;
+    }
+    src = dst;
+    dst = (dst == out) ? scratch : out;
+  }
+  HWY_DASSERT(src == out);
+}
+
+// Writes to `indices[0..num-1]` the permutation that sorts `keys[0..num-1]`
+// in the given order; `keys` are not modified. Indices of equal keys are in
+// ascending order, i.e. the sort is stable. This sorts unique combinations of
+// key and index: u64 for 32-bit keys and indices, in which case `st` must be
+// SharedTraits of TraitsLane<OrderAscending<uint64_t>>, or 128-bit for 64-bit
+// keys and indices, with SharedTraits of Traits128<OrderAscending128>.
+// Allocates O(num) memory.
+template <class Order, class Traits, typename TK, typename TI>
+void Argsort(Order, Traits st, const TK* HWY_RESTRICT keys, size_t num,
+             TI* HWY_RESTRICT indices, uint64_t* HWY_RESTRICT buf) {
+  static_assert(sizeof(TK) == sizeof(TI), "Index must be as wide as the key");
+  static_assert(sizeof(TK) * 2 == sizeof(uint64_t) * st.LanesPerKey(),
+                "Traits must match the size of key plus index");
+  HWY_ASSERT(num <= static_cast<size_t>(LimitsMax<TI>()));
+
+  const size_t num_lanes = num * st.LanesPerKey();
+  auto pairs = hwy::AllocateAligned<uint64_t>(HWY_MAX(num_lanes, size_t{1}));
+  HWY_ASSERT(pairs);
+
+  const uint64_t flip = Order().IsAscending() ? 0 : ~uint64_t{0};
+  const SortTag<uint64_t> d64;
+  const CappedTag<uint64_t, 1> d1;
+  const size_t N = Lanes(d64);
+  size_t i = 0;
+  if (num >= N) {
+    for (; i <= num - N; i += N) {
+      detail::PackKeyIndex(d64, flip, keys, i, pairs.get());
+    }
+  }
+  for (; i < num; ++i) {
+    detail::PackKeyIndex(d1, flip, keys, i, pairs.get());
+  }
+
+  Sort(d64, st, pairs.get(), num_lanes, buf);
+
+  i = 0;
+  if (num >= N) {
+    for (; i <= num - N; i += N) {
+      detail::UnpackIndex(d64, pairs.get(), i, indices);
+    }
+  }
+  for (; i < num; ++i) {
+    detail::UnpackIndex(d1, pairs.get(), i, indices);
+  }
+}
+
+// Sorts `num` records of `record_bytes` each by their key of type TK, whose
+// address in the first record is `first_key` (the same offset in each).
+// Stable. Gathers the keys into unique combinations of key and index (see
+// Argsort, which also defines the requirements for `st`), sorts them and then
+// copies the records to a temporary array in that order. Allocates
+// O(num * record_bytes) memory.
+template <class Order, class Traits, typename TK>
+void SortRecords(Order, Traits st, uint8_t* HWY_RESTRICT records, size_t num,
+                 size_t record_bytes, const TK* first_key_ptr,
+                 uint64_t* HWY_RESTRICT buf) {
+  constexpr size_t kLanesPerPair = st.LanesPerKey();
+  static_assert(sizeof(TK) * 2 == sizeof(uint64_t) * kLanesPerPair,
+                "Traits must match the size of key plus index");
+  const uint8_t* HWY_RESTRICT first_key =
+      reinterpret_cast<const uint8_t*>(first_key_ptr);
+  HWY_ASSERT(records <= first_key &&
+             first_key + sizeof(TK) <= records + record_bytes);
+  HWY_ASSERT(sizeof(TK) == 8 || num <= LimitsMax<uint32_t>());
+  if (num < 2) return;
+
+  const size_t num_lanes = num * kLanesPerPair;
+  // After the pairs: space for the sorted records.
+  auto storage = hwy::AllocateAligned<uint64_t>(
+      num_lanes + DivCeil(num * record_bytes, sizeof(uint64_t)));
+  HWY_ASSERT(storage);
+  uint64_t* HWY_RESTRICT pairs = storage.get();
+  uint8_t* HWY_RESTRICT sorted =
+      reinterpret_cast<uint8_t*>(storage.get() + num_lanes);
+
+  const uint64_t flip = Order().IsAscending() ? 0 : ~uint64_t{0};
+  const SortTag<uint64_t> d64;
+  const CappedTag<uint64_t, 1> d1;
+  const RebindToSigned<Rebind<TK, decltype(d64)>> di;
+  const Vec<decltype(di)> offsets = detail::RecordOffsets(di, record_bytes);
+  const size_t N = Lanes(d64);
+  size_t i = 0;
+  if (num >= N) {
+    for (; i <= num - N; i += N) {
+      detail::PackRecordKeyIndex<decltype(d64), TK>(
+          d64, flip, first_key, record_bytes, offsets, i, pairs);
+    }
+  }
+  // Remainder: single keys do not require a gather.
+  const Rebind<TK, decltype(d1)> dk1;
+  for (; i < num; ++i) {
+    const TK* key = reinterpret_cast<const TK*>(first_key + i * record_bytes);
+    detail::StoreKeyIndex(d1, flip, dk1, LoadU(dk1, key), i, pairs);
+  }
+
+  Sort(d64, st, pairs, num_lanes, buf);
+
+  detail::PermuteRecords<kLanesPerPair>(pairs, records, num, record_bytes,
+                                        sorted);
+  memcpy(records, sorted, num * record_bytes);
+}
+
+// Same as Sort for K32V32 `keys` (u64 lanes with the key in the upper half),
+// but stable: pairs with equal keys keep their relative order. Sorts unique
+// u64 combinations of the key and index, hence `st` must be SharedTraits of
+// TraitsLane<OrderAscending<uint64_t>>, then gathers the pairs in that order.
+// Allocates O(num) memory.
+template <class Order, class Traits>
+void StableSortKV64(Order, Traits st, uint64_t* HWY_RESTRICT keys, size_t num,
+                    uint64_t* HWY_RESTRICT buf) {
+  HWY_ASSERT(num <= static_cast<size_t>(LimitsMax<uint32_t>()));
+  if (num < 2) return;
+
+  // Second half: copy of the input for gathering.
+  auto pairs = hwy::AllocateAligned<uint64_t>(2 * num);
+  HWY_ASSERT(pairs);
+  uint64_t* HWY_RESTRICT copy = pairs.get() + num;
+
+  const uint64_t flip = Order().IsAscending() ? 0 : ~uint64_t{0};
+  const SortTag<uint64_t> d64;
+  const CappedTag<uint64_t, 1> d1;
+  const size_t N = Lanes(d64);
+  size_t i = 0;
+  if (num >= N) {
+    for (; i <= num - N; i += N) {
+      detail::PackKV64(d64, flip, keys, i, pairs.get(), copy);
+    }
+  }
+  for (; i < num; ++i) {
+    detail::PackKV64(d1, flip, keys, i, pairs.get(), copy);
+  }
+
+  Sort(d64, st, pairs.get(), num, buf);
+
+  i = 0;
+  if (num >= N) {
+    for (; i <= num - N; i += N) {
+      detail::UnpackKV64(d64, pairs.get(), copy, i, keys);
+    }
+  }
+  for (; i < num; ++i) {
+    detail::UnpackKV64(d1, pairs.get(), copy, i, keys);
+  }
+}
+
+// Same as Sort for K64V64 `keys` (`num_lanes` u64, i.e. pairs of value and
+// key), but stable: pairs with equal keys keep their relative order. Sorts
+// unique 128-bit combinations of key and index, hence `st` must be
+// SharedTraits of Traits128<OrderAscending128>, then gathers the values in
+// that order. Allocates O(num_lanes) memory.
+template <class Order, class Traits>
+void StableSortKV128(Order, Traits st, uint64_t* HWY_RESTRICT keys,
+                     size_t num_lanes, uint64_t* HWY_RESTRICT buf) {
+  const size_t num = num_lanes / 2;
+  if (num < 2) return;
+
+  // After the 128-bit pairs: copy of the values for gathering.
+  auto pairs = hwy::AllocateAligned<uint64_t>(3 * num);
+  HWY_ASSERT(pairs);
+  uint64_t* HWY_RESTRICT values = pairs.get() + 2 * num;
+
+  const uint64_t flip = Order().IsAscending() ? 0 : ~uint64_t{0};
+  const SortTag<uint64_t> d64;
+  const CappedTag<uint64_t, 1> d1;
+  const size_t N = Lanes(d64);
+  size_t i = 0;
+  if (num >= N) {
+    for (; i <= num - N; i += N) {
+      detail::PackKV128(d64, flip, keys, i, pairs.get(), values);
+    }
+  }
+  for (; i < num; ++i) {
+    detail::PackKV128(d1, flip, keys, i, pairs.get(), values);
+  }
+
+  Sort(d64, st, pairs.get(), 2 * num, buf);
+
+  i = 0;
+  if (num >= N) {
+    for (; i <= num - N; i += N) {
+      detail::UnpackKV128(d64, flip, pairs.get(), values, i, keys);
+    }
+  }
+  for (; i < num; ++i) {
+    detail::UnpackKV128(d1, flip, pairs.get(), values, i, keys);
+  }
+}
+
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
 }  // namespace hwy
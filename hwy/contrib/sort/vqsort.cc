@@ -34,9 +34,7 @@
 #endif
 #endif  // VQSORT_STACK
 
-#if !VQSORT_STACK
-#include "hwy/aligned_allocator.h"
-#endif
+#include "hwy/aligned_allocator.h"  // HWY_ALIGNMENT
 
 // Check if we have sys/random.h. First skip some systems on which the check
 // itself (features.h) might be problematic.
@@ -118,30 +116,49 @@ HWY_EXPORT(HaveFloat64);
 
 }  // namespace
 
-Sorter::Sorter() {
+size_t Sorter::ScratchBytes() {
+  // The counting sort of 16-bit keys reuses the same memory.
+  const size_t counts_bytes = RadixConstants::kNumCounts16 * sizeof(uint32_t);
 #if VQSORT_STACK
-  ptr_ = nullptr;  // Sort will use stack storage instead
+  return counts_bytes;  // Sort will use stack storage instead
 #else
   // Determine the largest buffer size required for any type by trying them all.
   // (The capping of N in BaseCaseNum means that smaller N but larger sizeof_t
   // may require a larger buffer.)
   const size_t vector_size = HWY_DYNAMIC_DISPATCH(VectorSize)();
-  const size_t max_bytes =
+  return HWY_MAX(
+      counts_bytes,
       HWY_MAX(HWY_MAX(SortConstants::BufBytes<uint16_t>(vector_size),
                       SortConstants::BufBytes<uint32_t>(vector_size)),
-              SortConstants::BufBytes<uint64_t>(vector_size));
+              SortConstants::BufBytes<uint64_t>(vector_size)));
+#endif
+}
+
+Sorter::Sorter() {
+  const size_t max_bytes = ScratchBytes();
   ptr_ = hwy::AllocateAlignedBytes(max_bytes, nullptr, nullptr);
+  HWY_ASSERT(ptr_ != nullptr);
 
   // Prevent msan errors by initializing.
   memset(ptr_, 0, max_bytes);
-#endif
+}
+
+Sorter::Sorter(void* scratch, size_t scratch_bytes) {
+  HWY_ASSERT(scratch_bytes >= ScratchBytes());
+  HWY_ASSERT(scratch != nullptr);
+  HWY_ASSERT(reinterpret_cast<uintptr_t>(scratch) % HWY_ALIGNMENT == 0);
+  ptr_ = scratch;
+  owned_ = false;
+}
+
+const Sorter& Sorter::ThreadLocal() {
+  static thread_local Sorter sorter;
+  return sorter;
 }
 
 void Sorter::Delete() {
-#if !VQSORT_STACK
-  FreeAlignedBytes(ptr_, nullptr, nullptr);
+  if (owned_) FreeAlignedBytes(ptr_, nullptr, nullptr);
   ptr_ = nullptr;
-#endif
 }
 
 #if !VQSORT_SECURE_RNG
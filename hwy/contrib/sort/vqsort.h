@@ -28,6 +28,8 @@
 
 namespace hwy {
 
+class ThreadPool;  // See hwy/contrib/thread_pool/thread_pool.h.
+
 // Tag arguments that determine the sort order.
 struct SortAscending {
   constexpr bool IsAscending() const { return true; }
@@ -36,11 +38,52 @@ struct SortDescending {
   constexpr bool IsAscending() const { return false; }
 };
 
-// Allocates O(1) space. Type-erased RAII wrapper over hwy/aligned_allocator.h.
-// This allows amortizing the allocation over multiple sorts.
+// Counters that describe how the Sort function template in vqsort-inl.h handled
+// its input, e.g. to export as metrics when a sort is unexpectedly slow. Sort
+// adds to them if given a non-null pointer, hence one instance can accumulate
+// statistics over multiple sorts.
+struct SortStats {
+  // Number of Partition calls, i.e. quicksort recursions that moved keys.
+  size_t partitions = 0;
+  // Deepest recursion level reached; 0 if the input was handled by BaseCase
+  // or a special case.
+  size_t max_depth = 0;
+  // Total bytes of the subarrays passed to Partition and BaseCase. Each of
+  // their keys is loaded and stored about once, hence this approximates the
+  // memory traffic.
+  size_t bytes_moved = 0;
+  // Number of subarrays sorted by the sorting network in BaseCase.
+  size_t base_cases = 0;
+
+  // Fallbacks and special cases:
+  // HeapSort because the recursion was too deep, vectors are unsuitable or
+  // vqsort is disabled for this target.
+  size_t heap_sorts = 0;
+  // Subarrays with only two distinct keys, partitioned in a single pass.
+  size_t two_value_partitions = 0;
+  // Subarrays whose samples were all equal, which requires an extra scan.
+  size_t equal_samples = 0;
+  // Inputs that were already sorted or reversed.
+  size_t presorted = 0;
+};
+
+// Allocates O(1) space (ScratchBytes). Type-erased RAII wrapper over
+// hwy/aligned_allocator.h. This allows amortizing the allocation over multiple
+// sorts.
+//
+// Most member functions then use only this memory and the stack: the
+// single-threaded operator(), PartialSort, Select, SortSegments, Merge of two
+// arrays and Merge of runs with caller-owned scratch. The exception is
+// operator() of at least 256 32-bit keys on targets where vqsort is disabled
+// (VQSORT_ENABLED is 0, e.g. HWY_SCALAR), which allocates O(n) for a radix
+// sort. Argsort, SortRecords, StableSort, the ThreadPool overloads and Merge
+// of more than two runs without scratch allocate on every call.
 class HWY_CONTRIB_DLLEXPORT Sorter {
  public:
   Sorter();
+  // Does not allocate: uses caller-owned `scratch`, which must be aligned to
+  // HWY_ALIGNMENT, hold at least ScratchBytes() and outlive this Sorter.
+  Sorter(void* scratch, size_t scratch_bytes);
   ~Sorter() { Delete(); }
 
   // Move-only
@@ -49,17 +92,33 @@ class HWY_CONTRIB_DLLEXPORT Sorter {
   Sorter(Sorter&& other) {
     Delete();
     ptr_ = other.ptr_;
+    owned_ = other.owned_;
     other.ptr_ = nullptr;
   }
   Sorter& operator=(Sorter&& other) {
     Delete();
     ptr_ = other.ptr_;
+    owned_ = other.owned_;
     other.ptr_ = nullptr;
     return *this;
   }
 
+  // Returns the number of bytes of scratch memory required by the above
+  // constructor for the best available instruction set. The same memory serves
+  // all key types (including the wider pairs used internally by Argsort and
+  // StableSort), hence this is the maximum over all of them. At least 256 KiB
+  // for the table of the counting sort that large inputs of 16-bit keys use.
+  static size_t ScratchBytes();
+
+  // Returns a Sorter for the calling thread, which is created on first use and
+  // then reused by subsequent calls from the same thread. This avoids the
+  // allocation in Sorter() on the hot path without having to pass a Sorter
+  // around.
+  static const Sorter& ThreadLocal();
+
   // Sorts keys[0, n). Dispatches to the best available instruction set,
-  // and does not allocate memory.
+  // and does not allocate memory (except as noted above for 32-bit keys if
+  // vqsort is disabled).
   void operator()(uint16_t* HWY_RESTRICT keys, size_t n, SortAscending) const;
   void operator()(uint16_t* HWY_RESTRICT keys, size_t n, SortDescending) const;
   void operator()(uint32_t* HWY_RESTRICT keys, size_t n, SortAscending) const;
@@ -79,6 +138,16 @@ class HWY_CONTRIB_DLLEXPORT Sorter {
   void operator()(double* HWY_RESTRICT keys, size_t n, SortAscending) const;
   void operator()(double* HWY_RESTRICT keys, size_t n, SortDescending) const;
 
+  // Orders NaN by their sign bit, i.e. before -inf or after +inf, and -0
+  // before +0, because these types have no comparison operators.
+  void operator()(float16_t* HWY_RESTRICT keys, size_t n, SortAscending) const;
+  void operator()(float16_t* HWY_RESTRICT keys, size_t n,
+                  SortDescending) const;
+  void operator()(bfloat16_t* HWY_RESTRICT keys, size_t n,
+                  SortAscending) const;
+  void operator()(bfloat16_t* HWY_RESTRICT keys, size_t n,
+                  SortDescending) const;
+
   void operator()(uint128_t* HWY_RESTRICT keys, size_t n, SortAscending) const;
   void operator()(uint128_t* HWY_RESTRICT keys, size_t n, SortDescending) const;
 
@@ -88,6 +157,509 @@ class HWY_CONTRIB_DLLEXPORT Sorter {
   void operator()(K32V32* HWY_RESTRICT keys, size_t n, SortAscending) const;
   void operator()(K32V32* HWY_RESTRICT keys, size_t n, SortDescending) const;
 
+  // Same as above, but uses the threads of `pool`, including the caller's.
+  // Parallelism only pays off for large inputs (millions of keys). The pool's
+  // workers are reused for all recursion levels, and also across calls if the
+  // caller keeps the pool alive. Allocates O(pool.NumThreads()) memory. Must
+  // not be called concurrently with other uses of `pool`.
+  void operator()(uint16_t* HWY_RESTRICT keys, size_t n, SortAscending,
+                  ThreadPool& pool) const;
+  void operator()(uint16_t* HWY_RESTRICT keys, size_t n, SortDescending,
+                  ThreadPool& pool) const;
+  void operator()(uint32_t* HWY_RESTRICT keys, size_t n, SortAscending,
+                  ThreadPool& pool) const;
+  void operator()(uint32_t* HWY_RESTRICT keys, size_t n, SortDescending,
+                  ThreadPool& pool) const;
+  void operator()(uint64_t* HWY_RESTRICT keys, size_t n, SortAscending,
+                  ThreadPool& pool) const;
+  void operator()(uint64_t* HWY_RESTRICT keys, size_t n, SortDescending,
+                  ThreadPool& pool) const;
+
+  void operator()(int16_t* HWY_RESTRICT keys, size_t n, SortAscending,
+                  ThreadPool& pool) const;
+  void operator()(int16_t* HWY_RESTRICT keys, size_t n, SortDescending,
+                  ThreadPool& pool) const;
+  void operator()(int32_t* HWY_RESTRICT keys, size_t n, SortAscending,
+                  ThreadPool& pool) const;
+  void operator()(int32_t* HWY_RESTRICT keys, size_t n, SortDescending,
+                  ThreadPool& pool) const;
+  void operator()(int64_t* HWY_RESTRICT keys, size_t n, SortAscending,
+                  ThreadPool& pool) const;
+  void operator()(int64_t* HWY_RESTRICT keys, size_t n, SortDescending,
+                  ThreadPool& pool) const;
+
+  void operator()(float* HWY_RESTRICT keys, size_t n, SortAscending,
+                  ThreadPool& pool) const;
+  void operator()(float* HWY_RESTRICT keys, size_t n, SortDescending,
+                  ThreadPool& pool) const;
+  void operator()(double* HWY_RESTRICT keys, size_t n, SortAscending,
+                  ThreadPool& pool) const;
+  void operator()(double* HWY_RESTRICT keys, size_t n, SortDescending,
+                  ThreadPool& pool) const;
+
+  void operator()(uint128_t* HWY_RESTRICT keys, size_t n, SortAscending,
+                  ThreadPool& pool) const;
+  void operator()(uint128_t* HWY_RESTRICT keys, size_t n, SortDescending,
+                  ThreadPool& pool) const;
+
+  void operator()(K64V64* HWY_RESTRICT keys, size_t n, SortAscending,
+                  ThreadPool& pool) const;
+  void operator()(K64V64* HWY_RESTRICT keys, size_t n, SortDescending,
+                  ThreadPool& pool) const;
+
+  void operator()(K32V32* HWY_RESTRICT keys, size_t n, SortAscending,
+                  ThreadPool& pool) const;
+  void operator()(K32V32* HWY_RESTRICT keys, size_t n, SortDescending,
+                  ThreadPool& pool) const;
+
+  // Rearranges keys[0, n) such that keys[0, k) are the same as after sorting
+  // them with operator(), i.e. the first k keys in sort order. The order of
+  // keys[k, n) is unspecified. Much faster than a full sort if k is small
+  // relative to n. k > n is treated as k = n. Does not allocate memory.
+  void PartialSort(uint16_t* HWY_RESTRICT keys, size_t n, size_t k,
+                   SortAscending) const;
+  void PartialSort(uint16_t* HWY_RESTRICT keys, size_t n, size_t k,
+                   SortDescending) const;
+  void PartialSort(uint32_t* HWY_RESTRICT keys, size_t n, size_t k,
+                   SortAscending) const;
+  void PartialSort(uint32_t* HWY_RESTRICT keys, size_t n, size_t k,
+                   SortDescending) const;
+  void PartialSort(uint64_t* HWY_RESTRICT keys, size_t n, size_t k,
+                   SortAscending) const;
+  void PartialSort(uint64_t* HWY_RESTRICT keys, size_t n, size_t k,
+                   SortDescending) const;
+
+  void PartialSort(int16_t* HWY_RESTRICT keys, size_t n, size_t k,
+                   SortAscending) const;
+  void PartialSort(int16_t* HWY_RESTRICT keys, size_t n, size_t k,
+                   SortDescending) const;
+  void PartialSort(int32_t* HWY_RESTRICT keys, size_t n, size_t k,
+                   SortAscending) const;
+  void PartialSort(int32_t* HWY_RESTRICT keys, size_t n, size_t k,
+                   SortDescending) const;
+  void PartialSort(int64_t* HWY_RESTRICT keys, size_t n, size_t k,
+                   SortAscending) const;
+  void PartialSort(int64_t* HWY_RESTRICT keys, size_t n, size_t k,
+                   SortDescending) const;
+
+  void PartialSort(float* HWY_RESTRICT keys, size_t n, size_t k,
+                   SortAscending) const;
+  void PartialSort(float* HWY_RESTRICT keys, size_t n, size_t k,
+                   SortDescending) const;
+  void PartialSort(double* HWY_RESTRICT keys, size_t n, size_t k,
+                   SortAscending) const;
+  void PartialSort(double* HWY_RESTRICT keys, size_t n, size_t k,
+                   SortDescending) const;
+
+  void PartialSort(uint128_t* HWY_RESTRICT keys, size_t n, size_t k,
+                   SortAscending) const;
+  void PartialSort(uint128_t* HWY_RESTRICT keys, size_t n, size_t k,
+                   SortDescending) const;
+
+  void PartialSort(K64V64* HWY_RESTRICT keys, size_t n, size_t k,
+                   SortAscending) const;
+  void PartialSort(K64V64* HWY_RESTRICT keys, size_t n, size_t k,
+                   SortDescending) const;
+
+  void PartialSort(K32V32* HWY_RESTRICT keys, size_t n, size_t k,
+                   SortAscending) const;
+  void PartialSort(K32V32* HWY_RESTRICT keys, size_t n, size_t k,
+                   SortDescending) const;
+
+  // Rearranges keys[0, n) like std::nth_element: keys[k] becomes the key that
+  // would be there after sorting with operator(), no key before it is ordered
+  // after it, and no key after it is ordered before it. Useful for medians and
+  // percentiles; expected O(n) time. Does nothing if k >= n. Does not allocate
+  // memory.
+  void Select(uint16_t* HWY_RESTRICT keys, size_t n, size_t k,
+              SortAscending) const;
+  void Select(uint16_t* HWY_RESTRICT keys, size_t n, size_t k,
+              SortDescending) const;
+  void Select(uint32_t* HWY_RESTRICT keys, size_t n, size_t k,
+              SortAscending) const;
+  void Select(uint32_t* HWY_RESTRICT keys, size_t n, size_t k,
+              SortDescending) const;
+  void Select(uint64_t* HWY_RESTRICT keys, size_t n, size_t k,
+              SortAscending) const;
+  void Select(uint64_t* HWY_RESTRICT keys, size_t n, size_t k,
+              SortDescending) const;
+
+  void Select(int16_t* HWY_RESTRICT keys, size_t n, size_t k,
+              SortAscending) const;
+  void Select(int16_t* HWY_RESTRICT keys, size_t n, size_t k,
+              SortDescending) const;
+  void Select(int32_t* HWY_RESTRICT keys, size_t n, size_t k,
+              SortAscending) const;
+  void Select(int32_t* HWY_RESTRICT keys, size_t n, size_t k,
+              SortDescending) const;
+  void Select(int64_t* HWY_RESTRICT keys, size_t n, size_t k,
+              SortAscending) const;
+  void Select(int64_t* HWY_RESTRICT keys, size_t n, size_t k,
+              SortDescending) const;
+
+  void Select(float* HWY_RESTRICT keys, size_t n, size_t k,
+              SortAscending) const;
+  void Select(float* HWY_RESTRICT keys, size_t n, size_t k,
+              SortDescending) const;
+  void Select(double* HWY_RESTRICT keys, size_t n, size_t k,
+              SortAscending) const;
+  void Select(double* HWY_RESTRICT keys, size_t n, size_t k,
+              SortDescending) const;
+
+  void Select(uint128_t* HWY_RESTRICT keys, size_t n, size_t k,
+              SortAscending) const;
+  void Select(uint128_t* HWY_RESTRICT keys, size_t n, size_t k,
+              SortDescending) const;
+
+  void Select(K64V64* HWY_RESTRICT keys, size_t n, size_t k,
+              SortAscending) const;
+  void Select(K64V64* HWY_RESTRICT keys, size_t n, size_t k,
+              SortDescending) const;
+
+  void Select(K32V32* HWY_RESTRICT keys, size_t n, size_t k,
+              SortAscending) const;
+  void Select(K32V32* HWY_RESTRICT keys, size_t n, size_t k,
+              SortDescending) const;
+
+  // Writes to indices[0, n) the permutation that sorts keys[0, n), i.e.
+  // keys[indices[0]], keys[indices[1]], .. are in sort order; does not modify
+  // keys. Stable: indices of equal keys are in ascending order. Sorts unique
+  // 64-bit (for 32-bit keys, hence n < 2^32) or 128-bit combinations of key
+  // and index. Allocates O(n) memory.
+  void Argsort(const uint32_t* HWY_RESTRICT keys, size_t n,
+               uint32_t* HWY_RESTRICT indices, SortAscending) const;
+  void Argsort(const uint32_t* HWY_RESTRICT keys, size_t n,
+               uint32_t* HWY_RESTRICT indices, SortDescending) const;
+  void Argsort(const int32_t* HWY_RESTRICT keys, size_t n,
+               uint32_t* HWY_RESTRICT indices, SortAscending) const;
+  void Argsort(const int32_t* HWY_RESTRICT keys, size_t n,
+               uint32_t* HWY_RESTRICT indices, SortDescending) const;
+  void Argsort(const float* HWY_RESTRICT keys, size_t n,
+               uint32_t* HWY_RESTRICT indices, SortAscending) const;
+  void Argsort(const float* HWY_RESTRICT keys, size_t n,
+               uint32_t* HWY_RESTRICT indices, SortDescending) const;
+
+  void Argsort(const uint64_t* HWY_RESTRICT keys, size_t n,
+               uint64_t* HWY_RESTRICT indices, SortAscending) const;
+  void Argsort(const uint64_t* HWY_RESTRICT keys, size_t n,
+               uint64_t* HWY_RESTRICT indices, SortDescending) const;
+  void Argsort(const int64_t* HWY_RESTRICT keys, size_t n,
+               uint64_t* HWY_RESTRICT indices, SortAscending) const;
+  void Argsort(const int64_t* HWY_RESTRICT keys, size_t n,
+               uint64_t* HWY_RESTRICT indices, SortDescending) const;
+  void Argsort(const double* HWY_RESTRICT keys, size_t n,
+               uint64_t* HWY_RESTRICT indices, SortAscending) const;
+  void Argsort(const double* HWY_RESTRICT keys, size_t n,
+               uint64_t* HWY_RESTRICT indices, SortDescending) const;
+
+  // Sorts n records (e.g. structs) of record_bytes each, which are contiguous
+  // starting at `records`, by their key. `first_key` points to the key of the
+  // first record; the keys of the others are at the same offset. Stable:
+  // records with equal keys keep their relative order. Gathers the keys into
+  // unique 64-bit (for 32-bit keys, hence n < 2^32) or 128-bit combinations of
+  // key and index as in Argsort, sorts them, then copies the records in that
+  // order. Faster than sorting the records directly if they are larger than
+  // the key, because only the keys are moved during sorting. Allocates
+  // O(n * record_bytes) memory.
+  void SortRecords(void* HWY_RESTRICT records, size_t n, size_t record_bytes,
+                   const uint32_t* first_key, SortAscending) const;
+  void SortRecords(void* HWY_RESTRICT records, size_t n, size_t record_bytes,
+                   const uint32_t* first_key, SortDescending) const;
+  void SortRecords(void* HWY_RESTRICT records, size_t n, size_t record_bytes,
+                   const int32_t* first_key, SortAscending) const;
+  void SortRecords(void* HWY_RESTRICT records, size_t n, size_t record_bytes,
+                   const int32_t* first_key, SortDescending) const;
+  void SortRecords(void* HWY_RESTRICT records, size_t n, size_t record_bytes,
+                   const float* first_key, SortAscending) const;
+  void SortRecords(void* HWY_RESTRICT records, size_t n, size_t record_bytes,
+                   const float* first_key, SortDescending) const;
+  void SortRecords(void* HWY_RESTRICT records, size_t n, size_t record_bytes,
+                   const uint64_t* first_key, SortAscending) const;
+  void SortRecords(void* HWY_RESTRICT records, size_t n, size_t record_bytes,
+                   const uint64_t* first_key, SortDescending) const;
+  void SortRecords(void* HWY_RESTRICT records, size_t n, size_t record_bytes,
+                   const int64_t* first_key, SortAscending) const;
+  void SortRecords(void* HWY_RESTRICT records, size_t n, size_t record_bytes,
+                   const int64_t* first_key, SortDescending) const;
+  void SortRecords(void* HWY_RESTRICT records, size_t n, size_t record_bytes,
+                   const double* first_key, SortAscending) const;
+  void SortRecords(void* HWY_RESTRICT records, size_t n, size_t record_bytes,
+                   const double* first_key, SortDescending) const;
+
+  // Same as operator(), but stable: pairs with equal keys keep their relative
+  // order, e.g. events keyed by timestamp remain in insertion order. For other
+  // key types, equal keys are indistinguishable (except for floating-point
+  // -0.0 and 0.0), hence operator() already has the same result. Sorts unique
+  // combinations of key and index (for K32V32, n must be less than 2^32), then
+  // gathers the pairs. Allocates O(n) memory.
+  void StableSort(K64V64* HWY_RESTRICT keys, size_t n, SortAscending) const;
+  void StableSort(K64V64* HWY_RESTRICT keys, size_t n, SortDescending) const;
+  void StableSort(K32V32* HWY_RESTRICT keys, size_t n, SortAscending) const;
+  void StableSort(K32V32* HWY_RESTRICT keys, size_t n, SortDescending) const;
+
+  // Merges a[0, num_a) and b[0, num_b), each sorted in the given order (e.g.
+  // by operator()), into out[0, num_a + num_b), which must not overlap them.
+  // Uses bitonic merging networks on pairs of vectors, hence this is much
+  // faster than sorting the concatenation. The order of equal keys is
+  // unspecified. Does not allocate memory.
+  void Merge(const uint16_t* HWY_RESTRICT a, size_t num_a,
+             const uint16_t* HWY_RESTRICT b, size_t num_b,
+             uint16_t* HWY_RESTRICT out, SortAscending) const;
+  void Merge(const uint16_t* HWY_RESTRICT a, size_t num_a,
+             const uint16_t* HWY_RESTRICT b, size_t num_b,
+             uint16_t* HWY_RESTRICT out, SortDescending) const;
+  void Merge(const uint32_t* HWY_RESTRICT a, size_t num_a,
+             const uint32_t* HWY_RESTRICT b, size_t num_b,
+             uint32_t* HWY_RESTRICT out, SortAscending) const;
+  void Merge(const uint32_t* HWY_RESTRICT a, size_t num_a,
+             const uint32_t* HWY_RESTRICT b, size_t num_b,
+             uint32_t* HWY_RESTRICT out, SortDescending) const;
+  void Merge(const uint64_t* HWY_RESTRICT a, size_t num_a,
+             const uint64_t* HWY_RESTRICT b, size_t num_b,
+             uint64_t* HWY_RESTRICT out, SortAscending) const;
+  void Merge(const uint64_t* HWY_RESTRICT a, size_t num_a,
+             const uint64_t* HWY_RESTRICT b, size_t num_b,
+             uint64_t* HWY_RESTRICT out, SortDescending) const;
+
+  void Merge(const int16_t* HWY_RESTRICT a, size_t num_a,
+             const int16_t* HWY_RESTRICT b, size_t num_b,
+             int16_t* HWY_RESTRICT out, SortAscending) const;
+  void Merge(const int16_t* HWY_RESTRICT a, size_t num_a,
+             const int16_t* HWY_RESTRICT b, size_t num_b,
+             int16_t* HWY_RESTRICT out, SortDescending) const;
+  void Merge(const int32_t* HWY_RESTRICT a, size_t num_a,
+             const int32_t* HWY_RESTRICT b, size_t num_b,
+             int32_t* HWY_RESTRICT out, SortAscending) const;
+  void Merge(const int32_t* HWY_RESTRICT a, size_t num_a,
+             const int32_t* HWY_RESTRICT b, size_t num_b,
+             int32_t* HWY_RESTRICT out, SortDescending) const;
+  void Merge(const int64_t* HWY_RESTRICT a, size_t num_a,
+             const int64_t* HWY_RESTRICT b, size_t num_b,
+             int64_t* HWY_RESTRICT out, SortAscending) const;
+  void Merge(const int64_t* HWY_RESTRICT a, size_t num_a,
+             const int64_t* HWY_RESTRICT b, size_t num_b,
+             int64_t* HWY_RESTRICT out, SortDescending) const;
+
+  void Merge(const float* HWY_RESTRICT a, size_t num_a,
+             const float* HWY_RESTRICT b, size_t num_b, float* HWY_RESTRICT out,
+             SortAscending) const;
+  void Merge(const float* HWY_RESTRICT a, size_t num_a,
+             const float* HWY_RESTRICT b, size_t num_b, float* HWY_RESTRICT out,
+             SortDescending) const;
+  void Merge(const double* HWY_RESTRICT a, size_t num_a,
+             const double* HWY_RESTRICT b, size_t num_b,
+             double* HWY_RESTRICT out, SortAscending) const;
+  void Merge(const double* HWY_RESTRICT a, size_t num_a,
+             const double* HWY_RESTRICT b, size_t num_b,
+             double* HWY_RESTRICT out, SortDescending) const;
+
+  void Merge(const uint128_t* HWY_RESTRICT a, size_t num_a,
+             const uint128_t* HWY_RESTRICT b, size_t num_b,
+             uint128_t* HWY_RESTRICT out, SortAscending) const;
+  void Merge(const uint128_t* HWY_RESTRICT a, size_t num_a,
+             const uint128_t* HWY_RESTRICT b, size_t num_b,
+             uint128_t* HWY_RESTRICT out, SortDescending) const;
+
+  void Merge(const K64V64* HWY_RESTRICT a, size_t num_a,
+             const K64V64* HWY_RESTRICT b, size_t num_b,
+             K64V64* HWY_RESTRICT out, SortAscending) const;
+  void Merge(const K64V64* HWY_RESTRICT a, size_t num_a,
+             const K64V64* HWY_RESTRICT b, size_t num_b,
+             K64V64* HWY_RESTRICT out, SortDescending) const;
+
+  void Merge(const K32V32* HWY_RESTRICT a, size_t num_a,
+             const K32V32* HWY_RESTRICT b, size_t num_b,
+             K32V32* HWY_RESTRICT out, SortAscending) const;
+  void Merge(const K32V32* HWY_RESTRICT a, size_t num_a,
+             const K32V32* HWY_RESTRICT b, size_t num_b,
+             K32V32* HWY_RESTRICT out, SortDescending) const;
+
+  // Merges num_runs sorted runs, runs[i][0, run_sizes[i]), e.g. one per thread
+  // or input file, into `out`, which must not overlap them. Merges pairs of
+  // runs in CeilLog2(num_runs) passes. Allocates memory for a copy of the
+  // output if there are more than two runs.
+  void Merge(const uint16_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, uint16_t* HWY_RESTRICT out, SortAscending) const;
+  void Merge(const uint16_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, uint16_t* HWY_RESTRICT out, SortDescending) const;
+  void Merge(const uint32_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, uint32_t* HWY_RESTRICT out, SortAscending) const;
+  void Merge(const uint32_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, uint32_t* HWY_RESTRICT out, SortDescending) const;
+  void Merge(const uint64_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, uint64_t* HWY_RESTRICT out, SortAscending) const;
+  void Merge(const uint64_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, uint64_t* HWY_RESTRICT out, SortDescending) const;
+
+  void Merge(const int16_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, int16_t* HWY_RESTRICT out, SortAscending) const;
+  void Merge(const int16_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, int16_t* HWY_RESTRICT out, SortDescending) const;
+  void Merge(const int32_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, int32_t* HWY_RESTRICT out, SortAscending) const;
+  void Merge(const int32_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, int32_t* HWY_RESTRICT out, SortDescending) const;
+  void Merge(const int64_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, int64_t* HWY_RESTRICT out, SortAscending) const;
+  void Merge(const int64_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, int64_t* HWY_RESTRICT out, SortDescending) const;
+
+  void Merge(const float* const* runs, const size_t* run_sizes, size_t num_runs,
+             float* HWY_RESTRICT out, SortAscending) const;
+  void Merge(const float* const* runs, const size_t* run_sizes, size_t num_runs,
+             float* HWY_RESTRICT out, SortDescending) const;
+  void Merge(const double* const* runs, const size_t* run_sizes,
+             size_t num_runs, double* HWY_RESTRICT out, SortAscending) const;
+  void Merge(const double* const* runs, const size_t* run_sizes,
+             size_t num_runs, double* HWY_RESTRICT out, SortDescending) const;
+
+  void Merge(const uint128_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, uint128_t* HWY_RESTRICT out, SortAscending) const;
+  void Merge(const uint128_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, uint128_t* HWY_RESTRICT out,
+             SortDescending) const;
+
+  void Merge(const K64V64* const* runs, const size_t* run_sizes,
+             size_t num_runs, K64V64* HWY_RESTRICT out, SortAscending) const;
+  void Merge(const K64V64* const* runs, const size_t* run_sizes,
+             size_t num_runs, K64V64* HWY_RESTRICT out, SortDescending) const;
+
+  void Merge(const K32V32* const* runs, const size_t* run_sizes,
+             size_t num_runs, K32V32* HWY_RESTRICT out, SortAscending) const;
+  void Merge(const K32V32* const* runs, const size_t* run_sizes,
+             size_t num_runs, K32V32* HWY_RESTRICT out, SortDescending) const;
+
+  // Same as above, but does not allocate: if there are more than two runs,
+  // the passes alternate between `out` and the caller-owned `scratch`, which
+  // must have room for as many keys as `out` and not overlap it nor the runs.
+  // Otherwise, `scratch` is unused and may be nullptr.
+  void Merge(const uint16_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, uint16_t* HWY_RESTRICT out,
+             uint16_t* HWY_RESTRICT scratch, SortAscending) const;
+  void Merge(const uint16_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, uint16_t* HWY_RESTRICT out,
+             uint16_t* HWY_RESTRICT scratch, SortDescending) const;
+  void Merge(const uint32_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, uint32_t* HWY_RESTRICT out,
+             uint32_t* HWY_RESTRICT scratch, SortAscending) const;
+  void Merge(const uint32_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, uint32_t* HWY_RESTRICT out,
+             uint32_t* HWY_RESTRICT scratch, SortDescending) const;
+  void Merge(const uint64_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, uint64_t* HWY_RESTRICT out,
+             uint64_t* HWY_RESTRICT scratch, SortAscending) const;
+  void Merge(const uint64_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, uint64_t* HWY_RESTRICT out,
+             uint64_t* HWY_RESTRICT scratch, SortDescending) const;
+
+  void Merge(const int16_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, int16_t* HWY_RESTRICT out,
+             int16_t* HWY_RESTRICT scratch, SortAscending) const;
+  void Merge(const int16_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, int16_t* HWY_RESTRICT out,
+             int16_t* HWY_RESTRICT scratch, SortDescending) const;
+  void Merge(const int32_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, int32_t* HWY_RESTRICT out,
+             int32_t* HWY_RESTRICT scratch, SortAscending) const;
+  void Merge(const int32_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, int32_t* HWY_RESTRICT out,
+             int32_t* HWY_RESTRICT scratch, SortDescending) const;
+  void Merge(const int64_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, int64_t* HWY_RESTRICT out,
+             int64_t* HWY_RESTRICT scratch, SortAscending) const;
+  void Merge(const int64_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, int64_t* HWY_RESTRICT out,
+             int64_t* HWY_RESTRICT scratch, SortDescending) const;
+
+  void Merge(const float* const* runs, const size_t* run_sizes,
+             size_t num_runs, float* HWY_RESTRICT out,
+             float* HWY_RESTRICT scratch, SortAscending) const;
+  void Merge(const float* const* runs, const size_t* run_sizes,
+             size_t num_runs, float* HWY_RESTRICT out,
+             float* HWY_RESTRICT scratch, SortDescending) const;
+  void Merge(const double* const* runs, const size_t* run_sizes,
+             size_t num_runs, double* HWY_RESTRICT out,
+             double* HWY_RESTRICT scratch, SortAscending) const;
+  void Merge(const double* const* runs, const size_t* run_sizes,
+             size_t num_runs, double* HWY_RESTRICT out,
+             double* HWY_RESTRICT scratch, SortDescending) const;
+
+  void Merge(const uint128_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, uint128_t* HWY_RESTRICT out,
+             uint128_t* HWY_RESTRICT scratch, SortAscending) const;
+  void Merge(const uint128_t* const* runs, const size_t* run_sizes,
+             size_t num_runs, uint128_t* HWY_RESTRICT out,
+             uint128_t* HWY_RESTRICT scratch, SortDescending) const;
+
+  void Merge(const K64V64* const* runs, const size_t* run_sizes,
+             size_t num_runs, K64V64* HWY_RESTRICT out,
+             K64V64* HWY_RESTRICT scratch, SortAscending) const;
+  void Merge(const K64V64* const* runs, const size_t* run_sizes,
+             size_t num_runs, K64V64* HWY_RESTRICT out,
+             K64V64* HWY_RESTRICT scratch, SortDescending) const;
+
+  void Merge(const K32V32* const* runs, const size_t* run_sizes,
+             size_t num_runs, K32V32* HWY_RESTRICT out,
+             K32V32* HWY_RESTRICT scratch, SortAscending) const;
+  void Merge(const K32V32* const* runs, const size_t* run_sizes,
+             size_t num_runs, K32V32* HWY_RESTRICT out,
+             K32V32* HWY_RESTRICT scratch, SortDescending) const;
+
+  // Sorts each segment keys[offsets[i], offsets[i + 1]) for i < num_segments
+  // independently, i.e. `offsets` has num_segments + 1 non-decreasing entries.
+  // Much faster than calling operator() for each of many small segments,
+  // because it dispatches only once and sorts segments of up to 16 vectors
+  // directly with a sorting network. Does not allocate memory.
+  void SortSegments(uint16_t* HWY_RESTRICT keys, const size_t* offsets,
+                    size_t num_segments, SortAscending) const;
+  void SortSegments(uint16_t* HWY_RESTRICT keys, const size_t* offsets,
+                    size_t num_segments, SortDescending) const;
+  void SortSegments(uint32_t* HWY_RESTRICT keys, const size_t* offsets,
+                    size_t num_segments, SortAscending) const;
+  void SortSegments(uint32_t* HWY_RESTRICT keys, const size_t* offsets,
+                    size_t num_segments, SortDescending) const;
+  void SortSegments(uint64_t* HWY_RESTRICT keys, const size_t* offsets,
+                    size_t num_segments, SortAscending) const;
+  void SortSegments(uint64_t* HWY_RESTRICT keys, const size_t* offsets,
+                    size_t num_segments, SortDescending) const;
+
+  void SortSegments(int16_t* HWY_RESTRICT keys, const size_t* offsets,
+                    size_t num_segments, SortAscending) const;
+  void SortSegments(int16_t* HWY_RESTRICT keys, const size_t* offsets,
+                    size_t num_segments, SortDescending) const;
+  void SortSegments(int32_t* HWY_RESTRICT keys, const size_t* offsets,
+                    size_t num_segments, SortAscending) const;
+  void SortSegments(int32_t* HWY_RESTRICT keys, const size_t* offsets,
+                    size_t num_segments, SortDescending) const;
+  void SortSegments(int64_t* HWY_RESTRICT keys, const size_t* offsets,
+                    size_t num_segments, SortAscending) const;
+  void SortSegments(int64_t* HWY_RESTRICT keys, const size_t* offsets,
+                    size_t num_segments, SortDescending) const;
+
+  void SortSegments(float* HWY_RESTRICT keys, const size_t* offsets,
+                    size_t num_segments, SortAscending) const;
+  void SortSegments(float* HWY_RESTRICT keys, const size_t* offsets,
+                    size_t num_segments, SortDescending) const;
+  void SortSegments(double* HWY_RESTRICT keys, const size_t* offsets,
+                    size_t num_segments, SortAscending) const;
+  void SortSegments(double* HWY_RESTRICT keys, const size_t* offsets,
+                    size_t num_segments, SortDescending) const;
+
+  void SortSegments(uint128_t* HWY_RESTRICT keys, const size_t* offsets,
+                    size_t num_segments, SortAscending) const;
+  void SortSegments(uint128_t* HWY_RESTRICT keys, const size_t* offsets,
+                    size_t num_segments, SortDescending) const;
+
+  void SortSegments(K64V64* HWY_RESTRICT keys, const size_t* offsets,
+                    size_t num_segments, SortAscending) const;
+  void SortSegments(K64V64* HWY_RESTRICT keys, const size_t* offsets,
+                    size_t num_segments, SortDescending) const;
+
+  void SortSegments(K32V32* HWY_RESTRICT keys, const size_t* offsets,
+                    size_t num_segments, SortAscending) const;
+  void SortSegments(K32V32* HWY_RESTRICT keys, const size_t* offsets,
+                    size_t num_segments, SortDescending) const;
+
   // For internal use only
   static void Fill24Bytes(const void* seed_heap, size_t seed_num, void* bytes);
   static bool HaveFloat64();
@@ -101,6 +673,7 @@ class HWY_CONTRIB_DLLEXPORT Sorter {
   }
 
   void* ptr_ = nullptr;
+  bool owned_ = true;  // false if ptr_ is caller-owned scratch memory
 };
 
 }  // namespace hwy
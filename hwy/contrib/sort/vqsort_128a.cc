@@ -22,6 +22,7 @@
 // After foreach_target
 #include "hwy/contrib/sort/traits128-inl.h"
 #include "hwy/contrib/sort/vqsort-inl.h"
+#include "hwy/contrib/sort/parallel-inl.h"
 
 HWY_BEFORE_NAMESPACE();
 namespace hwy {
@@ -29,16 +30,53 @@ namespace HWY_NAMESPACE {
 
 void Sort128Asc(uint64_t* HWY_RESTRICT keys, size_t num,
                 uint64_t* HWY_RESTRICT buf) {
-#if VQSORT_ENABLED
   SortTag<uint64_t> d;
   detail::SharedTraits<detail::Traits128<detail::OrderAscending128>> st;
   Sort(d, st, keys, num, buf);
-#else
-  (void) keys;
-  (void) num;
-  (void) buf;
-  HWY_ASSERT(0);
-#endif
+}
+
+void ParallelSort128Asc(uint64_t* HWY_RESTRICT keys, size_t num,
+                        ThreadPool& pool) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::Traits128<detail::OrderAscending128>> st;
+  ParallelSort(d, st, keys, num, pool);
+}
+
+void PartialSort128Asc(uint64_t* HWY_RESTRICT keys, size_t num, size_t k,
+                       uint64_t* HWY_RESTRICT buf) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::Traits128<detail::OrderAscending128>> st;
+  PartialSort(d, st, keys, num, k, buf);
+}
+
+void Select128Asc(uint64_t* HWY_RESTRICT keys, size_t num, size_t k,
+                  uint64_t* HWY_RESTRICT buf) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::Traits128<detail::OrderAscending128>> st;
+  Select(d, st, keys, num, k, buf);
+}
+
+void Merge128Asc(const uint64_t* HWY_RESTRICT a, size_t num_a,
+                 const uint64_t* HWY_RESTRICT b, size_t num_b,
+                 uint64_t* HWY_RESTRICT out) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::Traits128<detail::OrderAscending128>> st;
+  Merge(d, st, a, num_a, b, num_b, out);
+}
+
+void MergeRuns128Asc(const uint64_t* const* runs, const size_t* run_sizes,
+                     size_t num_runs, uint64_t* HWY_RESTRICT out,
+                     uint64_t* HWY_RESTRICT scratch) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::Traits128<detail::OrderAscending128>> st;
+  MergeRuns(d, st, runs, run_sizes, num_runs, out, scratch);
+}
+
+void SortSegments128Asc(uint64_t* HWY_RESTRICT keys, const size_t* offsets,
+                        size_t num_segments, uint64_t* HWY_RESTRICT buf) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::Traits128<detail::OrderAscending128>> st;
+  SortSegments(d, st, keys, offsets, num_segments, buf);
 }
 
 // NOLINTNEXTLINE(google-readability-namespace-comments)
@@ -50,6 +88,12 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(Sort128Asc);
+HWY_EXPORT(ParallelSort128Asc);
+HWY_EXPORT(PartialSort128Asc);
+HWY_EXPORT(Select128Asc);
+HWY_EXPORT(Merge128Asc);
+HWY_EXPORT(MergeRuns128Asc);
+HWY_EXPORT(SortSegments128Asc);
 }  // namespace
 
 void Sorter::operator()(uint128_t* HWY_RESTRICT keys, size_t n,
@@ -58,5 +102,54 @@ void Sorter::operator()(uint128_t* HWY_RESTRICT keys, size_t n,
   (reinterpret_cast<uint64_t*>(keys), n * 2, Get<uint64_t>());
 }
 
+void Sorter::operator()(uint128_t* HWY_RESTRICT keys, size_t n, SortAscending,
+                        ThreadPool& pool) const {
+  HWY_DYNAMIC_DISPATCH(ParallelSort128Asc)
+  (reinterpret_cast<uint64_t*>(keys), n * 2, pool);
+}
+
+void Sorter::PartialSort(uint128_t* HWY_RESTRICT keys, size_t n, size_t k,
+                         SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(PartialSort128Asc)
+  (reinterpret_cast<uint64_t*>(keys), n * 2, k * 2, Get<uint64_t>());
+}
+
+void Sorter::Select(uint128_t* HWY_RESTRICT keys, size_t n, size_t k,
+                    SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(Select128Asc)
+  (reinterpret_cast<uint64_t*>(keys), n * 2, k * 2, Get<uint64_t>());
+}
+
+void Sorter::Merge(const uint128_t* HWY_RESTRICT a, size_t num_a,
+                   const uint128_t* HWY_RESTRICT b, size_t num_b,
+                   uint128_t* HWY_RESTRICT out, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(Merge128Asc)
+  (reinterpret_cast<const uint64_t*>(a), num_a * 2,
+   reinterpret_cast<const uint64_t*>(b), num_b * 2,
+   reinterpret_cast<uint64_t*>(out));
+}
+
+void Sorter::Merge(const uint128_t* const* runs, const size_t* run_sizes,
+                   size_t num_runs, uint128_t* HWY_RESTRICT out,
+                   SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRuns128Asc)
+  (reinterpret_cast<const uint64_t* const*>(runs), run_sizes, num_runs,
+   reinterpret_cast<uint64_t*>(out), nullptr);
+}
+
+void Sorter::Merge(const uint128_t* const* runs, const size_t* run_sizes,
+                   size_t num_runs, uint128_t* HWY_RESTRICT out,
+                   uint128_t* HWY_RESTRICT scratch, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRuns128Asc)
+  (reinterpret_cast<const uint64_t* const*>(runs), run_sizes, num_runs,
+   reinterpret_cast<uint64_t*>(out), reinterpret_cast<uint64_t*>(scratch));
+}
+
+void Sorter::SortSegments(uint128_t* HWY_RESTRICT keys, const size_t* offsets,
+                          size_t num_segments, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(SortSegments128Asc)
+  (reinterpret_cast<uint64_t*>(keys), offsets, num_segments, Get<uint64_t>());
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -22,6 +22,8 @@
 // After foreach_target
 #include "hwy/contrib/sort/traits-inl.h"
 #include "hwy/contrib/sort/vqsort-inl.h"
+#include "hwy/contrib/sort/parallel-inl.h"
+#include "hwy/contrib/sort/radix-inl.h"
 
 HWY_BEFORE_NAMESPACE();
 namespace hwy {
@@ -30,9 +32,54 @@ namespace HWY_NAMESPACE {
 void SortF32Asc(float* HWY_RESTRICT keys, size_t num, float* HWY_RESTRICT buf) {
   SortTag<float> d;
   detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<float>>> st;
+  if (detail::UseRadixSort(st, num) && RadixSort(d, st, keys, num)) return;
   Sort(d, st, keys, num, buf);
 }
 
+void ParallelSortF32Asc(float* HWY_RESTRICT keys, size_t num,
+                        ThreadPool& pool) {
+  SortTag<float> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<float>>> st;
+  ParallelSort(d, st, keys, num, pool);
+}
+
+void PartialSortF32Asc(float* HWY_RESTRICT keys, size_t num, size_t k,
+                       float* HWY_RESTRICT buf) {
+  SortTag<float> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<float>>> st;
+  PartialSort(d, st, keys, num, k, buf);
+}
+
+void SelectF32Asc(float* HWY_RESTRICT keys, size_t num, size_t k,
+                  float* HWY_RESTRICT buf) {
+  SortTag<float> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<float>>> st;
+  Select(d, st, keys, num, k, buf);
+}
+
+void MergeF32Asc(const float* HWY_RESTRICT a, size_t num_a,
+                 const float* HWY_RESTRICT b, size_t num_b,
+                 float* HWY_RESTRICT out) {
+  SortTag<float> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<float>>> st;
+  Merge(d, st, a, num_a, b, num_b, out);
+}
+
+void MergeRunsF32Asc(const float* const* runs, const size_t* run_sizes,
+                     size_t num_runs, float* HWY_RESTRICT out,
+                     float* HWY_RESTRICT scratch) {
+  SortTag<float> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<float>>> st;
+  MergeRuns(d, st, runs, run_sizes, num_runs, out, scratch);
+}
+
+void SortSegmentsF32Asc(float* HWY_RESTRICT keys, const size_t* offsets,
+                        size_t num_segments, float* HWY_RESTRICT buf) {
+  SortTag<float> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<float>>> st;
+  SortSegments(d, st, keys, offsets, num_segments, buf);
+}
+
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
 }  // namespace hwy
@@ -42,6 +89,12 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortF32Asc);
+HWY_EXPORT(ParallelSortF32Asc);
+HWY_EXPORT(PartialSortF32Asc);
+HWY_EXPORT(SelectF32Asc);
+HWY_EXPORT(MergeF32Asc);
+HWY_EXPORT(MergeRunsF32Asc);
+HWY_EXPORT(SortSegmentsF32Asc);
 }  // namespace
 
 void Sorter::operator()(float* HWY_RESTRICT keys, size_t n,
@@ -49,5 +102,46 @@ void Sorter::operator()(float* HWY_RESTRICT keys, size_t n,
   HWY_DYNAMIC_DISPATCH(SortF32Asc)(keys, n, Get<float>());
 }
 
+void Sorter::operator()(float* HWY_RESTRICT keys, size_t n, SortAscending,
+                        ThreadPool& pool) const {
+  HWY_DYNAMIC_DISPATCH(ParallelSortF32Asc)(keys, n, pool);
+}
+
+void Sorter::PartialSort(float* HWY_RESTRICT keys, size_t n, size_t k,
+                         SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(PartialSortF32Asc)(keys, n, k, Get<float>());
+}
+
+void Sorter::Select(float* HWY_RESTRICT keys, size_t n, size_t k,
+                    SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(SelectF32Asc)(keys, n, k, Get<float>());
+}
+
+void Sorter::Merge(const float* HWY_RESTRICT a, size_t num_a,
+                   const float* HWY_RESTRICT b, size_t num_b,
+                   float* HWY_RESTRICT out, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeF32Asc)(a, num_a, b, num_b, out);
+}
+
+void Sorter::Merge(const float* const* runs, const size_t* run_sizes,
+                   size_t num_runs, float* HWY_RESTRICT out,
+                   SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsF32Asc)
+  (runs, run_sizes, num_runs, out, nullptr);
+}
+
+void Sorter::Merge(const float* const* runs, const size_t* run_sizes,
+                   size_t num_runs, float* HWY_RESTRICT out,
+                   float* HWY_RESTRICT scratch, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsF32Asc)
+  (runs, run_sizes, num_runs, out, scratch);
+}
+
+void Sorter::SortSegments(float* HWY_RESTRICT keys, const size_t* offsets,
+                          size_t num_segments, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsF32Asc)
+  (keys, offsets, num_segments, Get<float>());
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -22,6 +22,8 @@
 // After foreach_target
 #include "hwy/contrib/sort/traits-inl.h"
 #include "hwy/contrib/sort/vqsort-inl.h"
+#include "hwy/contrib/sort/parallel-inl.h"
+#include "hwy/contrib/sort/radix-inl.h"
 
 HWY_BEFORE_NAMESPACE();
 namespace hwy {
@@ -31,9 +33,54 @@ void SortF32Desc(float* HWY_RESTRICT keys, size_t num,
                  float* HWY_RESTRICT buf) {
   SortTag<float> d;
   detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<float>>> st;
+  if (detail::UseRadixSort(st, num) && RadixSort(d, st, keys, num)) return;
   Sort(d, st, keys, num, buf);
 }
 
+void ParallelSortF32Desc(float* HWY_RESTRICT keys, size_t num,
+                         ThreadPool& pool) {
+  SortTag<float> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<float>>> st;
+  ParallelSort(d, st, keys, num, pool);
+}
+
+void PartialSortF32Desc(float* HWY_RESTRICT keys, size_t num, size_t k,
+                        float* HWY_RESTRICT buf) {
+  SortTag<float> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<float>>> st;
+  PartialSort(d, st, keys, num, k, buf);
+}
+
+void SelectF32Desc(float* HWY_RESTRICT keys, size_t num, size_t k,
+                   float* HWY_RESTRICT buf) {
+  SortTag<float> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<float>>> st;
+  Select(d, st, keys, num, k, buf);
+}
+
+void MergeF32Desc(const float* HWY_RESTRICT a, size_t num_a,
+                  const float* HWY_RESTRICT b, size_t num_b,
+                  float* HWY_RESTRICT out) {
+  SortTag<float> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<float>>> st;
+  Merge(d, st, a, num_a, b, num_b, out);
+}
+
+void MergeRunsF32Desc(const float* const* runs, const size_t* run_sizes,
+                      size_t num_runs, float* HWY_RESTRICT out,
+                      float* HWY_RESTRICT scratch) {
+  SortTag<float> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<float>>> st;
+  MergeRuns(d, st, runs, run_sizes, num_runs, out, scratch);
+}
+
+void SortSegmentsF32Desc(float* HWY_RESTRICT keys, const size_t* offsets,
+                         size_t num_segments, float* HWY_RESTRICT buf) {
+  SortTag<float> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<float>>> st;
+  SortSegments(d, st, keys, offsets, num_segments, buf);
+}
+
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
 }  // namespace hwy
@@ -43,6 +90,12 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortF32Desc);
+HWY_EXPORT(ParallelSortF32Desc);
+HWY_EXPORT(PartialSortF32Desc);
+HWY_EXPORT(SelectF32Desc);
+HWY_EXPORT(MergeF32Desc);
+HWY_EXPORT(MergeRunsF32Desc);
+HWY_EXPORT(SortSegmentsF32Desc);
 }  // namespace
 
 void Sorter::operator()(float* HWY_RESTRICT keys, size_t n,
@@ -50,5 +103,46 @@ void Sorter::operator()(float* HWY_RESTRICT keys, size_t n,
   HWY_DYNAMIC_DISPATCH(SortF32Desc)(keys, n, Get<float>());
 }
 
+void Sorter::operator()(float* HWY_RESTRICT keys, size_t n, SortDescending,
+                        ThreadPool& pool) const {
+  HWY_DYNAMIC_DISPATCH(ParallelSortF32Desc)(keys, n, pool);
+}
+
+void Sorter::PartialSort(float* HWY_RESTRICT keys, size_t n, size_t k,
+                         SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(PartialSortF32Desc)(keys, n, k, Get<float>());
+}
+
+void Sorter::Select(float* HWY_RESTRICT keys, size_t n, size_t k,
+                    SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(SelectF32Desc)(keys, n, k, Get<float>());
+}
+
+void Sorter::Merge(const float* HWY_RESTRICT a, size_t num_a,
+                   const float* HWY_RESTRICT b, size_t num_b,
+                   float* HWY_RESTRICT out, SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(MergeF32Desc)(a, num_a, b, num_b, out);
+}
+
+void Sorter::Merge(const float* const* runs, const size_t* run_sizes,
+                   size_t num_runs, float* HWY_RESTRICT out,
+                   SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsF32Desc)
+  (runs, run_sizes, num_runs, out, nullptr);
+}
+
+void Sorter::Merge(const float* const* runs, const size_t* run_sizes,
+                   size_t num_runs, float* HWY_RESTRICT out,
+                   float* HWY_RESTRICT scratch, SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsF32Desc)
+  (runs, run_sizes, num_runs, out, scratch);
+}
+
+void Sorter::SortSegments(float* HWY_RESTRICT keys, const size_t* offsets,
+                          size_t num_segments, SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsF32Desc)
+  (keys, offsets, num_segments, Get<float>());
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
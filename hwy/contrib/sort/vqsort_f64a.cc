@@ -22,6 +22,7 @@
 // After foreach_target
 #include "hwy/contrib/sort/traits-inl.h"
 #include "hwy/contrib/sort/vqsort-inl.h"
+#include "hwy/contrib/sort/parallel-inl.h"
 
 HWY_BEFORE_NAMESPACE();
 namespace hwy {
@@ -41,6 +42,91 @@ void SortF64Asc(double* HWY_RESTRICT keys, size_t num,
 #endif
 }
 
+void ParallelSortF64Asc(double* HWY_RESTRICT keys, size_t num,
+                        ThreadPool& pool) {
+#if HWY_HAVE_FLOAT64
+  SortTag<double> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<double>>> st;
+  ParallelSort(d, st, keys, num, pool);
+#else
+  (void)keys;
+  (void)num;
+  (void)pool;
+  HWY_ASSERT(0);
+#endif
+}
+
+void PartialSortF64Asc(double* HWY_RESTRICT keys, size_t num, size_t k,
+                       double* HWY_RESTRICT buf) {
+#if HWY_HAVE_FLOAT64
+  SortTag<double> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<double>>> st;
+  PartialSort(d, st, keys, num, k, buf);
+#else
+  (void)keys;
+  (void)num;
+  (void)k;
+  (void)buf;
+  HWY_ASSERT(0);
+#endif
+}
+
+void SelectF64Asc(double* HWY_RESTRICT keys, size_t num, size_t k,
+                  double* HWY_RESTRICT buf) {
+#if HWY_HAVE_FLOAT64
+  SortTag<double> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<double>>> st;
+  Select(d, st, keys, num, k, buf);
+#else
+  (void)keys;
+  (void)num;
+  (void)k;
+  (void)buf;
+  HWY_ASSERT(0);
+#endif
+}
+
+void MergeF64Asc(const double* HWY_RESTRICT a, size_t num_a,
+                 const double* HWY_RESTRICT b, size_t num_b,
+                 double* HWY_RESTRICT out) {
+#if HWY_HAVE_FLOAT64
+  SortTag<double> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<double>>> st;
+  Merge(d, st, a, num_a, b, num_b, out);
+#else
+  (void)a;
+  (void)num_a;
+  (void)b;
+  (void)num_b;
+  (void)out;
+  HWY_ASSERT(0);
+#endif
+}
+
+void MergeRunsF64Asc(const double* const* runs, const size_t* run_sizes,
+                     size_t num_runs, double* HWY_RESTRICT out,
+                     double* HWY_RESTRICT scratch) {
+#if HWY_HAVE_FLOAT64
+  SortTag<double> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<double>>> st;
+  MergeRuns(d, st, runs, run_sizes, num_runs, out, scratch);
+#else
+  (void)runs;
+  (void)run_sizes;
+  (void)num_runs;
+  (void)out;
+  (void)scratch;
+  HWY_ASSERT(0);
+#endif
+}
+
+void SortSegmentsF64Asc(double* HWY_RESTRICT keys, const size_t* offsets,
+                        size_t num_segments, double* HWY_RESTRICT buf) {
+  SortTag<double> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<double>>> st;
+  SortSegments(d, st, keys, offsets, num_segments, buf);
+}
+
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
 }  // namespace hwy
@@ -50,6 +136,12 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortF64Asc);
+HWY_EXPORT(ParallelSortF64Asc);
+HWY_EXPORT(PartialSortF64Asc);
+HWY_EXPORT(SelectF64Asc);
+HWY_EXPORT(MergeF64Asc);
+HWY_EXPORT(MergeRunsF64Asc);
+HWY_EXPORT(SortSegmentsF64Asc);
 }  // namespace
 
 void Sorter::operator()(double* HWY_RESTRICT keys, size_t n,
@@ -57,5 +149,46 @@ void Sorter::operator()(double* HWY_RESTRICT keys, size_t n,
   HWY_DYNAMIC_DISPATCH(SortF64Asc)(keys, n, Get<double>());
 }
 
+void Sorter::operator()(double* HWY_RESTRICT keys, size_t n, SortAscending,
+                        ThreadPool& pool) const {
+  HWY_DYNAMIC_DISPATCH(ParallelSortF64Asc)(keys, n, pool);
+}
+
+void Sorter::PartialSort(double* HWY_RESTRICT keys, size_t n, size_t k,
+                         SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(PartialSortF64Asc)(keys, n, k, Get<double>());
+}
+
+void Sorter::Select(double* HWY_RESTRICT keys, size_t n, size_t k,
+                    SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(SelectF64Asc)(keys, n, k, Get<double>());
+}
+
+void Sorter::Merge(const double* HWY_RESTRICT a, size_t num_a,
+                   const double* HWY_RESTRICT b, size_t num_b,
+                   double* HWY_RESTRICT out, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeF64Asc)(a, num_a, b, num_b, out);
+}
+
+void Sorter::Merge(const double* const* runs, const size_t* run_sizes,
+                   size_t num_runs, double* HWY_RESTRICT out,
+                   SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsF64Asc)
+  (runs, run_sizes, num_runs, out, nullptr);
+}
+
+void Sorter::Merge(const double* const* runs, const size_t* run_sizes,
+                   size_t num_runs, double* HWY_RESTRICT out,
+                   double* HWY_RESTRICT scratch, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsF64Asc)
+  (runs, run_sizes, num_runs, out, scratch);
+}
+
+void Sorter::SortSegments(double* HWY_RESTRICT keys, const size_t* offsets,
+                          size_t num_segments, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsF64Asc)
+  (keys, offsets, num_segments, Get<double>());
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -22,6 +22,7 @@
 // After foreach_target
 #include "hwy/contrib/sort/traits-inl.h"
 #include "hwy/contrib/sort/vqsort-inl.h"
+#include "hwy/contrib/sort/parallel-inl.h"
 
 HWY_BEFORE_NAMESPACE();
 namespace hwy {
@@ -41,6 +42,91 @@ void SortF64Desc(double* HWY_RESTRICT keys, size_t num,
 #endif
 }
 
+void ParallelSortF64Desc(double* HWY_RESTRICT keys, size_t num,
+                         ThreadPool& pool) {
+#if HWY_HAVE_FLOAT64
+  SortTag<double> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<double>>> st;
+  ParallelSort(d, st, keys, num, pool);
+#else
+  (void)keys;
+  (void)num;
+  (void)pool;
+  HWY_ASSERT(0);
+#endif
+}
+
+void PartialSortF64Desc(double* HWY_RESTRICT keys, size_t num, size_t k,
+                        double* HWY_RESTRICT buf) {
+#if HWY_HAVE_FLOAT64
+  SortTag<double> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<double>>> st;
+  PartialSort(d, st, keys, num, k, buf);
+#else
+  (void)keys;
+  (void)num;
+  (void)k;
+  (void)buf;
+  HWY_ASSERT(0);
+#endif
+}
+
+void SelectF64Desc(double* HWY_RESTRICT keys, size_t num, size_t k,
+                   double* HWY_RESTRICT buf) {
+#if HWY_HAVE_FLOAT64
+  SortTag<double> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<double>>> st;
+  Select(d, st, keys, num, k, buf);
+#else
+  (void)keys;
+  (void)num;
+  (void)k;
+  (void)buf;
+  HWY_ASSERT(0);
+#endif
+}
+
+void MergeF64Desc(const double* HWY_RESTRICT a, size_t num_a,
+                  const double* HWY_RESTRICT b, size_t num_b,
+                  double* HWY_RESTRICT out) {
+#if HWY_HAVE_FLOAT64
+  SortTag<double> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<double>>> st;
+  Merge(d, st, a, num_a, b, num_b, out);
+#else
+  (void)a;
+  (void)num_a;
+  (void)b;
+  (void)num_b;
+  (void)out;
+  HWY_ASSERT(0);
+#endif
+}
+
+void MergeRunsF64Desc(const double* const* runs, const size_t* run_sizes,
+                      size_t num_runs, double* HWY_RESTRICT out,
+                      double* HWY_RESTRICT scratch) {
+#if HWY_HAVE_FLOAT64
+  SortTag<double> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<double>>> st;
+  MergeRuns(d, st, runs, run_sizes, num_runs, out, scratch);
+#else
+  (void)runs;
+  (void)run_sizes;
+  (void)num_runs;
+  (void)out;
+  (void)scratch;
+  HWY_ASSERT(0);
+#endif
+}
+
+void SortSegmentsF64Desc(double* HWY_RESTRICT keys, const size_t* offsets,
+                         size_t num_segments, double* HWY_RESTRICT buf) {
+  SortTag<double> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<double>>> st;
+  SortSegments(d, st, keys, offsets, num_segments, buf);
+}
+
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
 }  // namespace hwy
@@ -50,6 +136,12 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortF64Desc);
+HWY_EXPORT(ParallelSortF64Desc);
+HWY_EXPORT(PartialSortF64Desc);
+HWY_EXPORT(SelectF64Desc);
+HWY_EXPORT(MergeF64Desc);
+HWY_EXPORT(MergeRunsF64Desc);
+HWY_EXPORT(SortSegmentsF64Desc);
 }  // namespace
 
 void Sorter::operator()(double* HWY_RESTRICT keys, size_t n,
@@ -57,5 +149,46 @@ void Sorter::operator()(double* HWY_RESTRICT keys, size_t n,
   HWY_DYNAMIC_DISPATCH(SortF64Desc)(keys, n, Get<double>());
 }
 
+void Sorter::operator()(double* HWY_RESTRICT keys, size_t n, SortDescending,
+                        ThreadPool& pool) const {
+  HWY_DYNAMIC_DISPATCH(ParallelSortF64Desc)(keys, n, pool);
+}
+
+void Sorter::PartialSort(double* HWY_RESTRICT keys, size_t n, size_t k,
+                         SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(PartialSortF64Desc)(keys, n, k, Get<double>());
+}
+
+void Sorter::Select(double* HWY_RESTRICT keys, size_t n, size_t k,
+                    SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(SelectF64Desc)(keys, n, k, Get<double>());
+}
+
+void Sorter::Merge(const double* HWY_RESTRICT a, size_t num_a,
+                   const double* HWY_RESTRICT b, size_t num_b,
+                   double* HWY_RESTRICT out, SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(MergeF64Desc)(a, num_a, b, num_b, out);
+}
+
+void Sorter::Merge(const double* const* runs, const size_t* run_sizes,
+                   size_t num_runs, double* HWY_RESTRICT out,
+                   SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsF64Desc)
+  (runs, run_sizes, num_runs, out, nullptr);
+}
+
+void Sorter::Merge(const double* const* runs, const size_t* run_sizes,
+                   size_t num_runs, double* HWY_RESTRICT out,
+                   double* HWY_RESTRICT scratch, SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsF64Desc)
+  (runs, run_sizes, num_runs, out, scratch);
+}
+
+void Sorter::SortSegments(double* HWY_RESTRICT keys, const size_t* offsets,
+                          size_t num_segments, SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsF64Desc)
+  (keys, offsets, num_segments, Get<double>());
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
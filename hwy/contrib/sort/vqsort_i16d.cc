@@ -22,6 +22,8 @@
 // After foreach_target
 #include "hwy/contrib/sort/traits-inl.h"
 #include "hwy/contrib/sort/vqsort-inl.h"
+#include "hwy/contrib/sort/parallel-inl.h"
+#include "hwy/contrib/sort/radix-inl.h"
 
 HWY_BEFORE_NAMESPACE();
 namespace hwy {
@@ -31,9 +33,57 @@ void SortI16Desc(int16_t* HWY_RESTRICT keys, size_t num,
                  int16_t* HWY_RESTRICT buf) {
   SortTag<int16_t> d;
   detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<int16_t>>> st;
+  if (detail::UseRadixSort(st, num)) {
+    // `buf` is the scratch memory of Sorter, which has room for the counts.
+    return CountingSort(d, st, keys, num, reinterpret_cast<uint32_t*>(buf));
+  }
   Sort(d, st, keys, num, buf);
 }
 
+void ParallelSortI16Desc(int16_t* HWY_RESTRICT keys, size_t num,
+                         ThreadPool& pool) {
+  SortTag<int16_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<int16_t>>> st;
+  ParallelSort(d, st, keys, num, pool);
+}
+
+void PartialSortI16Desc(int16_t* HWY_RESTRICT keys, size_t num, size_t k,
+                        int16_t* HWY_RESTRICT buf) {
+  SortTag<int16_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<int16_t>>> st;
+  PartialSort(d, st, keys, num, k, buf);
+}
+
+void SelectI16Desc(int16_t* HWY_RESTRICT keys, size_t num, size_t k,
+                   int16_t* HWY_RESTRICT buf) {
+  SortTag<int16_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<int16_t>>> st;
+  Select(d, st, keys, num, k, buf);
+}
+
+void MergeI16Desc(const int16_t* HWY_RESTRICT a, size_t num_a,
+                  const int16_t* HWY_RESTRICT b, size_t num_b,
+                  int16_t* HWY_RESTRICT out) {
+  SortTag<int16_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<int16_t>>> st;
+  Merge(d, st, a, num_a, b, num_b, out);
+}
+
+void MergeRunsI16Desc(const int16_t* const* runs, const size_t* run_sizes,
+                      size_t num_runs, int16_t* HWY_RESTRICT out,
+                      int16_t* HWY_RESTRICT scratch) {
+  SortTag<int16_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<int16_t>>> st;
+  MergeRuns(d, st, runs, run_sizes, num_runs, out, scratch);
+}
+
+void SortSegmentsI16Desc(int16_t* HWY_RESTRICT keys, const size_t* offsets,
+                         size_t num_segments, int16_t* HWY_RESTRICT buf) {
+  SortTag<int16_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<int16_t>>> st;
+  SortSegments(d, st, keys, offsets, num_segments, buf);
+}
+
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
 }  // namespace hwy
@@ -43,6 +93,12 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortI16Desc);
+HWY_EXPORT(ParallelSortI16Desc);
+HWY_EXPORT(PartialSortI16Desc);
+HWY_EXPORT(SelectI16Desc);
+HWY_EXPORT(MergeI16Desc);
+HWY_EXPORT(MergeRunsI16Desc);
+HWY_EXPORT(SortSegmentsI16Desc);
 }  // namespace
 
 void Sorter::operator()(int16_t* HWY_RESTRICT keys, size_t n,
@@ -50,5 +106,46 @@ void Sorter::operator()(int16_t* HWY_RESTRICT keys, size_t n,
   HWY_DYNAMIC_DISPATCH(SortI16Desc)(keys, n, Get<int16_t>());
 }
 
+void Sorter::operator()(int16_t* HWY_RESTRICT keys, size_t n, SortDescending,
+                        ThreadPool& pool) const {
+  HWY_DYNAMIC_DISPATCH(ParallelSortI16Desc)(keys, n, pool);
+}
+
+void Sorter::PartialSort(int16_t* HWY_RESTRICT keys, size_t n, size_t k,
+                         SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(PartialSortI16Desc)(keys, n, k, Get<int16_t>());
+}
+
+void Sorter::Select(int16_t* HWY_RESTRICT keys, size_t n, size_t k,
+                    SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(SelectI16Desc)(keys, n, k, Get<int16_t>());
+}
+
+void Sorter::Merge(const int16_t* HWY_RESTRICT a, size_t num_a,
+                   const int16_t* HWY_RESTRICT b, size_t num_b,
+                   int16_t* HWY_RESTRICT out, SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(MergeI16Desc)(a, num_a, b, num_b, out);
+}
+
+void Sorter::Merge(const int16_t* const* runs, const size_t* run_sizes,
+                   size_t num_runs, int16_t* HWY_RESTRICT out,
+                   SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsI16Desc)
+  (runs, run_sizes, num_runs, out, nullptr);
+}
+
+void Sorter::Merge(const int16_t* const* runs, const size_t* run_sizes,
+                   size_t num_runs, int16_t* HWY_RESTRICT out,
+                   int16_t* HWY_RESTRICT scratch, SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsI16Desc)
+  (runs, run_sizes, num_runs, out, scratch);
+}
+
+void Sorter::SortSegments(int16_t* HWY_RESTRICT keys, const size_t* offsets,
+                          size_t num_segments, SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsI16Desc)
+  (keys, offsets, num_segments, Get<int16_t>());
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -22,6 +22,8 @@
 // After foreach_target
 #include "hwy/contrib/sort/traits-inl.h"
 #include "hwy/contrib/sort/vqsort-inl.h"
+#include "hwy/contrib/sort/parallel-inl.h"
+#include "hwy/contrib/sort/radix-inl.h"
 
 HWY_BEFORE_NAMESPACE();
 namespace hwy {
@@ -31,9 +33,54 @@ void SortI32Asc(int32_t* HWY_RESTRICT keys, size_t num,
                 int32_t* HWY_RESTRICT buf) {
   SortTag<int32_t> d;
   detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<int32_t>>> st;
+  if (detail::UseRadixSort(st, num) && RadixSort(d, st, keys, num)) return;
   Sort(d, st, keys, num, buf);
 }
 
+void ParallelSortI32Asc(int32_t* HWY_RESTRICT keys, size_t num,
+                        ThreadPool& pool) {
+  SortTag<int32_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<int32_t>>> st;
+  ParallelSort(d, st, keys, num, pool);
+}
+
+void PartialSortI32Asc(int32_t* HWY_RESTRICT keys, size_t num, size_t k,
+                       int32_t* HWY_RESTRICT buf) {
+  SortTag<int32_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<int32_t>>> st;
+  PartialSort(d, st, keys, num, k, buf);
+}
+
+void SelectI32Asc(int32_t* HWY_RESTRICT keys, size_t num, size_t k,
+                  int32_t* HWY_RESTRICT buf) {
+  SortTag<int32_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<int32_t>>> st;
+  Select(d, st, keys, num, k, buf);
+}
+
+void MergeI32Asc(const int32_t* HWY_RESTRICT a, size_t num_a,
+                 const int32_t* HWY_RESTRICT b, size_t num_b,
+                 int32_t* HWY_RESTRICT out) {
+  SortTag<int32_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<int32_t>>> st;
+  Merge(d, st, a, num_a, b, num_b, out);
+}
+
+void MergeRunsI32Asc(const int32_t* const* runs, const size_t* run_sizes,
+                     size_t num_runs, int32_t* HWY_RESTRICT out,
+                     int32_t* HWY_RESTRICT scratch) {
+  SortTag<int32_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<int32_t>>> st;
+  MergeRuns(d, st, runs, run_sizes, num_runs, out, scratch);
+}
+
+void SortSegmentsI32Asc(int32_t* HWY_RESTRICT keys, const size_t* offsets,
+                        size_t num_segments, int32_t* HWY_RESTRICT buf) {
+  SortTag<int32_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<int32_t>>> st;
+  SortSegments(d, st, keys, offsets, num_segments, buf);
+}
+
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
 }  // namespace hwy
@@ -43,6 +90,12 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortI32Asc);
+HWY_EXPORT(ParallelSortI32Asc);
+HWY_EXPORT(PartialSortI32Asc);
+HWY_EXPORT(SelectI32Asc);
+HWY_EXPORT(MergeI32Asc);
+HWY_EXPORT(MergeRunsI32Asc);
+HWY_EXPORT(SortSegmentsI32Asc);
 }  // namespace
 
 void Sorter::operator()(int32_t* HWY_RESTRICT keys, size_t n,
@@ -50,5 +103,46 @@ void Sorter::operator()(int32_t* HWY_RESTRICT keys, size_t n,
   HWY_DYNAMIC_DISPATCH(SortI32Asc)(keys, n, Get<int32_t>());
 }
 
+void Sorter::operator()(int32_t* HWY_RESTRICT keys, size_t n, SortAscending,
+                        ThreadPool& pool) const {
+  HWY_DYNAMIC_DISPATCH(ParallelSortI32Asc)(keys, n, pool);
+}
+
+void Sorter::PartialSort(int32_t* HWY_RESTRICT keys, size_t n, size_t k,
+                         SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(PartialSortI32Asc)(keys, n, k, Get<int32_t>());
+}
+
+void Sorter::Select(int32_t* HWY_RESTRICT keys, size_t n, size_t k,
+                    SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(SelectI32Asc)(keys, n, k, Get<int32_t>());
+}
+
+void Sorter::Merge(const int32_t* HWY_RESTRICT a, size_t num_a,
+                   const int32_t* HWY_RESTRICT b, size_t num_b,
+                   int32_t* HWY_RESTRICT out, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeI32Asc)(a, num_a, b, num_b, out);
+}
+
+void Sorter::Merge(const int32_t* const* runs, const size_t* run_sizes,
+                   size_t num_runs, int32_t* HWY_RESTRICT out,
+                   SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsI32Asc)
+  (runs, run_sizes, num_runs, out, nullptr);
+}
+
+void Sorter::Merge(const int32_t* const* runs, const size_t* run_sizes,
+                   size_t num_runs, int32_t* HWY_RESTRICT out,
+                   int32_t* HWY_RESTRICT scratch, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsI32Asc)
+  (runs, run_sizes, num_runs, out, scratch);
+}
+
+void Sorter::SortSegments(int32_t* HWY_RESTRICT keys, const size_t* offsets,
+                          size_t num_segments, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsI32Asc)
+  (keys, offsets, num_segments, Get<int32_t>());
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -22,6 +22,8 @@
 // After foreach_target
 #include "hwy/contrib/sort/traits-inl.h"
 #include "hwy/contrib/sort/vqsort-inl.h"
+#include "hwy/contrib/sort/parallel-inl.h"
+#include "hwy/contrib/sort/radix-inl.h"
 
 HWY_BEFORE_NAMESPACE();
 namespace hwy {
@@ -31,9 +33,54 @@ void SortI32Desc(int32_t* HWY_RESTRICT keys, size_t num,
                  int32_t* HWY_RESTRICT buf) {
   SortTag<int32_t> d;
   detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<int32_t>>> st;
+  if (detail::UseRadixSort(st, num) && RadixSort(d, st, keys, num)) return;
   Sort(d, st, keys, num, buf);
 }
 
+void ParallelSortI32Desc(int32_t* HWY_RESTRICT keys, size_t num,
+                         ThreadPool& pool) {
+  SortTag<int32_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<int32_t>>> st;
+  ParallelSort(d, st, keys, num, pool);
+}
+
+void PartialSortI32Desc(int32_t* HWY_RESTRICT keys, size_t num, size_t k,
+                        int32_t* HWY_RESTRICT buf) {
+  SortTag<int32_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<int32_t>>> st;
+  PartialSort(d, st, keys, num, k, buf);
+}
+
+void SelectI32Desc(int32_t* HWY_RESTRICT keys, size_t num, size_t k,
+                   int32_t* HWY_RESTRICT buf) {
+  SortTag<int32_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<int32_t>>> st;
+  Select(d, st, keys, num, k, buf);
+}
+
+void MergeI32Desc(const int32_t* HWY_RESTRICT a, size_t num_a,
+                  const int32_t* HWY_RESTRICT b, size_t num_b,
+                  int32_t* HWY_RESTRICT out) {
+  SortTag<int32_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<int32_t>>> st;
+  Merge(d, st, a, num_a, b, num_b, out);
+}
+
+void MergeRunsI32Desc(const int32_t* const* runs, const size_t* run_sizes,
+                      size_t num_runs, int32_t* HWY_RESTRICT out,
+                      int32_t* HWY_RESTRICT scratch) {
+  SortTag<int32_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<int32_t>>> st;
+  MergeRuns(d, st, runs, run_sizes, num_runs, out, scratch);
+}
+
+void SortSegmentsI32Desc(int32_t* HWY_RESTRICT keys, const size_t* offsets,
+                         size_t num_segments, int32_t* HWY_RESTRICT buf) {
+  SortTag<int32_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<int32_t>>> st;
+  SortSegments(d, st, keys, offsets, num_segments, buf);
+}
+
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
 }  // namespace hwy
@@ -43,6 +90,12 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortI32Desc);
+HWY_EXPORT(ParallelSortI32Desc);
+HWY_EXPORT(PartialSortI32Desc);
+HWY_EXPORT(SelectI32Desc);
+HWY_EXPORT(MergeI32Desc);
+HWY_EXPORT(MergeRunsI32Desc);
+HWY_EXPORT(SortSegmentsI32Desc);
 }  // namespace
 
 void Sorter::operator()(int32_t* HWY_RESTRICT keys, size_t n,
@@ -50,5 +103,46 @@ void Sorter::operator()(int32_t* HWY_RESTRICT keys, size_t n,
   HWY_DYNAMIC_DISPATCH(SortI32Desc)(keys, n, Get<int32_t>());
 }
 
+void Sorter::operator()(int32_t* HWY_RESTRICT keys, size_t n, SortDescending,
+                        ThreadPool& pool) const {
+  HWY_DYNAMIC_DISPATCH(ParallelSortI32Desc)(keys, n, pool);
+}
+
+void Sorter::PartialSort(int32_t* HWY_RESTRICT keys, size_t n, size_t k,
+                         SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(PartialSortI32Desc)(keys, n, k, Get<int32_t>());
+}
+
+void Sorter::Select(int32_t* HWY_RESTRICT keys, size_t n, size_t k,
+                    SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(SelectI32Desc)(keys, n, k, Get<int32_t>());
+}
+
+void Sorter::Merge(const int32_t* HWY_RESTRICT a, size_t num_a,
+                   const int32_t* HWY_RESTRICT b, size_t num_b,
+                   int32_t* HWY_RESTRICT out, SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(MergeI32Desc)(a, num_a, b, num_b, out);
+}
+
+void Sorter::Merge(const int32_t* const* runs, const size_t* run_sizes,
+                   size_t num_runs, int32_t* HWY_RESTRICT out,
+                   SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsI32Desc)
+  (runs, run_sizes, num_runs, out, nullptr);
+}
+
+void Sorter::Merge(const int32_t* const* runs, const size_t* run_sizes,
+                   size_t num_runs, int32_t* HWY_RESTRICT out,
+                   int32_t* HWY_RESTRICT scratch, SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsI32Desc)
+  (runs, run_sizes, num_runs, out, scratch);
+}
+
+void Sorter::SortSegments(int32_t* HWY_RESTRICT keys, const size_t* offsets,
+                          size_t num_segments, SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsI32Desc)
+  (keys, offsets, num_segments, Get<int32_t>());
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -22,6 +22,7 @@
 // After foreach_target
 #include "hwy/contrib/sort/traits-inl.h"
 #include "hwy/contrib/sort/vqsort-inl.h"
+#include "hwy/contrib/sort/parallel-inl.h"
 
 HWY_BEFORE_NAMESPACE();
 namespace hwy {
@@ -34,6 +35,50 @@ void SortI64Asc(int64_t* HWY_RESTRICT keys, size_t num,
   Sort(d, st, keys, num, buf);
 }
 
+void ParallelSortI64Asc(int64_t* HWY_RESTRICT keys, size_t num,
+                        ThreadPool& pool) {
+  SortTag<int64_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<int64_t>>> st;
+  ParallelSort(d, st, keys, num, pool);
+}
+
+void PartialSortI64Asc(int64_t* HWY_RESTRICT keys, size_t num, size_t k,
+                       int64_t* HWY_RESTRICT buf) {
+  SortTag<int64_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<int64_t>>> st;
+  PartialSort(d, st, keys, num, k, buf);
+}
+
+void SelectI64Asc(int64_t* HWY_RESTRICT keys, size_t num, size_t k,
+                  int64_t* HWY_RESTRICT buf) {
+  SortTag<int64_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<int64_t>>> st;
+  Select(d, st, keys, num, k, buf);
+}
+
+void MergeI64Asc(const int64_t* HWY_RESTRICT a, size_t num_a,
+                 const int64_t* HWY_RESTRICT b, size_t num_b,
+                 int64_t* HWY_RESTRICT out) {
+  SortTag<int64_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<int64_t>>> st;
+  Merge(d, st, a, num_a, b, num_b, out);
+}
+
+void MergeRunsI64Asc(const int64_t* const* runs, const size_t* run_sizes,
+                     size_t num_runs, int64_t* HWY_RESTRICT out,
+                     int64_t* HWY_RESTRICT scratch) {
+  SortTag<int64_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<int64_t>>> st;
+  MergeRuns(d, st, runs, run_sizes, num_runs, out, scratch);
+}
+
+void SortSegmentsI64Asc(int64_t* HWY_RESTRICT keys, const size_t* offsets,
+                        size_t num_segments, int64_t* HWY_RESTRICT buf) {
+  SortTag<int64_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<int64_t>>> st;
+  SortSegments(d, st, keys, offsets, num_segments, buf);
+}
+
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
 }  // namespace hwy
@@ -43,6 +88,12 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortI64Asc);
+HWY_EXPORT(ParallelSortI64Asc);
+HWY_EXPORT(PartialSortI64Asc);
+HWY_EXPORT(SelectI64Asc);
+HWY_EXPORT(MergeI64Asc);
+HWY_EXPORT(MergeRunsI64Asc);
+HWY_EXPORT(SortSegmentsI64Asc);
 }  // namespace
 
 void Sorter::operator()(int64_t* HWY_RESTRICT keys, size_t n,
@@ -50,5 +101,46 @@ void Sorter::operator()(int64_t* HWY_RESTRICT keys, size_t n,
   HWY_DYNAMIC_DISPATCH(SortI64Asc)(keys, n, Get<int64_t>());
 }
 
+void Sorter::operator()(int64_t* HWY_RESTRICT keys, size_t n, SortAscending,
+                        ThreadPool& pool) const {
+  HWY_DYNAMIC_DISPATCH(ParallelSortI64Asc)(keys, n, pool);
+}
+
+void Sorter::PartialSort(int64_t* HWY_RESTRICT keys, size_t n, size_t k,
+                         SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(PartialSortI64Asc)(keys, n, k, Get<int64_t>());
+}
+
+void Sorter::Select(int64_t* HWY_RESTRICT keys, size_t n, size_t k,
+                    SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(SelectI64Asc)(keys, n, k, Get<int64_t>());
+}
+
+void Sorter::Merge(const int64_t* HWY_RESTRICT a, size_t num_a,
+                   const int64_t* HWY_RESTRICT b, size_t num_b,
+                   int64_t* HWY_RESTRICT out, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeI64Asc)(a, num_a, b, num_b, out);
+}
+
+void Sorter::Merge(const int64_t* const* runs, const size_t* run_sizes,
+                   size_t num_runs, int64_t* HWY_RESTRICT out,
+                   SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsI64Asc)
+  (runs, run_sizes, num_runs, out, nullptr);
+}
+
+void Sorter::Merge(const int64_t* const* runs, const size_t* run_sizes,
+                   size_t num_runs, int64_t* HWY_RESTRICT out,
+                   int64_t* HWY_RESTRICT scratch, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsI64Asc)
+  (runs, run_sizes, num_runs, out, scratch);
+}
+
+void Sorter::SortSegments(int64_t* HWY_RESTRICT keys, const size_t* offsets,
+                          size_t num_segments, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsI64Asc)
+  (keys, offsets, num_segments, Get<int64_t>());
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -25,6 +25,7 @@
 // After foreach_target
 #include "hwy/contrib/sort/traits128-inl.h"
 #include "hwy/contrib/sort/vqsort-inl.h"
+#include "hwy/contrib/sort/parallel-inl.h"
 
 HWY_BEFORE_NAMESPACE();
 namespace hwy {
@@ -32,18 +33,120 @@ namespace HWY_NAMESPACE {
 
 void SortKV128Asc(uint64_t* HWY_RESTRICT keys, size_t num,
                   uint64_t* HWY_RESTRICT buf) {
-#if VQSORT_ENABLED
   SortTag<uint64_t> d;
   detail::SharedTraits<detail::Traits128<detail::OrderAscendingKV128>> st;
   Sort(d, st, keys, num, buf);
+}
+
+void ParallelSortKV128Asc(uint64_t* HWY_RESTRICT keys, size_t num,
+                          ThreadPool& pool) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::Traits128<detail::OrderAscendingKV128>> st;
+  ParallelSort(d, st, keys, num, pool);
+}
+
+void PartialSortKV128Asc(uint64_t* HWY_RESTRICT keys, size_t num, size_t k,
+                         uint64_t* HWY_RESTRICT buf) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::Traits128<detail::OrderAscendingKV128>> st;
+  PartialSort(d, st, keys, num, k, buf);
+}
+
+void SelectKV128Asc(uint64_t* HWY_RESTRICT keys, size_t num, size_t k,
+                    uint64_t* HWY_RESTRICT buf) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::Traits128<detail::OrderAscendingKV128>> st;
+  Select(d, st, keys, num, k, buf);
+}
+
+void MergeKV128Asc(const uint64_t* HWY_RESTRICT a, size_t num_a,
+                   const uint64_t* HWY_RESTRICT b, size_t num_b,
+                   uint64_t* HWY_RESTRICT out) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::Traits128<detail::OrderAscendingKV128>> st;
+  Merge(d, st, a, num_a, b, num_b, out);
+}
+
+void MergeRunsKV128Asc(const uint64_t* const* runs, const size_t* run_sizes,
+                       size_t num_runs, uint64_t* HWY_RESTRICT out,
+                       uint64_t* HWY_RESTRICT scratch) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::Traits128<detail::OrderAscendingKV128>> st;
+  MergeRuns(d, st, runs, run_sizes, num_runs, out, scratch);
+}
+
+void SortSegmentsKV128Asc(uint64_t* HWY_RESTRICT keys, const size_t* offsets,
+                          size_t num_segments, uint64_t* HWY_RESTRICT buf) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::Traits128<detail::OrderAscendingKV128>> st;
+  SortSegments(d, st, keys, offsets, num_segments, buf);
+}
+
+void ArgsortU64Asc(const uint64_t* HWY_RESTRICT keys, size_t num,
+                   uint64_t* HWY_RESTRICT indices, uint64_t* HWY_RESTRICT buf) {
+  detail::SharedTraits<detail::Traits128<detail::OrderAscending128>> st;
+  Argsort(SortAscending(), st, keys, num, indices, buf);
+}
+
+void ArgsortI64Asc(const int64_t* HWY_RESTRICT keys, size_t num,
+                   uint64_t* HWY_RESTRICT indices, uint64_t* HWY_RESTRICT buf) {
+  detail::SharedTraits<detail::Traits128<detail::OrderAscending128>> st;
+  Argsort(SortAscending(), st, keys, num, indices, buf);
+}
+
+void ArgsortF64Asc(const double* HWY_RESTRICT keys, size_t num,
+                   uint64_t* HWY_RESTRICT indices, uint64_t* HWY_RESTRICT buf) {
+#if HWY_HAVE_FLOAT64
+  detail::SharedTraits<detail::Traits128<detail::OrderAscending128>> st;
+  Argsort(SortAscending(), st, keys, num, indices, buf);
 #else
   (void) keys;
   (void) num;
+  (void) indices;
   (void) buf;
   HWY_ASSERT(0);
 #endif
 }
 
+void SortRecordsU64Asc(void* HWY_RESTRICT records, size_t num,
+                       size_t record_bytes, const uint64_t* first_key,
+                       uint64_t* HWY_RESTRICT buf) {
+  detail::SharedTraits<detail::Traits128<detail::OrderAscending128>> st;
+  SortRecords(SortAscending(), st, static_cast<uint8_t*>(records), num,
+              record_bytes, first_key, buf);
+}
+
+void SortRecordsI64Asc(void* HWY_RESTRICT records, size_t num,
+                       size_t record_bytes, const int64_t* first_key,
+                       uint64_t* HWY_RESTRICT buf) {
+  detail::SharedTraits<detail::Traits128<detail::OrderAscending128>> st;
+  SortRecords(SortAscending(), st, static_cast<uint8_t*>(records), num,
+              record_bytes, first_key, buf);
+}
+
+void SortRecordsF64Asc(void* HWY_RESTRICT records, size_t num,
+                       size_t record_bytes, const double* first_key,
+                       uint64_t* HWY_RESTRICT buf) {
+#if HWY_HAVE_FLOAT64
+  detail::SharedTraits<detail::Traits128<detail::OrderAscending128>> st;
+  SortRecords(SortAscending(), st, static_cast<uint8_t*>(records), num,
+              record_bytes, first_key, buf);
+#else
+  (void) records;
+  (void) num;
+  (void) record_bytes;
+  (void) first_key;
+  (void) buf;
+  HWY_ASSERT(0);
+#endif
+}
+
+void StableSortKV128Asc(uint64_t* HWY_RESTRICT keys, size_t num,
+                        uint64_t* HWY_RESTRICT buf) {
+  detail::SharedTraits<detail::Traits128<detail::OrderAscending128>> st;
+  StableSortKV128(SortAscending(), st, keys, num, buf);
+}
+
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
 }  // namespace hwy
@@ -53,6 +156,19 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortKV128Asc);
+HWY_EXPORT(ParallelSortKV128Asc);
+HWY_EXPORT(PartialSortKV128Asc);
+HWY_EXPORT(SelectKV128Asc);
+HWY_EXPORT(MergeKV128Asc);
+HWY_EXPORT(MergeRunsKV128Asc);
+HWY_EXPORT(SortSegmentsKV128Asc);
+HWY_EXPORT(ArgsortU64Asc);
+HWY_EXPORT(ArgsortI64Asc);
+HWY_EXPORT(ArgsortF64Asc);
+HWY_EXPORT(SortRecordsU64Asc);
+HWY_EXPORT(SortRecordsI64Asc);
+HWY_EXPORT(SortRecordsF64Asc);
+HWY_EXPORT(StableSortKV128Asc);
 }  // namespace
 
 void Sorter::operator()(K64V64* HWY_RESTRICT keys, size_t n,
@@ -61,5 +177,96 @@ void Sorter::operator()(K64V64* HWY_RESTRICT keys, size_t n,
   (reinterpret_cast<uint64_t*>(keys), n * 2, Get<uint64_t>());
 }
 
+void Sorter::operator()(K64V64* HWY_RESTRICT keys, size_t n, SortAscending,
+                        ThreadPool& pool) const {
+  HWY_DYNAMIC_DISPATCH(ParallelSortKV128Asc)
+  (reinterpret_cast<uint64_t*>(keys), n * 2, pool);
+}
+
+void Sorter::PartialSort(K64V64* HWY_RESTRICT keys, size_t n, size_t k,
+                         SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(PartialSortKV128Asc)
+  (reinterpret_cast<uint64_t*>(keys), n * 2, k * 2, Get<uint64_t>());
+}
+
+void Sorter::Select(K64V64* HWY_RESTRICT keys, size_t n, size_t k,
+                    SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(SelectKV128Asc)
+  (reinterpret_cast<uint64_t*>(keys), n * 2, k * 2, Get<uint64_t>());
+}
+
+void Sorter::Argsort(const uint64_t* HWY_RESTRICT keys, size_t n,
+                     uint64_t* HWY_RESTRICT indices, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(ArgsortU64Asc)(keys, n, indices, Get<uint64_t>());
+}
+
+void Sorter::Argsort(const int64_t* HWY_RESTRICT keys, size_t n,
+                     uint64_t* HWY_RESTRICT indices, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(ArgsortI64Asc)(keys, n, indices, Get<uint64_t>());
+}
+
+void Sorter::Argsort(const double* HWY_RESTRICT keys, size_t n,
+                     uint64_t* HWY_RESTRICT indices, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(ArgsortF64Asc)(keys, n, indices, Get<uint64_t>());
+}
+
+void Sorter::SortRecords(void* HWY_RESTRICT records, size_t n,
+                         size_t record_bytes, const uint64_t* first_key,
+                         SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(SortRecordsU64Asc)
+  (records, n, record_bytes, first_key, Get<uint64_t>());
+}
+
+void Sorter::SortRecords(void* HWY_RESTRICT records, size_t n,
+                         size_t record_bytes, const int64_t* first_key,
+                         SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(SortRecordsI64Asc)
+  (records, n, record_bytes, first_key, Get<uint64_t>());
+}
+
+void Sorter::SortRecords(void* HWY_RESTRICT records, size_t n,
+                         size_t record_bytes, const double* first_key,
+                         SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(SortRecordsF64Asc)
+  (records, n, record_bytes, first_key, Get<uint64_t>());
+}
+
+void Sorter::StableSort(K64V64* HWY_RESTRICT keys, size_t n,
+                        SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(StableSortKV128Asc)
+  (reinterpret_cast<uint64_t*>(keys), n * 2, Get<uint64_t>());
+}
+
+void Sorter::Merge(const K64V64* HWY_RESTRICT a, size_t num_a,
+                   const K64V64* HWY_RESTRICT b, size_t num_b,
+                   K64V64* HWY_RESTRICT out, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeKV128Asc)
+  (reinterpret_cast<const uint64_t*>(a), num_a * 2,
+   reinterpret_cast<const uint64_t*>(b), num_b * 2,
+   reinterpret_cast<uint64_t*>(out));
+}
+
+void Sorter::Merge(const K64V64* const* runs, const size_t* run_sizes,
+                   size_t num_runs, K64V64* HWY_RESTRICT out,
+                   SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsKV128Asc)
+  (reinterpret_cast<const uint64_t* const*>(runs), run_sizes, num_runs,
+   reinterpret_cast<uint64_t*>(out), nullptr);
+}
+
+void Sorter::Merge(const K64V64* const* runs, const size_t* run_sizes,
+                   size_t num_runs, K64V64* HWY_RESTRICT out,
+                   K64V64* HWY_RESTRICT scratch, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsKV128Asc)
+  (reinterpret_cast<const uint64_t* const*>(runs), run_sizes, num_runs,
+   reinterpret_cast<uint64_t*>(out), reinterpret_cast<uint64_t*>(scratch));
+}
+
+void Sorter::SortSegments(K64V64* HWY_RESTRICT keys, const size_t* offsets,
+                          size_t num_segments, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsKV128Asc)
+  (reinterpret_cast<uint64_t*>(keys), offsets, num_segments, Get<uint64_t>());
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
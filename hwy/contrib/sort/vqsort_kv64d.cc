@@ -25,6 +25,7 @@
 // After foreach_target
 #include "hwy/contrib/sort/traits-inl.h"
 #include "hwy/contrib/sort/vqsort-inl.h"
+#include "hwy/contrib/sort/parallel-inl.h"
 
 HWY_BEFORE_NAMESPACE();
 namespace hwy {
@@ -32,16 +33,104 @@ namespace HWY_NAMESPACE {
 
 void SortKV64Desc(uint64_t* HWY_RESTRICT keys, size_t num,
                   uint64_t* HWY_RESTRICT buf) {
-#if VQSORT_ENABLED
   SortTag<uint64_t> d;
   detail::SharedTraits<detail::TraitsLane<detail::OrderDescendingKV64>> st;
   Sort(d, st, keys, num, buf);
-#else
-  (void) keys;
-  (void) num;
-  (void) buf;
-  HWY_ASSERT(0);
-#endif
+}
+
+void ParallelSortKV64Desc(uint64_t* HWY_RESTRICT keys, size_t num,
+                          ThreadPool& pool) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescendingKV64>> st;
+  ParallelSort(d, st, keys, num, pool);
+}
+
+void PartialSortKV64Desc(uint64_t* HWY_RESTRICT keys, size_t num, size_t k,
+                         uint64_t* HWY_RESTRICT buf) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescendingKV64>> st;
+  PartialSort(d, st, keys, num, k, buf);
+}
+
+void SelectKV64Desc(uint64_t* HWY_RESTRICT keys, size_t num, size_t k,
+                    uint64_t* HWY_RESTRICT buf) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescendingKV64>> st;
+  Select(d, st, keys, num, k, buf);
+}
+
+void MergeKV64Desc(const uint64_t* HWY_RESTRICT a, size_t num_a,
+                   const uint64_t* HWY_RESTRICT b, size_t num_b,
+                   uint64_t* HWY_RESTRICT out) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescendingKV64>> st;
+  Merge(d, st, a, num_a, b, num_b, out);
+}
+
+void MergeRunsKV64Desc(const uint64_t* const* runs, const size_t* run_sizes,
+                       size_t num_runs, uint64_t* HWY_RESTRICT out,
+                       uint64_t* HWY_RESTRICT scratch) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescendingKV64>> st;
+  MergeRuns(d, st, runs, run_sizes, num_runs, out, scratch);
+}
+
+void SortSegmentsKV64Desc(uint64_t* HWY_RESTRICT keys, const size_t* offsets,
+                          size_t num_segments, uint64_t* HWY_RESTRICT buf) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescendingKV64>> st;
+  SortSegments(d, st, keys, offsets, num_segments, buf);
+}
+
+void ArgsortU32Desc(const uint32_t* HWY_RESTRICT keys, size_t num,
+                    uint32_t* HWY_RESTRICT indices,
+                    uint64_t* HWY_RESTRICT buf) {
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint64_t>>> st;
+  Argsort(SortDescending(), st, keys, num, indices, buf);
+}
+
+void ArgsortI32Desc(const int32_t* HWY_RESTRICT keys, size_t num,
+                    uint32_t* HWY_RESTRICT indices,
+                    uint64_t* HWY_RESTRICT buf) {
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint64_t>>> st;
+  Argsort(SortDescending(), st, keys, num, indices, buf);
+}
+
+void ArgsortF32Desc(const float* HWY_RESTRICT keys, size_t num,
+                    uint32_t* HWY_RESTRICT indices,
+                    uint64_t* HWY_RESTRICT buf) {
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint64_t>>> st;
+  Argsort(SortDescending(), st, keys, num, indices, buf);
+}
+
+void SortRecordsU32Desc(void* HWY_RESTRICT records, size_t num,
+                        size_t record_bytes, const uint32_t* first_key,
+                        uint64_t* HWY_RESTRICT buf) {
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint64_t>>> st;
+  SortRecords(SortDescending(), st, static_cast<uint8_t*>(records), num,
+              record_bytes, first_key, buf);
+}
+
+void SortRecordsI32Desc(void* HWY_RESTRICT records, size_t num,
+                        size_t record_bytes, const int32_t* first_key,
+                        uint64_t* HWY_RESTRICT buf) {
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint64_t>>> st;
+  SortRecords(SortDescending(), st, static_cast<uint8_t*>(records), num,
+              record_bytes, first_key, buf);
+}
+
+void SortRecordsF32Desc(void* HWY_RESTRICT records, size_t num,
+                        size_t record_bytes, const float* first_key,
+                        uint64_t* HWY_RESTRICT buf) {
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint64_t>>> st;
+  SortRecords(SortDescending(), st, static_cast<uint8_t*>(records), num,
+              record_bytes, first_key, buf);
+}
+
+void StableSortKV64Desc(uint64_t* HWY_RESTRICT keys, size_t num,
+                        uint64_t* HWY_RESTRICT buf) {
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint64_t>>> st;
+  StableSortKV64(SortDescending(), st, keys, num, buf);
 }
 
 // NOLINTNEXTLINE(google-readability-namespace-comments)
@@ -53,6 +142,19 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortKV64Desc);
+HWY_EXPORT(ParallelSortKV64Desc);
+HWY_EXPORT(PartialSortKV64Desc);
+HWY_EXPORT(SelectKV64Desc);
+HWY_EXPORT(MergeKV64Desc);
+HWY_EXPORT(MergeRunsKV64Desc);
+HWY_EXPORT(SortSegmentsKV64Desc);
+HWY_EXPORT(ArgsortU32Desc);
+HWY_EXPORT(ArgsortI32Desc);
+HWY_EXPORT(ArgsortF32Desc);
+HWY_EXPORT(SortRecordsU32Desc);
+HWY_EXPORT(SortRecordsI32Desc);
+HWY_EXPORT(SortRecordsF32Desc);
+HWY_EXPORT(StableSortKV64Desc);
 }  // namespace
 
 void Sorter::operator()(K32V32* HWY_RESTRICT keys, size_t n,
@@ -61,5 +163,96 @@ void Sorter::operator()(K32V32* HWY_RESTRICT keys, size_t n,
   (reinterpret_cast<uint64_t*>(keys), n, Get<uint64_t>());
 }
 
+void Sorter::operator()(K32V32* HWY_RESTRICT keys, size_t n, SortDescending,
+                        ThreadPool& pool) const {
+  HWY_DYNAMIC_DISPATCH(ParallelSortKV64Desc)
+  (reinterpret_cast<uint64_t*>(keys), n, pool);
+}
+
+void Sorter::PartialSort(K32V32* HWY_RESTRICT keys, size_t n, size_t k,
+                         SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(PartialSortKV64Desc)
+  (reinterpret_cast<uint64_t*>(keys), n, k, Get<uint64_t>());
+}
+
+void Sorter::Select(K32V32* HWY_RESTRICT keys, size_t n, size_t k,
+                    SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(SelectKV64Desc)
+  (reinterpret_cast<uint64_t*>(keys), n, k, Get<uint64_t>());
+}
+
+void Sorter::Argsort(const uint32_t* HWY_RESTRICT keys, size_t n,
+                     uint32_t* HWY_RESTRICT indices, SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(ArgsortU32Desc)(keys, n, indices, Get<uint64_t>());
+}
+
+void Sorter::Argsort(const int32_t* HWY_RESTRICT keys, size_t n,
+                     uint32_t* HWY_RESTRICT indices, SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(ArgsortI32Desc)(keys, n, indices, Get<uint64_t>());
+}
+
+void Sorter::Argsort(const float* HWY_RESTRICT keys, size_t n,
+                     uint32_t* HWY_RESTRICT indices, SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(ArgsortF32Desc)(keys, n, indices, Get<uint64_t>());
+}
+
+void Sorter::SortRecords(void* HWY_RESTRICT records, size_t n,
+                         size_t record_bytes, const uint32_t* first_key,
+                         SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(SortRecordsU32Desc)
+  (records, n, record_bytes, first_key, Get<uint64_t>());
+}
+
+void Sorter::SortRecords(void* HWY_RESTRICT records, size_t n,
+                         size_t record_bytes, const int32_t* first_key,
+                         SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(SortRecordsI32Desc)
+  (records, n, record_bytes, first_key, Get<uint64_t>());
+}
+
+void Sorter::SortRecords(void* HWY_RESTRICT records, size_t n,
+                         size_t record_bytes, const float* first_key,
+                         SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(SortRecordsF32Desc)
+  (records, n, record_bytes, first_key, Get<uint64_t>());
+}
+
+void Sorter::StableSort(K32V32* HWY_RESTRICT keys, size_t n,
+                        SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(StableSortKV64Desc)
+  (reinterpret_cast<uint64_t*>(keys), n, Get<uint64_t>());
+}
+
+void Sorter::Merge(const K32V32* HWY_RESTRICT a, size_t num_a,
+                   const K32V32* HWY_RESTRICT b, size_t num_b,
+                   K32V32* HWY_RESTRICT out, SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(MergeKV64Desc)
+  (reinterpret_cast<const uint64_t*>(a), num_a,
+   reinterpret_cast<const uint64_t*>(b), num_b,
+   reinterpret_cast<uint64_t*>(out));
+}
+
+void Sorter::Merge(const K32V32* const* runs, const size_t* run_sizes,
+                   size_t num_runs, K32V32* HWY_RESTRICT out,
+                   SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsKV64Desc)
+  (reinterpret_cast<const uint64_t* const*>(runs), run_sizes, num_runs,
+   reinterpret_cast<uint64_t*>(out), nullptr);
+}
+
+void Sorter::Merge(const K32V32* const* runs, const size_t* run_sizes,
+                   size_t num_runs, K32V32* HWY_RESTRICT out,
+                   K32V32* HWY_RESTRICT scratch, SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsKV64Desc)
+  (reinterpret_cast<const uint64_t* const*>(runs), run_sizes, num_runs,
+   reinterpret_cast<uint64_t*>(out), reinterpret_cast<uint64_t*>(scratch));
+}
+
+void Sorter::SortSegments(K32V32* HWY_RESTRICT keys, const size_t* offsets,
+                          size_t num_segments, SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsKV64Desc)
+  (reinterpret_cast<uint64_t*>(keys), offsets, num_segments, Get<uint64_t>());
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
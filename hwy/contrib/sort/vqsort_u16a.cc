@@ -22,6 +22,8 @@
 // After foreach_target
 #include "hwy/contrib/sort/traits-inl.h"
 #include "hwy/contrib/sort/vqsort-inl.h"
+#include "hwy/contrib/sort/parallel-inl.h"
+#include "hwy/contrib/sort/radix-inl.h"
 
 HWY_BEFORE_NAMESPACE();
 namespace hwy {
@@ -31,9 +33,57 @@ void SortU16Asc(uint16_t* HWY_RESTRICT keys, size_t num,
                 uint16_t* HWY_RESTRICT buf) {
   SortTag<uint16_t> d;
   detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint16_t>>> st;
+  if (detail::UseRadixSort(st, num)) {
+    // `buf` is the scratch memory of Sorter, which has room for the counts.
+    return CountingSort(d, st, keys, num, reinterpret_cast<uint32_t*>(buf));
+  }
   Sort(d, st, keys, num, buf);
 }
 
+void ParallelSortU16Asc(uint16_t* HWY_RESTRICT keys, size_t num,
+                        ThreadPool& pool) {
+  SortTag<uint16_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint16_t>>> st;
+  ParallelSort(d, st, keys, num, pool);
+}
+
+void PartialSortU16Asc(uint16_t* HWY_RESTRICT keys, size_t num, size_t k,
+                       uint16_t* HWY_RESTRICT buf) {
+  SortTag<uint16_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint16_t>>> st;
+  PartialSort(d, st, keys, num, k, buf);
+}
+
+void SelectU16Asc(uint16_t* HWY_RESTRICT keys, size_t num, size_t k,
+                  uint16_t* HWY_RESTRICT buf) {
+  SortTag<uint16_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint16_t>>> st;
+  Select(d, st, keys, num, k, buf);
+}
+
+void MergeU16Asc(const uint16_t* HWY_RESTRICT a, size_t num_a,
+                 const uint16_t* HWY_RESTRICT b, size_t num_b,
+                 uint16_t* HWY_RESTRICT out) {
+  SortTag<uint16_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint16_t>>> st;
+  Merge(d, st, a, num_a, b, num_b, out);
+}
+
+void MergeRunsU16Asc(const uint16_t* const* runs, const size_t* run_sizes,
+                     size_t num_runs, uint16_t* HWY_RESTRICT out,
+                     uint16_t* HWY_RESTRICT scratch) {
+  SortTag<uint16_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint16_t>>> st;
+  MergeRuns(d, st, runs, run_sizes, num_runs, out, scratch);
+}
+
+void SortSegmentsU16Asc(uint16_t* HWY_RESTRICT keys, const size_t* offsets,
+                        size_t num_segments, uint16_t* HWY_RESTRICT buf) {
+  SortTag<uint16_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint16_t>>> st;
+  SortSegments(d, st, keys, offsets, num_segments, buf);
+}
+
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
 }  // namespace hwy
@@ -43,6 +93,12 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortU16Asc);
+HWY_EXPORT(ParallelSortU16Asc);
+HWY_EXPORT(PartialSortU16Asc);
+HWY_EXPORT(SelectU16Asc);
+HWY_EXPORT(MergeU16Asc);
+HWY_EXPORT(MergeRunsU16Asc);
+HWY_EXPORT(SortSegmentsU16Asc);
 }  // namespace
 
 void Sorter::operator()(uint16_t* HWY_RESTRICT keys, size_t n,
@@ -50,5 +106,46 @@ void Sorter::operator()(uint16_t* HWY_RESTRICT keys, size_t n,
   HWY_DYNAMIC_DISPATCH(SortU16Asc)(keys, n, Get<uint16_t>());
 }
 
+void Sorter::operator()(uint16_t* HWY_RESTRICT keys, size_t n, SortAscending,
+                        ThreadPool& pool) const {
+  HWY_DYNAMIC_DISPATCH(ParallelSortU16Asc)(keys, n, pool);
+}
+
+void Sorter::PartialSort(uint16_t* HWY_RESTRICT keys, size_t n, size_t k,
+                         SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(PartialSortU16Asc)(keys, n, k, Get<uint16_t>());
+}
+
+void Sorter::Select(uint16_t* HWY_RESTRICT keys, size_t n, size_t k,
+                    SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(SelectU16Asc)(keys, n, k, Get<uint16_t>());
+}
+
+void Sorter::Merge(const uint16_t* HWY_RESTRICT a, size_t num_a,
+                   const uint16_t* HWY_RESTRICT b, size_t num_b,
+                   uint16_t* HWY_RESTRICT out, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeU16Asc)(a, num_a, b, num_b, out);
+}
+
+void Sorter::Merge(const uint16_t* const* runs, const size_t* run_sizes,
+                   size_t num_runs, uint16_t* HWY_RESTRICT out,
+                   SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsU16Asc)
+  (runs, run_sizes, num_runs, out, nullptr);
+}
+
+void Sorter::Merge(const uint16_t* const* runs, const size_t* run_sizes,
+                   size_t num_runs, uint16_t* HWY_RESTRICT out,
+                   uint16_t* HWY_RESTRICT scratch, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsU16Asc)
+  (runs, run_sizes, num_runs, out, scratch);
+}
+
+void Sorter::SortSegments(uint16_t* HWY_RESTRICT keys, const size_t* offsets,
+                          size_t num_segments, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsU16Asc)
+  (keys, offsets, num_segments, Get<uint16_t>());
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -22,6 +22,8 @@
 // After foreach_target
 #include "hwy/contrib/sort/traits-inl.h"
 #include "hwy/contrib/sort/vqsort-inl.h"
+#include "hwy/contrib/sort/parallel-inl.h"
+#include "hwy/contrib/sort/radix-inl.h"
 
 HWY_BEFORE_NAMESPACE();
 namespace hwy {
@@ -31,9 +33,54 @@ void SortU32Asc(uint32_t* HWY_RESTRICT keys, size_t num,
                 uint32_t* HWY_RESTRICT buf) {
   SortTag<uint32_t> d;
   detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint32_t>>> st;
+  if (detail::UseRadixSort(st, num) && RadixSort(d, st, keys, num)) return;
   Sort(d, st, keys, num, buf);
 }
 
+void ParallelSortU32Asc(uint32_t* HWY_RESTRICT keys, size_t num,
+                        ThreadPool& pool) {
+  SortTag<uint32_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint32_t>>> st;
+  ParallelSort(d, st, keys, num, pool);
+}
+
+void PartialSortU32Asc(uint32_t* HWY_RESTRICT keys, size_t num, size_t k,
+                       uint32_t* HWY_RESTRICT buf) {
+  SortTag<uint32_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint32_t>>> st;
+  PartialSort(d, st, keys, num, k, buf);
+}
+
+void SelectU32Asc(uint32_t* HWY_RESTRICT keys, size_t num, size_t k,
+                  uint32_t* HWY_RESTRICT buf) {
+  SortTag<uint32_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint32_t>>> st;
+  Select(d, st, keys, num, k, buf);
+}
+
+void MergeU32Asc(const uint32_t* HWY_RESTRICT a, size_t num_a,
+                 const uint32_t* HWY_RESTRICT b, size_t num_b,
+                 uint32_t* HWY_RESTRICT out) {
+  SortTag<uint32_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint32_t>>> st;
+  Merge(d, st, a, num_a, b, num_b, out);
+}
+
+void MergeRunsU32Asc(const uint32_t* const* runs, const size_t* run_sizes,
+                     size_t num_runs, uint32_t* HWY_RESTRICT out,
+                     uint32_t* HWY_RESTRICT scratch) {
+  SortTag<uint32_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint32_t>>> st;
+  MergeRuns(d, st, runs, run_sizes, num_runs, out, scratch);
+}
+
+void SortSegmentsU32Asc(uint32_t* HWY_RESTRICT keys, const size_t* offsets,
+                        size_t num_segments, uint32_t* HWY_RESTRICT buf) {
+  SortTag<uint32_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint32_t>>> st;
+  SortSegments(d, st, keys, offsets, num_segments, buf);
+}
+
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
 }  // namespace hwy
@@ -43,6 +90,12 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortU32Asc);
+HWY_EXPORT(ParallelSortU32Asc);
+HWY_EXPORT(PartialSortU32Asc);
+HWY_EXPORT(SelectU32Asc);
+HWY_EXPORT(MergeU32Asc);
+HWY_EXPORT(MergeRunsU32Asc);
+HWY_EXPORT(SortSegmentsU32Asc);
 }  // namespace
 
 void Sorter::operator()(uint32_t* HWY_RESTRICT keys, size_t n,
@@ -50,5 +103,46 @@ void Sorter::operator()(uint32_t* HWY_RESTRICT keys, size_t n,
   HWY_DYNAMIC_DISPATCH(SortU32Asc)(keys, n, Get<uint32_t>());
 }
 
+void Sorter::operator()(uint32_t* HWY_RESTRICT keys, size_t n, SortAscending,
+                        ThreadPool& pool) const {
+  HWY_DYNAMIC_DISPATCH(ParallelSortU32Asc)(keys, n, pool);
+}
+
+void Sorter::PartialSort(uint32_t* HWY_RESTRICT keys, size_t n, size_t k,
+                         SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(PartialSortU32Asc)(keys, n, k, Get<uint32_t>());
+}
+
+void Sorter::Select(uint32_t* HWY_RESTRICT keys, size_t n, size_t k,
+                    SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(SelectU32Asc)(keys, n, k, Get<uint32_t>());
+}
+
+void Sorter::Merge(const uint32_t* HWY_RESTRICT a, size_t num_a,
+                   const uint32_t* HWY_RESTRICT b, size_t num_b,
+                   uint32_t* HWY_RESTRICT out, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeU32Asc)(a, num_a, b, num_b, out);
+}
+
+void Sorter::Merge(const uint32_t* const* runs, const size_t* run_sizes,
+                   size_t num_runs, uint32_t* HWY_RESTRICT out,
+                   SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsU32Asc)
+  (runs, run_sizes, num_runs, out, nullptr);
+}
+
+void Sorter::Merge(const uint32_t* const* runs, const size_t* run_sizes,
+                   size_t num_runs, uint32_t* HWY_RESTRICT out,
+                   uint32_t* HWY_RESTRICT scratch, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsU32Asc)
+  (runs, run_sizes, num_runs, out, scratch);
+}
+
+void Sorter::SortSegments(uint32_t* HWY_RESTRICT keys, const size_t* offsets,
+                          size_t num_segments, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsU32Asc)
+  (keys, offsets, num_segments, Get<uint32_t>());
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -22,6 +22,7 @@
 // After foreach_target
 #include "hwy/contrib/sort/traits-inl.h"
 #include "hwy/contrib/sort/vqsort-inl.h"
+#include "hwy/contrib/sort/parallel-inl.h"
 
 HWY_BEFORE_NAMESPACE();
 namespace hwy {
@@ -34,6 +35,50 @@ void SortU64Asc(uint64_t* HWY_RESTRICT keys, size_t num,
   Sort(d, st, keys, num, buf);
 }
 
+void ParallelSortU64Asc(uint64_t* HWY_RESTRICT keys, size_t num,
+                        ThreadPool& pool) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint64_t>>> st;
+  ParallelSort(d, st, keys, num, pool);
+}
+
+void PartialSortU64Asc(uint64_t* HWY_RESTRICT keys, size_t num, size_t k,
+                       uint64_t* HWY_RESTRICT buf) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint64_t>>> st;
+  PartialSort(d, st, keys, num, k, buf);
+}
+
+void SelectU64Asc(uint64_t* HWY_RESTRICT keys, size_t num, size_t k,
+                  uint64_t* HWY_RESTRICT buf) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint64_t>>> st;
+  Select(d, st, keys, num, k, buf);
+}
+
+void MergeU64Asc(const uint64_t* HWY_RESTRICT a, size_t num_a,
+                 const uint64_t* HWY_RESTRICT b, size_t num_b,
+                 uint64_t* HWY_RESTRICT out) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint64_t>>> st;
+  Merge(d, st, a, num_a, b, num_b, out);
+}
+
+void MergeRunsU64Asc(const uint64_t* const* runs, const size_t* run_sizes,
+                     size_t num_runs, uint64_t* HWY_RESTRICT out,
+                     uint64_t* HWY_RESTRICT scratch) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint64_t>>> st;
+  MergeRuns(d, st, runs, run_sizes, num_runs, out, scratch);
+}
+
+void SortSegmentsU64Asc(uint64_t* HWY_RESTRICT keys, const size_t* offsets,
+                        size_t num_segments, uint64_t* HWY_RESTRICT buf) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderAscending<uint64_t>>> st;
+  SortSegments(d, st, keys, offsets, num_segments, buf);
+}
+
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
 }  // namespace hwy
@@ -43,6 +88,12 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortU64Asc);
+HWY_EXPORT(ParallelSortU64Asc);
+HWY_EXPORT(PartialSortU64Asc);
+HWY_EXPORT(SelectU64Asc);
+HWY_EXPORT(MergeU64Asc);
+HWY_EXPORT(MergeRunsU64Asc);
+HWY_EXPORT(SortSegmentsU64Asc);
 }  // namespace
 
 void Sorter::operator()(uint64_t* HWY_RESTRICT keys, size_t n,
@@ -50,5 +101,46 @@ void Sorter::operator()(uint64_t* HWY_RESTRICT keys, size_t n,
   HWY_DYNAMIC_DISPATCH(SortU64Asc)(keys, n, Get<uint64_t>());
 }
 
+void Sorter::operator()(uint64_t* HWY_RESTRICT keys, size_t n, SortAscending,
+                        ThreadPool& pool) const {
+  HWY_DYNAMIC_DISPATCH(ParallelSortU64Asc)(keys, n, pool);
+}
+
+void Sorter::PartialSort(uint64_t* HWY_RESTRICT keys, size_t n, size_t k,
+                         SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(PartialSortU64Asc)(keys, n, k, Get<uint64_t>());
+}
+
+void Sorter::Select(uint64_t* HWY_RESTRICT keys, size_t n, size_t k,
+                    SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(SelectU64Asc)(keys, n, k, Get<uint64_t>());
+}
+
+void Sorter::Merge(const uint64_t* HWY_RESTRICT a, size_t num_a,
+                   const uint64_t* HWY_RESTRICT b, size_t num_b,
+                   uint64_t* HWY_RESTRICT out, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeU64Asc)(a, num_a, b, num_b, out);
+}
+
+void Sorter::Merge(const uint64_t* const* runs, const size_t* run_sizes,
+                   size_t num_runs, uint64_t* HWY_RESTRICT out,
+                   SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsU64Asc)
+  (runs, run_sizes, num_runs, out, nullptr);
+}
+
+void Sorter::Merge(const uint64_t* const* runs, const size_t* run_sizes,
+                   size_t num_runs, uint64_t* HWY_RESTRICT out,
+                   uint64_t* HWY_RESTRICT scratch, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsU64Asc)
+  (runs, run_sizes, num_runs, out, scratch);
+}
+
+void Sorter::SortSegments(uint64_t* HWY_RESTRICT keys, const size_t* offsets,
+                          size_t num_segments, SortAscending) const {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsU64Asc)
+  (keys, offsets, num_segments, Get<uint64_t>());
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
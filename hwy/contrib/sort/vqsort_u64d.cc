@@ -22,6 +22,7 @@
 // After foreach_target
 #include "hwy/contrib/sort/traits-inl.h"
 #include "hwy/contrib/sort/vqsort-inl.h"
+#include "hwy/contrib/sort/parallel-inl.h"
 
 HWY_BEFORE_NAMESPACE();
 namespace hwy {
@@ -35,6 +36,56 @@ void SortU64Desc(uint64_t* HWY_RESTRICT keys, size_t num,
   Sort(d, st, keys, num, buf);
 }
 
+void ParallelSortU64Desc(uint64_t* HWY_RESTRICT keys, size_t num,
+                         ThreadPool& pool) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<uint64_t>>>
+      st;
+  ParallelSort(d, st, keys, num, pool);
+}
+
+void PartialSortU64Desc(uint64_t* HWY_RESTRICT keys, size_t num, size_t k,
+                        uint64_t* HWY_RESTRICT buf) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<uint64_t>>>
+      st;
+  PartialSort(d, st, keys, num, k, buf);
+}
+
+void SelectU64Desc(uint64_t* HWY_RESTRICT keys, size_t num, size_t k,
+                   uint64_t* HWY_RESTRICT buf) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<uint64_t>>>
+      st;
+  Select(d, st, keys, num, k, buf);
+}
+
+void MergeU64Desc(const uint64_t* HWY_RESTRICT a, size_t num_a,
+                  const uint64_t* HWY_RESTRICT b, size_t num_b,
+                  uint64_t* HWY_RESTRICT out) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<uint64_t>>>
+      st;
+  Merge(d, st, a, num_a, b, num_b, out);
+}
+
+void MergeRunsU64Desc(const uint64_t* const* runs, const size_t* run_sizes,
+                      size_t num_runs, uint64_t* HWY_RESTRICT out,
+                      uint64_t* HWY_RESTRICT scratch) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<uint64_t>>>
+      st;
+  MergeRuns(d, st, runs, run_sizes, num_runs, out, scratch);
+}
+
+void SortSegmentsU64Desc(uint64_t* HWY_RESTRICT keys, const size_t* offsets,
+                         size_t num_segments, uint64_t* HWY_RESTRICT buf) {
+  SortTag<uint64_t> d;
+  detail::SharedTraits<detail::TraitsLane<detail::OrderDescending<uint64_t>>>
+      st;
+  SortSegments(d, st, keys, offsets, num_segments, buf);
+}
+
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace HWY_NAMESPACE
 }  // namespace hwy
@@ -44,6 +95,12 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortU64Desc);
+HWY_EXPORT(ParallelSortU64Desc);
+HWY_EXPORT(PartialSortU64Desc);
+HWY_EXPORT(SelectU64Desc);
+HWY_EXPORT(MergeU64Desc);
+HWY_EXPORT(MergeRunsU64Desc);
+HWY_EXPORT(SortSegmentsU64Desc);
 }  // namespace
 
 void Sorter::operator()(uint64_t* HWY_RESTRICT keys, size_t n,
@@ -51,5 +108,46 @@ void Sorter::operator()(uint64_t* HWY_RESTRICT keys, size_t n,
   HWY_DYNAMIC_DISPATCH(SortU64Desc)(keys, n, Get<uint64_t>());
 }
 
+void Sorter::operator()(uint64_t* HWY_RESTRICT keys, size_t n, SortDescending,
+                        ThreadPool& pool) const {
+  HWY_DYNAMIC_DISPATCH(ParallelSortU64Desc)(keys, n, pool);
+}
+
+void Sorter::PartialSort(uint64_t* HWY_RESTRICT keys, size_t n, size_t k,
+                         SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(PartialSortU64Desc)(keys, n, k, Get<uint64_t>());
+}
+
+void Sorter::Select(uint64_t* HWY_RESTRICT keys, size_t n, size_t k,
+                    SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(SelectU64Desc)(keys, n, k, Get<uint64_t>());
+}
+
+void Sorter::Merge(const uint64_t* HWY_RESTRICT a, size_t num_a,
+                   const uint64_t* HWY_RESTRICT b, size_t num_b,
+                   uint64_t* HWY_RESTRICT out, SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(MergeU64Desc)(a, num_a, b, num_b, out);
+}
+
+void Sorter::Merge(const uint64_t* const* runs, const size_t* run_sizes,
+                   size_t num_runs, uint64_t* HWY_RESTRICT out,
+                   SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsU64Desc)
+  (runs, run_sizes, num_runs, out, nullptr);
+}
+
+void Sorter::Merge(const uint64_t* const* runs, const size_t* run_sizes,
+                   size_t num_runs, uint64_t* HWY_RESTRICT out,
+                   uint64_t* HWY_RESTRICT scratch, SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(MergeRunsU64Desc)
+  (runs, run_sizes, num_runs, out, scratch);
+}
+
+void Sorter::SortSegments(uint64_t* HWY_RESTRICT keys, const size_t* offsets,
+                          size_t num_segments, SortDescending) const {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsU64Desc)
+  (keys, offsets, num_segments, Get<uint64_t>());
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -0,0 +1,184 @@
+// Copyright 2022 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures the latency of dispatching (nearly) empty work to all threads, for
+// ThreadPool and the mutex/condition_variable pool previously used by
+// contrib/sort/bench_parallel.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>  //NOLINT
+#include <mutex>               //NOLINT
+#include <thread>              //NOLINT
+#include <vector>
+
+#include "hwy/base.h"
+#include "hwy/contrib/thread_pool/thread_pool.h"
+#include "hwy/nanobenchmark.h"
+#include "gtest/gtest.h"
+
+namespace hwy {
+namespace {
+
+// Baseline: wakes all workers via a single condition_variable and waits for
+// them to report readiness via another.
+class CondVarPool {
+ public:
+  explicit CondVarPool(size_t num_threads) : num_threads_(num_threads) {
+    HWY_ASSERT(num_threads_ > 0);
+    threads_.reserve(num_threads_);
+    for (size_t i = 0; i < num_threads_; ++i) {
+      threads_.emplace_back(ThreadFunc, this, i);
+    }
+    WorkersReadyBarrier();
+  }
+
+  CondVarPool(const CondVarPool&) = delete;
+  CondVarPool& operator=(const CondVarPool&) = delete;
+
+  ~CondVarPool() {
+    StartWorkers(kWorkerExit);
+    for (std::thread& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  template <class Func>
+  void RunOnThreads(size_t max_threads, const Func& func) {
+    task_ = &CallClosure<Func>;
+    data_ = &func;
+    StartWorkers(max_threads);
+    WorkersReadyBarrier();
+  }
+
+ private:
+  using WorkerCommand = uint64_t;
+  static constexpr WorkerCommand kWorkerWait = ~1ULL;
+  static constexpr WorkerCommand kWorkerExit = ~2ULL;
+
+  template <class Closure>
+  static void CallClosure(const void* f, size_t thread) {
+    (*reinterpret_cast<const Closure*>(f))(thread);
+  }
+
+  void WorkersReadyBarrier() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (workers_ready_ != threads_.size()) {
+      workers_ready_cv_.wait(lock);
+    }
+    workers_ready_ = 0;
+    worker_start_command_ = kWorkerWait;
+  }
+
+  void StartWorkers(const WorkerCommand worker_command) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    worker_start_command_ = worker_command;
+    lock.unlock();
+    worker_start_cv_.notify_all();
+  }
+
+  static void ThreadFunc(CondVarPool* self, size_t thread) {
+    for (;;) {
+      std::unique_lock<std::mutex> lock(self->mutex_);
+      if (++self->workers_ready_ == self->num_threads_) {
+        self->workers_ready_cv_.notify_one();
+      }
+    RESUME_WAIT:
+      self->worker_start_cv_.wait(lock);
+      const WorkerCommand command = self->worker_start_command_;
+      switch (command) {
+        case kWorkerWait:
+          goto RESUME_WAIT;
+        case kWorkerExit:
+          return;
+        default:
+          break;
+      }
+      lock.unlock();
+      if (thread < command) {
+        self->task_(self->data_, thread);
+      }
+    }
+  }
+
+  const size_t num_threads_;
+  std::vector<std::thread> threads_;
+
+  std::mutex mutex_;
+  std::condition_variable workers_ready_cv_;
+  size_t workers_ready_ = 0;
+  std::condition_variable worker_start_cv_;
+  WorkerCommand worker_start_command_;
+
+  void (*task_)(const void*, size_t) = nullptr;
+  const void* data_ = nullptr;
+};
+
+constexpr size_t kReps = 2000;
+
+// Returns the median duration in microseconds.
+double MedianMicroseconds(std::vector<double>& seconds) {
+  std::sort(seconds.begin(), seconds.end());
+  return seconds[seconds.size() / 2] * 1E6;
+}
+
+TEST(BenchThreadPool, DispatchLatency) {
+  const size_t max_threads =
+      HWY_MAX(size_t{2}, static_cast<size_t>(
+                             std::thread::hardware_concurrency()));
+  for (size_t num_threads = 2; num_threads <= max_threads;
+       num_threads *= 2) {
+    std::vector<double> seconds(kReps);
+    std::atomic<uint64_t> sum{0};
+
+    {
+      CondVarPool pool(num_threads);
+      for (double& sec : seconds) {
+        const double t0 = platform::Now();
+        pool.RunOnThreads(num_threads, [&sum](size_t thread) {
+          sum.fetch_add(thread, std::memory_order_relaxed);
+        });
+        sec = platform::Now() - t0;
+      }
+    }
+    const double condvar = MedianMicroseconds(seconds);
+
+    {
+      ThreadPool pool(num_threads);
+      for (double& sec : seconds) {
+        const double t0 = platform::Now();
+        pool.ParallelFor(num_threads, 1,
+                         [&sum](uint64_t begin, uint64_t /*end*/,
+                                size_t /*thread*/) {
+                           sum.fetch_add(begin, std::memory_order_relaxed);
+                         });
+        sec = platform::Now() - t0;
+      }
+    }
+    const double pool = MedianMicroseconds(seconds);
+
+    fprintf(stderr, "%3zu threads: condvar %8.2f us, ThreadPool %8.2f us\n",
+            num_threads, condvar, pool);
+    // Both pools add 0 + 1 + .. + num_threads - 1 per rep.
+    EXPECT_EQ(2 * kReps * (num_threads * (num_threads - 1) / 2), sum.load());
+  }
+}
+
+}  // namespace
+}  // namespace hwy
@@ -0,0 +1,208 @@
+// Copyright 2022 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hwy/contrib/thread_pool/thread_pool.h"
+
+#include "hwy/cache_control.h"  // Pause
+
+namespace hwy {
+namespace {
+
+// How often to poll before blocking. Pause takes 10-140 cycles depending on
+// the CPU, so this corresponds to roughly 10-100 microseconds, which is
+// enough to cover the gap between ParallelFor of typical loops.
+constexpr size_t kMaxSpins = 16384;
+
+// Chunk indices are stored as two 32-bit halves of Deque::front_back.
+constexpr uint64_t kMaxChunks = 0xFFFFFFFFull;
+
+HWY_INLINE uint64_t Pack(uint64_t front, uint64_t back) {
+  return (front << 32) | back;
+}
+HWY_INLINE uint64_t Front(uint64_t front_back) { return front_back >> 32; }
+HWY_INLINE uint64_t Back(uint64_t front_back) {
+  return front_back & 0xFFFFFFFFull;
+}
+
+}  // namespace
+
+ThreadPool::ThreadPool(size_t num_threads)
+    : num_threads_(num_threads != 0
+                       ? num_threads
+                       : HWY_MAX(size_t{1}, static_cast<size_t>(
+                                     std::thread::hardware_concurrency()))),
+      // Spinning only helps if each thread has its own core; otherwise it
+      // delays the threads that have work.
+      max_spins_(num_threads_ <= std::thread::hardware_concurrency()
+                     ? kMaxSpins
+                     : 0),
+      deques_(MakeUniqueAlignedArray<Deque>(num_threads_)) {
+  for (size_t thread = 0; thread < num_threads_; ++thread) {
+    deques_[thread].front_back.store(0, std::memory_order_relaxed);
+  }
+  workers_.reserve(num_threads_ - 1);
+  // Thread 0 is the caller of ParallelFor.
+  for (size_t thread = 1; thread < num_threads_; ++thread) {
+    workers_.emplace_back(ThreadFunc, this, thread);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  exit_ = true;
+  StartWorkers();
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+}
+
+uint64_t ThreadPool::WaitForEpoch(uint64_t prev_epoch) {
+  for (size_t spin = 0; spin < max_spins_; ++spin) {
+    const uint64_t epoch = epoch_.load(std::memory_order_acquire);
+    if (epoch != prev_epoch) return epoch;
+    Pause();
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  // Sequentially consistent: StartWorkers either sees this increment, or we
+  // see its new epoch (see comment there).
+  num_sleeping_.fetch_add(1);
+  uint64_t epoch;
+  while ((epoch = epoch_.load()) == prev_epoch) {
+    cv_.wait(lock);
+  }
+  num_sleeping_.fetch_sub(1);
+  return epoch;
+}
+
+void ThreadPool::StartWorkers() {
+  epoch_.fetch_add(1);
+  // Avoid the cost of notifying if all workers are still spinning. This is
+  // safe because sleepers increment num_sleeping_ before checking epoch_,
+  // and we increment epoch_ before checking num_sleeping_. The mutex ensures
+  // a worker that is about to wait receives the notification.
+  if (num_sleeping_.load() != 0) {
+    { std::lock_guard<std::mutex> lock(mutex_); }
+    cv_.notify_all();
+  }
+}
+
+bool ThreadPool::PopFront(size_t thread, uint64_t* chunk) {
+  std::atomic<uint64_t>& front_back = deques_[thread].front_back;
+  uint64_t prev = front_back.load(std::memory_order_relaxed);
+  for (;;) {
+    const uint64_t front = Front(prev);
+    if (front >= Back(prev)) return false;
+    // On failure, prev is updated and we retry.
+    if (front_back.compare_exchange_weak(prev, Pack(front + 1, Back(prev)),
+                                         std::memory_order_relaxed)) {
+      *chunk = front;
+      return true;
+    }
+  }
+}
+
+bool ThreadPool::Steal(size_t thread, uint64_t* chunk) {
+  for (size_t i = 1; i < num_threads_; ++i) {
+    const size_t victim = (thread + i) % num_threads_;
+    std::atomic<uint64_t>& front_back = deques_[victim].front_back;
+    uint64_t prev = front_back.load(std::memory_order_relaxed);
+    for (;;) {
+      const uint64_t front = Front(prev);
+      const uint64_t back = Back(prev);
+      if (front >= back) break;  // try the next victim
+      // Take the back half, rounded up so that we also steal single chunks.
+      const uint64_t begin = back - (back - front + 1) / 2;
+      if (front_back.compare_exchange_weak(prev, Pack(front, begin),
+                                           std::memory_order_relaxed)) {
+        // Our own deque is empty, so we can overwrite it. Other threads may
+        // steal these before we pop them, which is fine.
+        deques_[thread].front_back.store(Pack(begin + 1, back),
+                                         std::memory_order_relaxed);
+        *chunk = begin;
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+void ThreadPool::RunChunks(size_t thread) {
+  uint64_t chunk;
+  while (PopFront(thread, &chunk) || Steal(thread, &chunk)) {
+    const uint64_t begin = chunk * grain_;
+    const uint64_t end = HWY_MIN(begin + grain_, range_);
+    task_(opaque_, begin, end, thread);
+  }
+}
+
+void ThreadPool::ThreadFunc(ThreadPool* self, size_t thread) {
+  uint64_t epoch = 0;
+  for (;;) {
+    epoch = self->WaitForEpoch(epoch);
+    if (self->exit_) return;
+    self->RunChunks(thread);
+    self->workers_done_.fetch_add(1, std::memory_order_release);
+  }
+}
+
+void ThreadPool::Run(uint64_t range, uint64_t grain, Task task,
+                     const void* opaque) {
+  HWY_ASSERT(grain != 0);
+  if (range == 0) return;
+  uint64_t num_chunks = DivCeil(range, grain);
+  if (HWY_UNLIKELY(num_chunks > kMaxChunks)) {
+    grain = DivCeil(range, kMaxChunks);
+    num_chunks = DivCeil(range, grain);
+  }
+
+  // Distribute the chunks evenly; some threads may receive none.
+  for (size_t thread = 0; thread < num_threads_; ++thread) {
+    const uint64_t front = num_chunks * thread / num_threads_;
+    const uint64_t back = num_chunks * (thread + 1) / num_threads_;
+    deques_[thread].front_back.store(Pack(front, back),
+                                     std::memory_order_relaxed);
+  }
+  task_ = task;
+  opaque_ = opaque;
+  range_ = range;
+  grain_ = grain;
+  workers_done_.store(0, std::memory_order_relaxed);
+
+  // Skip waking workers if the caller would anyway run everything.
+  if (num_chunks > 1 && !workers_.empty()) {
+    StartWorkers();
+    RunChunks(0);
+
+    // Workers may still be running their last chunk. `task_` and `opaque_`
+    // must remain valid until they are done.
+    for (size_t spin = 0;
+         workers_done_.load(std::memory_order_acquire) != workers_.size();
+         ++spin) {
+      if (spin < max_spins_) {
+        Pause();
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  } else {
+    // Also covers chunks that were assigned to workers.
+    for (uint64_t chunk = 0; chunk < num_chunks; ++chunk) {
+      const uint64_t begin = chunk * grain;
+      task(opaque, begin, HWY_MIN(begin + grain, range), 0);
+    }
+  }
+}
+
+}  // namespace hwy
@@ -0,0 +1,124 @@
+// Copyright 2022 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HIGHWAY_HWY_CONTRIB_THREAD_POOL_THREAD_POOL_H_
+#define HIGHWAY_HWY_CONTRIB_THREAD_POOL_THREAD_POOL_H_
+
+// Thread pool for fanning out data-parallel loops with low dispatch latency.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <condition_variable>  // NOLINT
+#include <mutex>               // NOLINT
+#include <thread>              // NOLINT
+#include <vector>
+
+#include "hwy/aligned_allocator.h"
+#include "hwy/base.h"
+#include "hwy/highway_export.h"
+
+namespace hwy {
+
+// Persistent worker threads which first spin, then block while waiting for
+// work. Each ParallelFor splits its range into chunks of `grain` items and
+// distributes them evenly among per-thread deques; threads that run out of
+// chunks steal half of the remaining chunks of another thread. This balances
+// load when chunks have varying cost, and avoids a central queue or mutex on
+// the critical path: dispatching to already spinning workers only requires
+// one atomic increment, which is much faster than waking them via a
+// condition variable.
+class HWY_CONTRIB_DLLEXPORT ThreadPool {
+ public:
+  // Runs on `num_threads` threads, including the one calling ParallelFor,
+  // which thus starts `num_threads - 1` workers. 0 means
+  // std::thread::hardware_concurrency().
+  explicit ThreadPool(size_t num_threads = 0);
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  // Waits for all workers to exit.
+  ~ThreadPool();
+
+  size_t NumThreads() const { return num_threads_; }
+
+  // Calls `func(begin, end, thread)` for disjoint, non-empty [begin, end)
+  // that together cover [0, range) and contain at most `grain` (> 0) items,
+  // except that ranges of more than 2^32 grains use a larger grain. `thread`
+  // is less than NumThreads() and unique among concurrent calls, hence
+  // suitable for indexing per-thread state. Blocks until all calls have
+  // returned. Must not be called concurrently nor from within `func`.
+  template <class Func>
+  void ParallelFor(uint64_t range, uint64_t grain, const Func& func) {
+    Run(range, grain, &CallClosure<Func>, &func);
+  }
+
+ private:
+  using Task = void (*)(const void* opaque, uint64_t begin, uint64_t end,
+                        size_t thread);
+
+  // Calls a closure (lambda with captures).
+  template <class Closure>
+  static void CallClosure(const void* opaque, uint64_t begin, uint64_t end,
+                          size_t thread) {
+    (*reinterpret_cast<const Closure*>(opaque))(begin, end, thread);
+  }
+
+  // Remaining chunk indices [front, back) of one thread, packed into one
+  // atomic so that the owner (popping the front) and thieves (taking the back
+  // half) can update them with a single compare-exchange. Cache line aligned
+  // to avoid false sharing.
+  struct alignas(64) Deque {
+    std::atomic<uint64_t> front_back;
+  };
+
+  void Run(uint64_t range, uint64_t grain, Task task, const void* opaque);
+  // Returns the new epoch.
+  uint64_t WaitForEpoch(uint64_t prev_epoch);
+  void StartWorkers();
+  bool PopFront(size_t thread, uint64_t* chunk);
+  bool Steal(size_t thread, uint64_t* chunk);
+  void RunChunks(size_t thread);
+  static void ThreadFunc(ThreadPool* self, size_t thread);
+
+  const size_t num_threads_;
+  const size_t max_spins_;  // before blocking
+  AlignedUniquePtr<Deque[]> deques_;
+  std::vector<std::thread> workers_;
+
+  // Incremented by the main thread to start workers. Its release/acquire
+  // semantics publish the following fields, which are written by the main
+  // thread only while workers are not running.
+  std::atomic<uint64_t> epoch_{0};
+  Task task_ = nullptr;
+  const void* opaque_ = nullptr;
+  uint64_t range_ = 0;
+  uint64_t grain_ = 0;
+  bool exit_ = false;
+
+  // Number of workers that have finished the current epoch.
+  std::atomic<size_t> workers_done_{0};
+
+  // For blocking after spinning for too long.
+  std::atomic<size_t> num_sleeping_{0};
+  std::mutex mutex_;
+  std::condition_variable cv_;
+};
+
+}  // namespace hwy
+
+#endif  // HIGHWAY_HWY_CONTRIB_THREAD_POOL_THREAD_POOL_H_
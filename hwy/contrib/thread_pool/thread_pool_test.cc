@@ -0,0 +1,122 @@
+// Copyright 2022 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hwy/contrib/thread_pool/thread_pool.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>  // NOLINT
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace hwy {
+namespace {
+
+TEST(ThreadPoolTest, NumThreads) {
+  EXPECT_EQ(1u, ThreadPool(1).NumThreads());
+  EXPECT_EQ(3u, ThreadPool(3).NumThreads());
+  EXPECT_LE(1u, ThreadPool().NumThreads());
+}
+
+TEST(ThreadPoolTest, EmptyRange) {
+  ThreadPool pool(4);
+  pool.ParallelFor(0, 1, [](uint64_t /*begin*/, uint64_t /*end*/,
+                            size_t /*thread*/) { HWY_ASSERT(false); });
+}
+
+// Every item is visited exactly once, in ranges of at most `grain` items.
+TEST(ThreadPoolTest, CoversRange) {
+  for (size_t num_threads : {1u, 2u, 3u, 8u}) {
+    ThreadPool pool(num_threads);
+    for (uint64_t range : {1u, 2u, 7u, 64u, 1000u, 12345u}) {
+      for (uint64_t grain : {1u, 3u, 64u, 100000u}) {
+        std::vector<std::atomic<int>> visits(range);
+        for (auto& v : visits) v.store(0);
+        pool.ParallelFor(range, grain,
+                         [&](uint64_t begin, uint64_t end, size_t thread) {
+                           HWY_ASSERT(begin < end && end <= range);
+                           HWY_ASSERT(end - begin <= grain);
+                           HWY_ASSERT(thread < num_threads);
+                           for (uint64_t i = begin; i < end; ++i) {
+                             visits[i].fetch_add(1);
+                           }
+                         });
+        for (uint64_t i = 0; i < range; ++i) {
+          ASSERT_EQ(1, visits[i].load()) << range << " " << grain << " " << i;
+        }
+      }
+    }
+  }
+}
+
+// Concurrent calls receive different `thread`, so per-thread state is safe.
+TEST(ThreadPoolTest, PerThreadState) {
+  ThreadPool pool(4);
+  // Padded to avoid false sharing.
+  std::vector<uint64_t> sums(pool.NumThreads() * 8);
+  std::vector<std::atomic<int>> busy(pool.NumThreads());
+  for (auto& b : busy) b.store(0);
+
+  const uint64_t range = 100000;
+  pool.ParallelFor(range, 10, [&](uint64_t begin, uint64_t end, size_t thread) {
+    HWY_ASSERT(busy[thread].fetch_add(1) == 0);
+    for (uint64_t i = begin; i < end; ++i) {
+      sums[thread * 8] += i;
+    }
+    busy[thread].fetch_sub(1);
+  });
+
+  uint64_t sum = 0;
+  for (size_t thread = 0; thread < pool.NumThreads(); ++thread) {
+    sum += sums[thread * 8];
+  }
+  EXPECT_EQ(range * (range - 1) / 2, sum);
+}
+
+// Work is stolen from threads that are blocked in long-running chunks.
+TEST(ThreadPoolTest, Imbalanced) {
+  ThreadPool pool(4);
+  std::atomic<uint64_t> count{0};
+  pool.ParallelFor(400, 1, [&](uint64_t begin, uint64_t /*end*/,
+                               size_t /*thread*/) {
+    if (begin == 0) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    count.fetch_add(1);
+  });
+  EXPECT_EQ(400u, count.load());
+}
+
+// Many consecutive dispatches, also after workers have started blocking.
+TEST(ThreadPoolTest, Reuse) {
+  ThreadPool pool(3);
+  std::atomic<uint64_t> count{0};
+  for (size_t rep = 0; rep < 2000; ++rep) {
+    pool.ParallelFor(5, 1, [&](uint64_t begin, uint64_t end, size_t /*thread*/) {
+      count.fetch_add(end - begin);
+    });
+    if (rep % 500 == 0) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+  }
+  EXPECT_EQ(2000u * 5, count.load());
+}
+
+}  // namespace
+}  // namespace hwy